@@ -0,0 +1,343 @@
+/*
+ * Microbenchmark and parity check for the per-bone animation kernels (graphics/anim_simd.u.c).
+ * Every kernel runs on a synthetic rig in both its scalar and dispatched (SSE4.1/AVX2/NEON)
+ * form; the resulting vertices must match bit for bit or the run fails.
+ *
+ * From this directory: make && ./bench_anim_frame_apply
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+int g_sin_table[2048];
+int g_cos_table[2048];
+int g_tan_table[2048];
+
+#include "../../src/graphics/anim.u.c"
+
+#ifndef BENCH_ITERS
+#define BENCH_ITERS 2000
+#endif
+
+enum
+{
+    VERTEX_COUNT = 4096,
+    BONE_COUNT = 96,
+};
+
+static vertexint_t g_base_x[VERTEX_COUNT];
+static vertexint_t g_base_y[VERTEX_COUNT];
+static vertexint_t g_base_z[VERTEX_COUNT];
+static boneint_t* g_bones[BONE_COUNT];
+static boneint_t g_bone_sizes[BONE_COUNT];
+
+static uint32_t g_rng = 0x12345678u;
+
+static uint32_t
+rng_next(void)
+{
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 17;
+    g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+static int
+rng_range(
+    int lo,
+    int hi)
+{
+    return lo + (int)(rng_next() % (uint32_t)(hi - lo + 1));
+}
+
+static double
+now_seconds(void)
+{
+    struct timespec ts;
+    if( clock_gettime(CLOCK_MONOTONIC, &ts) != 0 )
+        return 0.0;
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+static void
+tables_init(void)
+{
+    for( int i = 0; i < 2048; i++ )
+    {
+        g_sin_table[i] = (int)(sin((double)i * 0.0030679615) * (1 << 16));
+        g_cos_table[i] = (int)(cos((double)i * 0.0030679615) * (1 << 16));
+    }
+}
+
+/* Every vertex belongs to exactly one bone, as in model labels; bone sizes vary so the vector
+ * tails get exercised. */
+static void
+rig_init(void)
+{
+    int owner[VERTEX_COUNT];
+    for( int i = 0; i < VERTEX_COUNT; i++ )
+    {
+        g_base_x[i] = (vertexint_t)rng_range(-2000, 2000);
+        g_base_y[i] = (vertexint_t)rng_range(-2000, 2000);
+        g_base_z[i] = (vertexint_t)rng_range(-2000, 2000);
+        owner[i] = rng_range(0, BONE_COUNT - 1);
+        g_bone_sizes[owner[i]]++;
+    }
+    for( int b = 0; b < BONE_COUNT; b++ )
+    {
+        g_bones[b] = (boneint_t*)malloc(sizeof(boneint_t) * (g_bone_sizes[b] + 1));
+        g_bone_sizes[b] = 0;
+    }
+    for( int i = 0; i < VERTEX_COUNT; i++ )
+        g_bones[owner[i]][g_bone_sizes[owner[i]]++] = (boneint_t)i;
+}
+
+struct Pose
+{
+    vertexint_t x[VERTEX_COUNT];
+    vertexint_t y[VERTEX_COUNT];
+    vertexint_t z[VERTEX_COUNT];
+};
+
+static void
+pose_reset(struct Pose* p)
+{
+    memcpy(p->x, g_base_x, sizeof(p->x));
+    memcpy(p->y, g_base_y, sizeof(p->y));
+    memcpy(p->z, g_base_z, sizeof(p->z));
+}
+
+static struct AnimRotate
+random_rotate(void)
+{
+    int pitch = rng_range(0, 255) * 8;
+    int yaw = rng_range(0, 255) * 8;
+    int roll = rng_range(0, 255) * 8;
+    struct AnimRotate r = {
+        .origin_x = rng_range(-500, 500),
+        .origin_y = rng_range(-500, 500),
+        .origin_z = rng_range(-500, 500),
+        .has_roll = roll != 0,
+        .has_pitch = pitch != 0,
+        .has_yaw = yaw != 0,
+        .sin_roll = g_sin_table[roll],
+        .cos_roll = g_cos_table[roll],
+        .sin_pitch = g_sin_table[pitch],
+        .cos_pitch = g_cos_table[pitch],
+        .sin_yaw = g_sin_table[yaw],
+        .cos_yaw = g_cos_table[yaw],
+    };
+    return r;
+}
+
+static struct AnimScale
+random_scale(void)
+{
+    struct AnimScale s = {
+        .origin_x = rng_range(-500, 500),
+        .origin_y = rng_range(-500, 500),
+        .origin_z = rng_range(-500, 500),
+        .scale_x = rng_range(-256, 256),
+        .scale_y = rng_range(-256, 256),
+        .scale_z = rng_range(-256, 256),
+    };
+    return s;
+}
+
+static int
+pose_equal(
+    const struct Pose* a,
+    const struct Pose* b,
+    const char* what)
+{
+    if( memcmp(a, b, sizeof(*a)) == 0 )
+        return 1;
+    for( int i = 0; i < VERTEX_COUNT; i++ )
+    {
+        if( a->x[i] != b->x[i] || a->y[i] != b->y[i] || a->z[i] != b->z[i] )
+        {
+            fprintf(
+                stderr,
+                "%s mismatch at vertex %d: scalar (%d %d %d) simd (%d %d %d)\n",
+                what,
+                i,
+                a->x[i],
+                a->y[i],
+                a->z[i],
+                b->x[i],
+                b->y[i],
+                b->z[i]);
+            break;
+        }
+    }
+    return 0;
+}
+
+/* Chains of translate, rotate and scale over all bones, as a frame would apply them. */
+static int
+check_parity(void)
+{
+    static struct Pose scalar;
+    static struct Pose simd;
+    for( int round = 0; round < 200; round++ )
+    {
+        pose_reset(&scalar);
+        pose_reset(&simd);
+        for( int step = 0; step < 6; step++ )
+        {
+            int dx = rng_range(-300, 300);
+            int dy = rng_range(-300, 300);
+            int dz = rng_range(-300, 300);
+            struct AnimRotate r = random_rotate();
+            struct AnimScale s = random_scale();
+            for( int b = 0; b < BONE_COUNT; b++ )
+            {
+                const boneint_t* bone = g_bones[b];
+                int n = g_bone_sizes[b];
+                anim_bone_translate_scalar(bone, n, scalar.x, scalar.y, scalar.z, dx, dy, dz);
+                anim_bone_translate(bone, n, simd.x, simd.y, simd.z, dx, dy, dz);
+                anim_bone_rotate_scalar(bone, n, scalar.x, scalar.y, scalar.z, &r);
+                anim_bone_rotate(bone, n, simd.x, simd.y, simd.z, &r);
+                anim_bone_scale_scalar(bone, n, scalar.x, scalar.y, scalar.z, &s);
+                anim_bone_scale(bone, n, simd.x, simd.y, simd.z, &s);
+            }
+            if( !pose_equal(&scalar, &simd, "chain") )
+                return 0;
+        }
+    }
+    return 1;
+}
+
+typedef void (*translate_fn)(
+    const boneint_t*,
+    int,
+    vertexint_t*,
+    vertexint_t*,
+    vertexint_t*,
+    int,
+    int,
+    int);
+typedef void (*rotate_fn)(
+    const boneint_t*,
+    int,
+    vertexint_t*,
+    vertexint_t*,
+    vertexint_t*,
+    const struct AnimRotate*);
+typedef void (*scale_fn)(
+    const boneint_t*,
+    int,
+    vertexint_t*,
+    vertexint_t*,
+    vertexint_t*,
+    const struct AnimScale*);
+
+/* The same delta every iteration; int16 vertices wrap identically in both kernels. */
+static double
+time_translate(
+    translate_fn fn,
+    const int delta[3],
+    struct Pose* p)
+{
+    pose_reset(p);
+    double t0 = now_seconds();
+    for( int it = 0; it < BENCH_ITERS; it++ )
+    {
+        for( int b = 0; b < BONE_COUNT; b++ )
+            fn(g_bones[b], g_bone_sizes[b], p->x, p->y, p->z, delta[0], delta[1], delta[2]);
+    }
+    return now_seconds() - t0;
+}
+
+static double
+time_rotate(
+    rotate_fn fn,
+    const struct AnimRotate* r,
+    struct Pose* p)
+{
+    pose_reset(p);
+    double t0 = now_seconds();
+    for( int it = 0; it < BENCH_ITERS; it++ )
+    {
+        for( int b = 0; b < BONE_COUNT; b++ )
+            fn(g_bones[b], g_bone_sizes[b], p->x, p->y, p->z, r);
+    }
+    return now_seconds() - t0;
+}
+
+static double
+time_scale(
+    scale_fn fn,
+    const struct AnimScale* s,
+    struct Pose* p)
+{
+    pose_reset(p);
+    double t0 = now_seconds();
+    for( int it = 0; it < BENCH_ITERS; it++ )
+    {
+        for( int b = 0; b < BONE_COUNT; b++ )
+            fn(g_bones[b], g_bone_sizes[b], p->x, p->y, p->z, s);
+    }
+    return now_seconds() - t0;
+}
+
+static void
+print_row(
+    const char* name,
+    double scalar_s,
+    double simd_s)
+{
+    double verts = (double)BENCH_ITERS * VERTEX_COUNT;
+    printf(
+        "%-9s scalar %7.2f ns/vertex   simd %7.2f ns/vertex   x%.2f\n",
+        name,
+        scalar_s * 1e9 / verts,
+        simd_s * 1e9 / verts,
+        simd_s > 0.0 ? scalar_s / simd_s : 0.0);
+}
+
+int
+main(void)
+{
+    tables_init();
+    rig_init();
+
+    if( !check_parity() )
+    {
+        fprintf(stderr, "anim kernels: SIMD output differs from scalar\n");
+        return 1;
+    }
+    printf("parity: ok (%d vertices, %d bones)\n", VERTEX_COUNT, BONE_COUNT);
+
+    static struct Pose scalar;
+    static struct Pose simd;
+
+    int delta[3] = { rng_range(-300, 300), rng_range(-300, 300), rng_range(-300, 300) };
+    double trans_scalar = time_translate(anim_bone_translate_scalar, delta, &scalar);
+    double trans_simd = time_translate(anim_bone_translate, delta, &simd);
+    if( !pose_equal(&scalar, &simd, "translate") )
+        return 1;
+    print_row("translate", trans_scalar, trans_simd);
+
+    struct AnimRotate r = random_rotate();
+    r.has_roll = r.has_pitch = r.has_yaw = true;
+    double rot_scalar = time_rotate(anim_bone_rotate_scalar, &r, &scalar);
+    double rot_simd = time_rotate(anim_bone_rotate, &r, &simd);
+    if( !pose_equal(&scalar, &simd, "rotate") )
+        return 1;
+    print_row("rotate", rot_scalar, rot_simd);
+
+    struct AnimScale s = random_scale();
+    double scale_scalar = time_scale(anim_bone_scale_scalar, &s, &scalar);
+    double scale_simd = time_scale(anim_bone_scale, &s, &simd);
+    if( !pose_equal(&scalar, &simd, "scale") )
+        return 1;
+    print_row("scale", scale_scalar, scale_simd);
+
+    return 0;
+}
@@ -7,6 +7,7 @@ extern "C" {
 #include "osrs/game.h"
 #include "osrs/ginput.h"
 #include "osrs/world.h"
+#include "platforms/common/platform_thread.h"
 #include "platforms/common/sockstream.h"
 #include "tori_rs.h"
 }
@@ -196,6 +197,14 @@ struct BenchState
     int ring_pos;
     int ring_count;
     char last_error[256];
+
+    /* Band-parallel raster (soft3d tile_raster_*). Runs the production kernels, so the raster
+     * bench selector above is bypassed while it is on. */
+    int tile_raster;
+    int tile_threads;
+    /* Thread scaling run: step 0 is serial, step n >= 1 uses 1 << (n - 1) threads. */
+    bool running_scaling;
+    int scaling_step;
 };
 
 static BenchState g_bench;
@@ -249,6 +258,18 @@ current_bench_pack(BenchState const& s)
     return pack_with_override(s.bench_slot, s.bench_variant_idx);
 }
 
+static int
+scaling_step_threads(int step)
+{
+    return step <= 0 ? 0 : 1 << (step - 1);
+}
+
+static bool
+scaling_step_valid(int step)
+{
+    return step == 0 || scaling_step_threads(step) <= platform_cpu_count();
+}
+
 static bool
 bench_find_first_variant(
     int* out_slot,
@@ -420,7 +441,7 @@ bench_panel_draw(
             for( int i = 0; i < kBenchSlotCount; ++i )
                 g_bench.selected_variant[i] = kSlots[i].default_variant_index;
         }
-        if( nk_button_label(nk, "Run bench") && !g_bench.running_bench )
+        if( nk_button_label(nk, "Run bench") && !g_bench.running_bench && !g_bench.running_scaling )
         {
             if( g_bench.report_fp )
             {
@@ -446,6 +467,45 @@ bench_panel_draw(
         }
 
         nk_layout_row_dynamic(nk, 22, 1);
+        nk_checkbox_label(nk, "Parallel 3D raster (production kernels)", &g_bench.tile_raster);
+        nk_property_int(nk, "Raster threads (0 = CPUs)", 0, &g_bench.tile_threads, 64, 1, 0.1f);
+        if( nk_button_label(nk, "Run thread scaling") && !g_bench.running_bench &&
+            !g_bench.running_scaling )
+        {
+            if( g_bench.report_fp )
+            {
+                fclose(g_bench.report_fp);
+                g_bench.report_fp = NULL;
+            }
+            g_bench.report_fp = fopen("report.ini", "w");
+            if( !g_bench.report_fp )
+            {
+                snprintf(
+                    g_bench.last_error,
+                    sizeof(g_bench.last_error),
+                    "Could not open report.ini for writing.");
+            }
+            else
+            {
+                g_bench.last_error[0] = '\0';
+                g_bench.running_scaling = true;
+                g_bench.scaling_step = 0;
+                g_bench.frames_in_segment = 0;
+                g_bench.next_report_index = 1;
+            }
+        }
+        if( g_bench.running_scaling )
+        {
+            nk_labelf(
+                nk,
+                NK_TEXT_LEFT,
+                "Scaling progress: %s",
+                g_bench.scaling_step == 0 ? "serial" : "threads");
+            if( g_bench.scaling_step > 0 )
+                nk_labelf(
+                    nk, NK_TEXT_LEFT, "Threads: %d", scaling_step_threads(g_bench.scaling_step));
+        }
+
         if( g_bench.last_error[0] )
             nk_labelf(nk, NK_TEXT_LEFT, "%s", g_bench.last_error);
 
@@ -603,6 +663,20 @@ main(
         g_raster_bench.packed = packed;
         g_raster_bench.active = 1;
 
+        if( g_bench.running_scaling )
+        {
+            g_raster_bench.active = 0;
+            renderer_soft3d->tile_raster_enabled = g_bench.scaling_step > 0;
+            renderer_soft3d->tile_raster_threads = scaling_step_threads(g_bench.scaling_step);
+        }
+        else
+        {
+            if( g_bench.tile_raster && !g_bench.running_bench )
+                g_raster_bench.active = 0;
+            renderer_soft3d->tile_raster_enabled = g_bench.tile_raster != 0;
+            renderer_soft3d->tile_raster_threads = g_bench.tile_threads;
+        }
+
         /* Rolling avg + report.ini frametime_ms: soft3d LibToriRS_FrameBegin..FrameEnd only
          * (see renderer->last_raster_ms in platform_impl2_sdl2_renderer_soft3d_shared.cpp). */
 
@@ -625,7 +699,34 @@ main(
 
         ring_push(&g_bench, frame_ms);
 
-        if( g_bench.running_bench && g_bench.report_fp )
+        if( g_bench.running_scaling && g_bench.report_fp )
+        {
+            g_bench.segment_times_ms[g_bench.frames_in_segment++] = frame_ms;
+            if( g_bench.frames_in_segment >= kBenchFramesPerSegment )
+            {
+                double const m = mean_ms(g_bench.segment_times_ms, kBenchFramesPerSegment);
+                char combo[32];
+                if( g_bench.scaling_step == 0 )
+                    snprintf(combo, sizeof(combo), "serial");
+                else
+                    snprintf(
+                        combo,
+                        sizeof(combo),
+                        "threads.%d",
+                        scaling_step_threads(g_bench.scaling_step));
+                write_report_entry(
+                    g_bench.report_fp, g_bench.next_report_index++, "tile_raster", combo, m, game);
+                g_bench.scaling_step++;
+                if( !scaling_step_valid(g_bench.scaling_step) )
+                {
+                    fclose(g_bench.report_fp);
+                    g_bench.report_fp = NULL;
+                    g_bench.running_scaling = false;
+                }
+                g_bench.frames_in_segment = 0;
+            }
+        }
+        else if( g_bench.running_bench && g_bench.report_fp )
         {
             g_bench.segment_times_ms[g_bench.frames_in_segment++] = frame_ms;
             if( g_bench.frames_in_segment >= kBenchFramesPerSegment )
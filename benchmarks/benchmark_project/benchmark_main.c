@@ -25,6 +25,7 @@
 #include "nuklear/torirs_nuklear.h"
 
 /* Shared tables (hsl->rgb, reciprocal, trig) */
+#include "graphics/dash.h"
 #include "graphics/shared_tables.h"
 
 /* --- Include rasterizer implementations directly (static inline) --- */
@@ -159,6 +160,9 @@ enum BenchVariant
     BENCH_TEX_TRANS_DEOB,
     BENCH_TEX_OPAQUE_DEOB2,
     BENCH_TEX_TRANS_DEOB2,
+    BENCH_ROTATED_BLIT_EX,
+    BENCH_ROTATED_BLIT_MASKED,
+    BENCH_ROTATED_BLIT_MASKED_CIRCLE,
     BENCH_VARIANT_COUNT
 };
 
@@ -198,11 +202,15 @@ static const char* variant_names[BENCH_VARIANT_COUNT] = {
     "Texture transparent (Pix3D deob)",
     "Texture opaque (Pix3D deob2)",
     "Texture transparent (Pix3D deob2)",
+    "Rotated blit 64x64 (inline ref)",
+    "Rotated blit 64x64 (SIMD rows)",
+    "Rotated blit 64x64 (SIMD circle)",
 };
 
 /* Category for display grouping */
 static int variant_category[BENCH_VARIANT_COUNT] = {
     0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6,
 };
 static const char* category_names[] = {
     "Flat",
@@ -211,6 +219,7 @@ static const char* category_names[] = {
     "Texture Blend (Persp)",
     "Texture Blend (Affine)",
     "Deob (Pix3D reference)",
+    "2D (rotated sprite blit)",
 };
 
 /* ---------- Triangle data ---------- */
@@ -1255,6 +1264,50 @@ run_benchmark_variant(
                     texels,
                     0);
                 break;
+            case BENCH_ROTATED_BLIT_EX:
+                dash2d_blit_rotated_ex(
+                    texels,
+                    TEX_WIDTH,
+                    0,
+                    0,
+                    TEX_WIDTH,
+                    TEX_WIDTH,
+                    TEX_WIDTH / 2,
+                    TEX_WIDTH / 2,
+                    pixels,
+                    SCREEN_W,
+                    SCREEN_H,
+                    tri_x0[i],
+                    tri_y0[i],
+                    64,
+                    64,
+                    32,
+                    32,
+                    (i * 37) & 0x7ff);
+                break;
+            case BENCH_ROTATED_BLIT_MASKED:
+            case BENCH_ROTATED_BLIT_MASKED_CIRCLE:
+                dash2d_blit_rotated_masked(
+                    texels,
+                    TEX_WIDTH,
+                    0,
+                    0,
+                    TEX_WIDTH,
+                    TEX_WIDTH,
+                    TEX_WIDTH / 2,
+                    TEX_WIDTH / 2,
+                    pixels,
+                    SCREEN_W,
+                    SCREEN_H,
+                    tri_x0[i],
+                    tri_y0[i],
+                    64,
+                    64,
+                    32,
+                    32,
+                    (i * 37) & 0x7ff,
+                    variant == BENCH_ROTATED_BLIT_MASKED_CIRCLE);
+                break;
             default:
                 break;
             }
@@ -2014,6 +2067,50 @@ run_benchmark_variant(
                     texels,
                     0);
                 break;
+            case BENCH_ROTATED_BLIT_EX:
+                dash2d_blit_rotated_ex(
+                    texels,
+                    TEX_WIDTH,
+                    0,
+                    0,
+                    TEX_WIDTH,
+                    TEX_WIDTH,
+                    TEX_WIDTH / 2,
+                    TEX_WIDTH / 2,
+                    pixels,
+                    SCREEN_W,
+                    SCREEN_H,
+                    tri_x0[i],
+                    tri_y0[i],
+                    64,
+                    64,
+                    32,
+                    32,
+                    (i * 37) & 0x7ff);
+                break;
+            case BENCH_ROTATED_BLIT_MASKED:
+            case BENCH_ROTATED_BLIT_MASKED_CIRCLE:
+                dash2d_blit_rotated_masked(
+                    texels,
+                    TEX_WIDTH,
+                    0,
+                    0,
+                    TEX_WIDTH,
+                    TEX_WIDTH,
+                    TEX_WIDTH / 2,
+                    TEX_WIDTH / 2,
+                    pixels,
+                    SCREEN_W,
+                    SCREEN_H,
+                    tri_x0[i],
+                    tri_y0[i],
+                    64,
+                    64,
+                    32,
+                    32,
+                    (i * 37) & 0x7ff,
+                    variant == BENCH_ROTATED_BLIT_MASKED_CIRCLE);
+                break;
             default:
                 break;
             }
@@ -2284,6 +2381,11 @@ main(
     run_benchmark_variant(BENCH_TEX_OPAQUE_DEOB2, opaque_texels);
     run_benchmark_variant(BENCH_TEX_TRANS_DEOB2, transparent_texels);
 
+    printf("\n[2D — rotated sprite blit (minimap/compass)]\n");
+    run_benchmark_variant(BENCH_ROTATED_BLIT_EX, opaque_texels);
+    run_benchmark_variant(BENCH_ROTATED_BLIT_MASKED, opaque_texels);
+    run_benchmark_variant(BENCH_ROTATED_BLIT_MASKED_CIRCLE, opaque_texels);
+
     printf("\n=== Benchmarks complete. Displaying results. ===\n");
     printf("Close the window or press ESC to exit.\n\n");
 
@@ -0,0 +1,133 @@
+/*
+ * Microbenchmark for dashmap_search (graphics/dashmap.c) on BENCH_KEYS u32 keys in a map sized
+ * the way buildcachedat sizes its tables (capacity = keys * 4 / 3 + 1). Times insert, lookup of
+ * present and absent keys, and remove, and reports the buffer dashmap_buffer_size_for asks for.
+ *
+ * From this directory: make && ./bench_dashmap_search
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifndef DASHMAP_SRC
+#define DASHMAP_SRC "../../src/graphics/dashmap.c"
+#endif
+#include DASHMAP_SRC
+
+#ifndef BENCH_KEYS
+#define BENCH_KEYS 200000
+#endif
+
+#define LOOKUP_ROUNDS 10
+
+struct Entry
+{
+    uint32_t key;
+    void* value;
+};
+
+static double
+now_seconds(void)
+{
+    struct timespec ts;
+    if( clock_gettime(CLOCK_MONOTONIC, &ts) != 0 )
+        return 0.0;
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+/* Present keys are the even indices, absent ones the odd, both scattered by a Knuth multiply. */
+static uint32_t
+key_at(uint32_t i)
+{
+    return i * 2654435761u;
+}
+
+static void
+print_row(
+    const char* name,
+    double seconds,
+    double ops)
+{
+    printf("%-12s %7.2f ns/op\n", name, seconds * 1e9 / ops);
+}
+
+int
+main(void)
+{
+    size_t capacity = (size_t)BENCH_KEYS * 4 / 3 + 1;
+    size_t buffer_size = dashmap_buffer_size_for(sizeof(struct Entry), capacity);
+    struct DashMapConfig config = {
+        .buffer = malloc(buffer_size),
+        .buffer_size = buffer_size,
+        .key_size = sizeof(uint32_t),
+        .entry_size = sizeof(struct Entry),
+        .capacity = capacity,
+    };
+    struct DashMap* map = dashmap_new(&config, 0);
+    if( !map )
+    {
+        fprintf(stderr, "dashmap_new failed\n");
+        return 1;
+    }
+
+    double t0 = now_seconds();
+    for( uint32_t i = 0; i < BENCH_KEYS; i++ )
+    {
+        uint32_t key = key_at(i * 2);
+        struct Entry* entry = (struct Entry*)dashmap_search(map, &key, DASHMAP_INSERT);
+        entry->value = NULL;
+    }
+    double insert_s = now_seconds() - t0;
+
+    size_t hits = 0;
+    t0 = now_seconds();
+    for( int round = 0; round < LOOKUP_ROUNDS; round++ )
+    {
+        for( uint32_t i = 0; i < BENCH_KEYS; i++ )
+        {
+            uint32_t key = key_at(i * 2);
+            hits += dashmap_search(map, &key, DASHMAP_FIND) != NULL;
+        }
+    }
+    double hit_s = now_seconds() - t0;
+
+    size_t misses = 0;
+    t0 = now_seconds();
+    for( int round = 0; round < LOOKUP_ROUNDS; round++ )
+    {
+        for( uint32_t i = 0; i < BENCH_KEYS; i++ )
+        {
+            uint32_t key = key_at(i * 2 + 1);
+            misses += dashmap_search(map, &key, DASHMAP_FIND) == NULL;
+        }
+    }
+    double miss_s = now_seconds() - t0;
+
+    t0 = now_seconds();
+    for( uint32_t i = 0; i < BENCH_KEYS; i++ )
+    {
+        uint32_t key = key_at(i * 2);
+        dashmap_search(map, &key, DASHMAP_REMOVE);
+    }
+    double remove_s = now_seconds() - t0;
+
+    if( hits != (size_t)BENCH_KEYS * LOOKUP_ROUNDS ||
+        misses != (size_t)BENCH_KEYS * LOOKUP_ROUNDS || dashmap_count(map) != 0 )
+    {
+        fprintf(stderr, "dashmap: wrong lookup results\n");
+        return 1;
+    }
+
+    printf("%d keys, capacity %zu, buffer %zu bytes\n", BENCH_KEYS, capacity, buffer_size);
+    print_row("insert", insert_s, BENCH_KEYS);
+    print_row("find hit", hit_s, (double)BENCH_KEYS * LOOKUP_ROUNDS);
+    print_row("find miss", miss_s, (double)BENCH_KEYS * LOOKUP_ROUNDS);
+    print_row("remove", remove_s, BENCH_KEYS);
+
+    free(dashmap_buffer_ptr(map));
+    dashmap_free(map);
+    return 0;
+}
@@ -2,6 +2,9 @@
  * Benchmark raster_texshadeblend_persp_texopaque_branching_lerp8 (texture_blend_branching.u.c) vs
  * raster_texshadeblend_persp_texopaque_branching_lerp8_v3 (texture_blend_branching_v3.u.c).
  *
+ * A second section times DASH_TEXTURE_MIPMAP: a wall of distant faces drawn with the v3 raster,
+ * sampling the 128x128 textures vs their 64x64 level (same geometry, only texels/width change).
+ *
  * Same projection + tex.span (SIMD) are included once via the first header; the v3 header adds
  * the SIMD-path raster without re-including projection/simd (include guards).
  */
@@ -41,6 +44,12 @@ uint32_t g_reciprocal_norm30[1 << 15];
 #ifndef MAX_TEXTURE_DIM
 #define MAX_TEXTURE_DIM 128
 #endif
+#ifndef MIP_TEXTURE_COUNT
+#define MIP_TEXTURE_COUNT 48
+#endif
+#ifndef MIP_ITERS
+#define MIP_ITERS (BENCH_ITERS / 5 > 0 ? BENCH_ITERS / 5 : 1)
+#endif
 
 static double
 now_seconds(void)
@@ -187,6 +196,170 @@ time_raster(
     return t1 - t0;
 }
 
+/* 2x2 box filter, as dash.c builds level 1 for opaque textures. */
+static void
+build_mip(
+    const int* texels,
+    int* mip)
+{
+    for( int y = 0; y < 64; y++ )
+    {
+        for( int x = 0; x < 64; x++ )
+        {
+            const int* block = texels + 2 * y * 128 + 2 * x;
+            int t[4] = { block[0], block[1], block[128], block[129] };
+            int r = 0;
+            int g = 0;
+            int b = 0;
+            for( int i = 0; i < 4; i++ )
+            {
+                r += (t[i] >> 16) & 0xff;
+                g += (t[i] >> 8) & 0xff;
+                b += t[i] & 0xff;
+            }
+            mip[y * 64 + x] = (int)(0xff000000u | (uint32_t)((r / 4) << 16) |
+                                    (uint32_t)((g / 4) << 8) | (uint32_t)(b / 4));
+        }
+    }
+}
+
+/* Grid of camera-facing 128-unit textured quads at `depth`; with the 512 unit focal length each
+ * quad is 128 * 512 / depth pixels across. Every quad is two triangles sharing one P/M/N. */
+static double
+time_mip_wall(
+    int* pixels,
+    int screen_w,
+    int screen_h,
+    int depth,
+    int** textures,
+    int texture_dim)
+{
+    int face_px = (128 * 512) / depth;
+    int cols = screen_w / face_px;
+    int rows = screen_h / face_px;
+    int cx = screen_w >> 1;
+    int cy = screen_h >> 1;
+
+    double t0 = 0.0;
+    for( int n = -BENCH_WARMUP; n < MIP_ITERS; n++ )
+    {
+        if( n == 0 )
+            t0 = now_seconds();
+        for( int row = 0; row < rows; row++ )
+        {
+            for( int col = 0; col < cols; col++ )
+            {
+                int sx = col * face_px;
+                int sy = row * face_px;
+                int ox = ((sx - cx) * depth) / 512;
+                int oy = ((sy - cy) * depth) / 512;
+                int* texels = textures[(row * cols + col) % MIP_TEXTURE_COUNT];
+
+                bench_raster_texture_opaque_blend_simd(
+                    pixels,
+                    screen_w,
+                    screen_w,
+                    screen_h,
+                    256,
+                    sx,
+                    sx + face_px,
+                    sx,
+                    sy,
+                    sy,
+                    sy + face_px,
+                    ox,
+                    ox + 128,
+                    ox,
+                    oy,
+                    oy,
+                    oy + 128,
+                    depth,
+                    depth,
+                    depth,
+                    64,
+                    64,
+                    64,
+                    texels,
+                    texture_dim);
+                bench_raster_texture_opaque_blend_simd(
+                    pixels,
+                    screen_w,
+                    screen_w,
+                    screen_h,
+                    256,
+                    sx + face_px,
+                    sx + face_px,
+                    sx,
+                    sy,
+                    sy + face_px,
+                    sy + face_px,
+                    ox,
+                    ox + 128,
+                    ox,
+                    oy,
+                    oy,
+                    oy + 128,
+                    depth,
+                    depth,
+                    depth,
+                    64,
+                    64,
+                    64,
+                    texels,
+                    texture_dim);
+            }
+        }
+    }
+    double t1 = now_seconds();
+
+    volatile int sink = pixels[cy * screen_w + cx];
+    (void)sink;
+    return t1 - t0;
+}
+
+static void
+bench_mip(int* pixels)
+{
+    static int texels[MIP_TEXTURE_COUNT][128 * 128];
+    static int mips[MIP_TEXTURE_COUNT][64 * 64];
+    int* level0[MIP_TEXTURE_COUNT];
+    int* level1[MIP_TEXTURE_COUNT];
+
+    uint32_t seed = 0x12345678u;
+    for( int t = 0; t < MIP_TEXTURE_COUNT; t++ )
+    {
+        for( int i = 0; i < 128 * 128; i++ )
+        {
+            seed = seed * 1664525u + 1013904223u;
+            texels[t][i] = (int)(0xff000000u | (seed >> 8));
+        }
+        build_mip(texels[t], mips[t]);
+        level0[t] = texels[t];
+        level1[t] = mips[t];
+    }
+
+    static const int depths[] = { 1024, 2048, 4096 };
+    printf(
+        "DASH_TEXTURE_MIPMAP: wall of distant quads, %d textures, 1024x768, v3 raster\n"
+        "iters=%d\n\n",
+        MIP_TEXTURE_COUNT,
+        MIP_ITERS);
+    for( int d = 0; d < (int)(sizeof(depths) / sizeof(depths[0])); d++ )
+    {
+        double t0 = time_mip_wall(pixels, 1024, 768, depths[d], level0, 128);
+        double t1 = time_mip_wall(pixels, 1024, 768, depths[d], level1, 64);
+        printf(
+            "depth %d (%d px quads)\n"
+            "  level 0 (128x128): %6.3f ms/frame\n"
+            "  level 1 (64x64):   %6.3f ms/frame  (mip ~%.2f× faster)\n\n",
+            depths[d],
+            (128 * 512) / depths[d],
+            (t0 * 1e3) / (double)MIP_ITERS,
+            (t1 * 1e3) / (double)MIP_ITERS,
+            t1 > 0.0 ? t0 / t1 : 0.0);
+    }
+}
+
 int
 main(void)
 {
@@ -337,5 +510,7 @@ main(void)
             speedup);
     }
 
+    bench_mip(pixels);
+
     return 0;
 }
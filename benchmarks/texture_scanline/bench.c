@@ -1,5 +1,8 @@
-/* Times raster_texshadeflat_persp_textrans_sort_lerp8_scanline (scalar; includes texture.u.c). */
+/* Times raster_texshadeflat_persp_textrans_sort_lerp8_scanline (scalar; includes texture.u.c),
+ * then the opaque ordered lerp8 scanline over int32 texels against the palettized (8-bit index +
+ * palette) layout across a working set of textures. */
 #include <stdint.h>
+#include <string.h>
 #include <time.h>
 
 int g_sin_table[2048];
@@ -14,6 +17,21 @@ uint32_t g_reciprocal_norm30[1 << 15];
 #define BENCH_ITERS 5000
 #endif
 
+enum
+{
+    PAL8_TEXTURE_COUNT = 48,
+    PAL8_TEXTURE_WIDTH = 128,
+    PAL8_TEXELS = PAL8_TEXTURE_WIDTH * PAL8_TEXTURE_WIDTH,
+    PAL8_SCREEN_WIDTH = 1024,
+    PAL8_ROWS = 512,
+};
+
+static int g_pal8_texels[PAL8_TEXTURE_COUNT][PAL8_TEXELS];
+static uint8_t g_pal8_indices[PAL8_TEXTURE_COUNT][PAL8_TEXELS + 3];
+static int g_pal8_palettes[PAL8_TEXTURE_COUNT][256];
+static int g_pal8_row_int[PAL8_SCREEN_WIDTH];
+static int g_pal8_row_pal8[PAL8_SCREEN_WIDTH];
+
 static double
 now_seconds(void)
 {
@@ -23,6 +41,172 @@ now_seconds(void)
     return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
 }
 
+static void
+pal8_textures_init(void)
+{
+    uint32_t seed = 0x2545F491u;
+    for( int t = 0; t < PAL8_TEXTURE_COUNT; t++ )
+    {
+        for( int i = 0; i < 256; i++ )
+        {
+            seed = seed * 1664525u + 1013904223u;
+            g_pal8_palettes[t][i] = (int)(seed >> 8) | 0x010101;
+        }
+        for( int i = 0; i < PAL8_TEXELS; i++ )
+        {
+            seed = seed * 1664525u + 1013904223u;
+            g_pal8_indices[t][i] = (uint8_t)(seed >> 24);
+            g_pal8_texels[t][i] = g_pal8_palettes[t][g_pal8_indices[t][i]];
+        }
+    }
+}
+
+/* One scanline per row, cycling through the textures; u and v both sweep so consecutive pixels
+ * land on different texture rows. */
+static void
+pal8_row_params(
+    int row,
+    int* au,
+    int* bv,
+    int* step_au_dx,
+    int* step_bv_dx)
+{
+    *step_au_dx = 12 + (row & 7);
+    *step_bv_dx = 9 + ((row >> 3) & 7);
+    *au = (PAL8_SCREEN_WIDTH / 2) * *step_au_dx + (row & 15) * 64;
+    *bv = (PAL8_SCREEN_WIDTH / 2) * *step_bv_dx + row * 37;
+}
+
+static void
+pal8_draw_rows(
+    int* pixel_row,
+    int use_pal8)
+{
+    /* w = cw >> 7 = 128, so u = au / 128 and v = bv / 128. */
+    int cw = 128 << 7;
+    for( int row = 0; row < PAL8_ROWS; row++ )
+    {
+        int t = row % PAL8_TEXTURE_COUNT;
+        int au, bv, step_au_dx, step_bv_dx;
+        pal8_row_params(row, &au, &bv, &step_au_dx, &step_bv_dx);
+        if( use_pal8 )
+            raster_texshadeflat_persp_texopaque_ordered_lerp8_pal8_scanline(
+                pixel_row,
+                PAL8_SCREEN_WIDTH,
+                PAL8_SCREEN_WIDTH,
+                1,
+                0,
+                (PAL8_SCREEN_WIDTH - 1) << 16,
+                0,
+                au,
+                bv,
+                cw,
+                step_au_dx,
+                step_bv_dx,
+                0,
+                200,
+                g_pal8_indices[t],
+                g_pal8_palettes[t],
+                PAL8_TEXTURE_WIDTH);
+        else
+            raster_texshadeflat_persp_texopaque_ordered_lerp8_scanline(
+                pixel_row,
+                PAL8_SCREEN_WIDTH,
+                PAL8_SCREEN_WIDTH,
+                1,
+                0,
+                (PAL8_SCREEN_WIDTH - 1) << 16,
+                0,
+                au,
+                bv,
+                cw,
+                step_au_dx,
+                step_bv_dx,
+                0,
+                200,
+                g_pal8_texels[t],
+                PAL8_TEXTURE_WIDTH);
+    }
+}
+
+static int
+bench_pal8(void)
+{
+    pal8_textures_init();
+
+    /* Same pixels from both layouts, row by row. */
+    for( int row = 0; row < PAL8_ROWS; row++ )
+    {
+        int t = row % PAL8_TEXTURE_COUNT;
+        int au, bv, step_au_dx, step_bv_dx;
+        pal8_row_params(row, &au, &bv, &step_au_dx, &step_bv_dx);
+        memset(g_pal8_row_int, 0, sizeof(g_pal8_row_int));
+        memset(g_pal8_row_pal8, 0, sizeof(g_pal8_row_pal8));
+        raster_texshadeflat_persp_texopaque_ordered_lerp8_scanline(
+            g_pal8_row_int,
+            PAL8_SCREEN_WIDTH,
+            PAL8_SCREEN_WIDTH,
+            1,
+            0,
+            (PAL8_SCREEN_WIDTH - 1) << 16,
+            0,
+            au,
+            bv,
+            128 << 7,
+            step_au_dx,
+            step_bv_dx,
+            0,
+            200,
+            g_pal8_texels[t],
+            PAL8_TEXTURE_WIDTH);
+        raster_texshadeflat_persp_texopaque_ordered_lerp8_pal8_scanline(
+            g_pal8_row_pal8,
+            PAL8_SCREEN_WIDTH,
+            PAL8_SCREEN_WIDTH,
+            1,
+            0,
+            (PAL8_SCREEN_WIDTH - 1) << 16,
+            0,
+            au,
+            bv,
+            128 << 7,
+            step_au_dx,
+            step_bv_dx,
+            0,
+            200,
+            g_pal8_indices[t],
+            g_pal8_palettes[t],
+            PAL8_TEXTURE_WIDTH);
+        if( memcmp(g_pal8_row_int, g_pal8_row_pal8, sizeof(g_pal8_row_int)) != 0 )
+        {
+            fprintf(stderr, "texture_scanline pal8: row %d differs from int32 texels\n", row);
+            return 1;
+        }
+    }
+
+    int iters = BENCH_ITERS / 50 > 0 ? BENCH_ITERS / 50 : 1;
+    double times[2];
+    for( int use_pal8 = 0; use_pal8 < 2; use_pal8++ )
+    {
+        int* pixel_row = use_pal8 ? g_pal8_row_pal8 : g_pal8_row_int;
+        double t0 = now_seconds();
+        for( int n = 0; n < iters; n++ )
+            pal8_draw_rows(pixel_row, use_pal8);
+        times[use_pal8] = now_seconds() - t0;
+    }
+
+    double pixels = (double)iters * PAL8_ROWS * (PAL8_SCREEN_WIDTH - 1);
+    printf(
+        "texture_scanline opaque_ordered_lerp8 (%d textures): int32 %.2f ns/px (%d KB)  "
+        "pal8 %.2f ns/px (%d KB)\n",
+        PAL8_TEXTURE_COUNT,
+        times[0] * 1e9 / pixels,
+        (int)(sizeof(g_pal8_texels) / 1024),
+        times[1] * 1e9 / pixels,
+        (int)((sizeof(g_pal8_indices) + sizeof(g_pal8_palettes)) / 1024));
+    return 0;
+}
+
 int
 main(void)
 {
@@ -86,5 +270,5 @@ main(void)
         BENCH_ITERS,
         elapsed,
         ns_per);
-    return 0;
+    return bench_pal8();
 }
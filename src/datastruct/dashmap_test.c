@@ -0,0 +1,332 @@
+#include "../graphics/dashmap.c"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* -----------------------------
+ * Entry structures, one per key path: 4- and 8-byte keys take the inline hash and compare,
+ * other sizes FNV-1a, and a callback hash is re-mixed.
+ * ----------------------------- */
+
+typedef struct Entry32
+{
+    uint32_t key;
+    int value;
+} Entry32;
+
+typedef struct Entry64
+{
+    uint64_t key;
+    int value;
+} Entry64;
+
+typedef struct EntryName
+{
+    char key[12];
+    int value;
+} EntryName;
+
+/* Only 4 distinct hashes, so every probe runs across full groups of colliding entries. */
+static uint64_t
+weak_hash(const void* key, size_t key_size, void* arg)
+{
+    (void)key_size;
+    (void)arg;
+    return *(const uint32_t*)key & 3;
+}
+
+static struct DashMap*
+map_new(size_t key_size, size_t entry_size, size_t capacity, dashmap_hash_fn hash_fn)
+{
+    size_t buffer_size = dashmap_buffer_size_for(entry_size, capacity);
+    struct DashMapConfig config = {
+        .buffer = malloc(buffer_size),
+        .buffer_size = buffer_size,
+        .key_size = key_size,
+        .entry_size = entry_size,
+        .capacity = capacity,
+        .hash_fn_nullable = hash_fn,
+    };
+    struct DashMap* m = dashmap_new(&config, 0);
+    assert(m != NULL);
+    assert(dashmap_capacity(m) == capacity);
+    return m;
+}
+
+static void
+map_free(struct DashMap* m)
+{
+    free(dashmap_buffer_ptr(m));
+    dashmap_free(m);
+}
+
+/* Doubles the capacity into a new buffer, the way the callers grow their maps. */
+static void
+map_grow(struct DashMap* m, size_t entry_size)
+{
+    size_t capacity = dashmap_capacity(m) * 2;
+    size_t buffer_size = dashmap_buffer_size_for(entry_size, capacity);
+    void* old_buffer = NULL;
+    void* buffer = malloc(buffer_size);
+    assert(dashmap_resize(m, buffer, buffer_size, capacity, &old_buffer) == DASHMAP_OK);
+    assert(dashmap_capacity(m) == capacity);
+    free(old_buffer);
+}
+
+static int
+map_iter_count(struct DashMap* m)
+{
+    struct DashMapIter* it = dashmap_iter_new(m);
+    int n = 0;
+    while( dashmap_iter_next(it) )
+        n++;
+    dashmap_iter_free(it);
+    return n;
+}
+
+/* -----------------------------
+ * Tests
+ * ----------------------------- */
+
+static void
+test_insert_find(void)
+{
+    printf("TEST: insert/find\n");
+
+    struct DashMap* m = map_new(sizeof(uint32_t), sizeof(Entry32), 64, NULL);
+
+    for( uint32_t i = 0; i < 40; i++ )
+    {
+        Entry32* e = dashmap_search(m, &i, DASHMAP_INSERT);
+        assert(e != NULL && e->key == i);
+        e->value = (int)i * 10;
+    }
+    assert(dashmap_count(m) == 40);
+
+    for( uint32_t i = 0; i < 40; i++ )
+    {
+        Entry32* e = dashmap_search(m, &i, DASHMAP_FIND);
+        assert(e != NULL && e->value == (int)i * 10);
+    }
+    assert(dashmap_search(m, &(uint32_t){ 1000 }, DASHMAP_FIND) == NULL);
+
+    /* Inserting an existing key returns the same entry. */
+    Entry32* e = dashmap_search(m, &(uint32_t){ 7 }, DASHMAP_INSERT);
+    assert(e != NULL && e->value == 70);
+    assert(dashmap_count(m) == 40);
+
+    map_free(m);
+    printf("  OK\n");
+}
+
+static void
+test_key_paths(void)
+{
+    printf("TEST: 8-byte, FNV and callback-hash keys\n");
+
+    struct DashMap* m64 = map_new(sizeof(uint64_t), sizeof(Entry64), 64, NULL);
+    struct DashMap* mname = map_new(sizeof(((EntryName*)0)->key), sizeof(EntryName), 64, NULL);
+    struct DashMap* mweak = map_new(sizeof(uint32_t), sizeof(Entry32), 64, weak_hash);
+
+    for( int i = 0; i < 48; i++ )
+    {
+        /* Keys that differ only in the high half of the 8 bytes. */
+        uint64_t k64 = (uint64_t)i << 40;
+        ((Entry64*)dashmap_search(m64, &k64, DASHMAP_INSERT))->value = i;
+
+        char name[12] = "obj_";
+        name[4] = (char)('A' + i);
+        ((EntryName*)dashmap_search(mname, name, DASHMAP_INSERT))->value = i;
+
+        uint32_t k32 = (uint32_t)i;
+        ((Entry32*)dashmap_search(mweak, &k32, DASHMAP_INSERT))->value = i;
+    }
+
+    for( int i = 0; i < 48; i++ )
+    {
+        uint64_t k64 = (uint64_t)i << 40;
+        Entry64* e64 = dashmap_search(m64, &k64, DASHMAP_FIND);
+        assert(e64 != NULL && e64->value == i);
+
+        char name[12] = "obj_";
+        name[4] = (char)('A' + i);
+        EntryName* ename = dashmap_search(mname, name, DASHMAP_FIND);
+        assert(ename != NULL && ename->value == i);
+
+        uint32_t k32 = (uint32_t)i;
+        Entry32* eweak = dashmap_search(mweak, &k32, DASHMAP_FIND);
+        assert(eweak != NULL && eweak->value == i);
+    }
+    assert(dashmap_search(mweak, &(uint32_t){ 100 }, DASHMAP_FIND) == NULL);
+
+    map_free(m64);
+    map_free(mname);
+    map_free(mweak);
+    printf("  OK\n");
+}
+
+static void
+test_remove(void)
+{
+    printf("TEST: remove\n");
+
+    struct DashMap* m = map_new(sizeof(uint32_t), sizeof(Entry32), 32, NULL);
+
+    for( uint32_t i = 0; i < 20; i++ )
+        ((Entry32*)dashmap_search(m, &i, DASHMAP_INSERT))->value = (int)i;
+
+    for( uint32_t i = 0; i < 20; i += 2 )
+    {
+        Entry32* e = dashmap_search(m, &i, DASHMAP_REMOVE);
+        assert(e != NULL && e->key == i);
+    }
+    assert(dashmap_count(m) == 10);
+    assert(dashmap_search(m, &(uint32_t){ 4 }, DASHMAP_REMOVE) == NULL);
+
+    for( uint32_t i = 0; i < 20; i++ )
+    {
+        Entry32* e = dashmap_search(m, &i, DASHMAP_FIND);
+        assert((e != NULL) == (i % 2 == 1));
+    }
+    assert(map_iter_count(m) == 10);
+
+    map_free(m);
+    printf("  OK\n");
+}
+
+static void
+test_tombstone_reuse(void)
+{
+    printf("TEST: tombstone reuse\n");
+
+    /* A completely full table: only removed slots can take new keys. */
+    struct DashMap* m = map_new(sizeof(uint32_t), sizeof(Entry32), 20, NULL);
+
+    for( uint32_t i = 0; i < 20; i++ )
+        assert(dashmap_search(m, &i, DASHMAP_INSERT) != NULL);
+    assert(dashmap_search(m, &(uint32_t){ 99 }, DASHMAP_INSERT) == NULL);
+
+    for( int round = 0; round < 50; round++ )
+    {
+        for( uint32_t i = 0; i < 20; i += 2 )
+        {
+            uint32_t k = (uint32_t)round * 100 + i;
+            assert(dashmap_search(m, &k, DASHMAP_REMOVE) != NULL);
+        }
+        for( uint32_t i = 0; i < 20; i += 2 )
+        {
+            uint32_t k = (uint32_t)(round + 1) * 100 + i;
+            assert(dashmap_search(m, &k, DASHMAP_INSERT) != NULL);
+        }
+        assert(dashmap_count(m) == 20);
+        assert(dashmap_search(m, &(uint32_t){ 99 }, DASHMAP_INSERT) == NULL);
+    }
+
+    for( uint32_t i = 1; i < 20; i += 2 )
+        assert(dashmap_search(m, &i, DASHMAP_FIND) != NULL);
+    for( uint32_t i = 0; i < 20; i += 2 )
+        assert(dashmap_search(m, &(uint32_t){ 5000 + i }, DASHMAP_FIND) != NULL);
+
+    map_free(m);
+    printf("  OK\n");
+}
+
+static void
+test_rehash(void)
+{
+    printf("TEST: rehash\n");
+
+    struct DashMap* m = map_new(sizeof(uint32_t), sizeof(Entry32), 16, NULL);
+
+    /* Leave tombstones behind, then grow until 2000 keys fit. */
+    for( uint32_t i = 0; i < 12; i++ )
+        dashmap_search(m, &i, DASHMAP_INSERT);
+    for( uint32_t i = 0; i < 12; i += 3 )
+        dashmap_search(m, &i, DASHMAP_REMOVE);
+
+    for( uint32_t i = 12; i < 2000; i++ )
+    {
+        if( dashmap_count(m) >= dashmap_capacity(m) * 3 / 4 )
+            map_grow(m, sizeof(Entry32));
+        ((Entry32*)dashmap_search(m, &i, DASHMAP_INSERT))->value = (int)i;
+    }
+
+    for( uint32_t i = 0; i < 2000; i++ )
+    {
+        Entry32* e = dashmap_search(m, &i, DASHMAP_FIND);
+        assert((e != NULL) == (i >= 12 || i % 3 != 0));
+        if( i >= 12 )
+            assert(e->value == (int)i);
+    }
+    assert((int)dashmap_count(m) == map_iter_count(m));
+
+    map_free(m);
+    printf("  OK\n");
+}
+
+static void
+test_random_against_reference(void)
+{
+    printf("TEST: random ops against a reference table\n");
+
+    enum
+    {
+        KEYS = 4000
+    };
+    static int present[KEYS];
+    memset(present, 0, sizeof(present));
+    int count = 0;
+
+    struct DashMap* m = map_new(sizeof(uint32_t), sizeof(Entry32), 37, weak_hash);
+    uint32_t rng = 0x12345678u;
+    for( int it = 0; it < 200000; it++ )
+    {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        uint32_t key = rng % KEYS;
+        switch( (rng >> 16) % 3 )
+        {
+        case 0:
+            if( dashmap_count(m) >= dashmap_capacity(m) * 3 / 4 )
+                map_grow(m, sizeof(Entry32));
+            assert(dashmap_search(m, &key, DASHMAP_INSERT) != NULL);
+            count += !present[key];
+            present[key] = 1;
+            break;
+        case 1:
+            assert((dashmap_search(m, &key, DASHMAP_FIND) != NULL) == present[key]);
+            break;
+        case 2:
+            assert((dashmap_search(m, &key, DASHMAP_REMOVE) != NULL) == present[key]);
+            count -= present[key];
+            present[key] = 0;
+            break;
+        }
+        assert((int)dashmap_count(m) == count);
+    }
+    assert(map_iter_count(m) == count);
+
+    map_free(m);
+    printf("  OK\n");
+}
+
+// compile with:
+// clang -std=c11 -Wall -Wextra -o test_dashmap dashmap_test.c
+int
+main(void)
+{
+    test_insert_find();
+    test_key_paths();
+    test_remove();
+    test_tombstone_reuse();
+    test_rehash();
+    test_random_against_reference();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -5,6 +5,7 @@
 #include "dash_anim.h"
 #include "dash_boneint.h"
 #include "dash_vertexint.h"
+#include "anim_simd.u.c"
 
 #include <stdint.h>
 #include <string.h>
@@ -20,17 +21,6 @@ struct Transformation
     int origin_z;
 };
 
-/** Store animated vertex coords in int16 without relying on impl-defined int16 overflow. */
-static inline vertexint_t
-anim_vertexint_clamp(int v)
-{
-    // if( v > INT16_MAX )
-    //     return (vertexint_t)INT16_MAX;
-    // if( v < INT16_MIN )
-    //     return (vertexint_t)INT16_MIN;
-    return (vertexint_t)v;
-}
-
 static void
 animate(
     struct Transformation* transformation,
@@ -127,19 +117,15 @@ animate(
             if( bone_index >= vertex_bones_count )
                 continue;
 
-            boneint_t* bone = vertex_bones[bone_index];
-            int bone_length = vertex_bones_sizes[bone_index];
-
-            for( int j = 0; j < bone_length; ++j )
-            {
-                int vertex_index = bone[j];
-                int vx = (int)vertices_x[vertex_index] + arg_x;
-                int vy = (int)vertices_y[vertex_index] + arg_y;
-                int vz = (int)vertices_z[vertex_index] + arg_z;
-                vertices_x[vertex_index] = anim_vertexint_clamp(vx);
-                vertices_y[vertex_index] = anim_vertexint_clamp(vy);
-                vertices_z[vertex_index] = anim_vertexint_clamp(vz);
-            }
+            anim_bone_translate(
+                vertex_bones[bone_index],
+                vertex_bones_sizes[bone_index],
+                vertices_x,
+                vertices_y,
+                vertices_z,
+                arg_x,
+                arg_y,
+                arg_z);
         }
         break;
     }
@@ -149,86 +135,68 @@ animate(
         if( !vertex_bones || !vertex_bones_sizes )
             return;
 
+        int pitch = (arg_x & 255) * 8;
+        int yaw = (arg_y & 255) * 8;
+        int roll = (arg_z & 255) * 8;
+        struct AnimRotate rotate = {
+            .origin_x = transformation->origin_x,
+            .origin_y = transformation->origin_y,
+            .origin_z = transformation->origin_z,
+            .has_roll = roll != 0,
+            .has_pitch = pitch != 0,
+            .has_yaw = yaw != 0,
+            .sin_roll = g_sin_table[roll],
+            .cos_roll = g_cos_table[roll],
+            .sin_pitch = g_sin_table[pitch],
+            .cos_pitch = g_cos_table[pitch],
+            .sin_yaw = g_sin_table[yaw],
+            .cos_yaw = g_cos_table[yaw],
+        };
+
         for( int i = 0; i < bone_group_length; i++ )
         {
             int bone_index = bone_group[i];
             if( bone_index >= vertex_bones_count )
                 continue;
 
-            boneint_t* bone = vertex_bones[bone_index];
-            int bone_length = vertex_bones_sizes[bone_index];
-
-            for( int j = 0; j < bone_length; ++j )
-            {
-                int vertex_index = bone[j];
-                int x = (int)vertices_x[vertex_index] - transformation->origin_x;
-                int y = (int)vertices_y[vertex_index] - transformation->origin_y;
-                int z = (int)vertices_z[vertex_index] - transformation->origin_z;
-                int pitch = (arg_x & 255) * 8;
-                int yaw = (arg_y & 255) * 8;
-                int roll = (arg_z & 255) * 8;
-                int var17;
-                if( roll != 0 )
-                {
-                    int sin_roll = g_sin_table[roll];
-                    int cos_roll = g_cos_table[roll];
-                    var17 = (sin_roll * y + cos_roll * x) >> 16;
-                    y = (cos_roll * y - sin_roll * x) >> 16;
-                    x = var17;
-                }
-
-                if( pitch != 0 )
-                {
-                    int sin_pitch = g_sin_table[pitch];
-                    int cos_pitch = g_cos_table[pitch];
-                    var17 = (cos_pitch * y - sin_pitch * z) >> 16;
-                    z = (sin_pitch * y + cos_pitch * z) >> 16;
-                    y = var17;
-                }
-
-                if( yaw != 0 )
-                {
-                    int sin_yaw = g_sin_table[yaw];
-                    int cos_yaw = g_cos_table[yaw];
-                    var17 = (sin_yaw * z + cos_yaw * x) >> 16;
-                    z = (cos_yaw * z - sin_yaw * x) >> 16;
-                    x = var17;
-                }
-
-                vertices_x[vertex_index] = anim_vertexint_clamp(x + transformation->origin_x);
-                vertices_y[vertex_index] = anim_vertexint_clamp(y + transformation->origin_y);
-                vertices_z[vertex_index] = anim_vertexint_clamp(z + transformation->origin_z);
-            }
+            anim_bone_rotate(
+                vertex_bones[bone_index],
+                vertex_bones_sizes[bone_index],
+                vertices_x,
+                vertices_y,
+                vertices_z,
+                &rotate);
         }
         break;
     }
+    // SCALE
     case 3:
     {
         if( !vertex_bones || !vertex_bones_sizes )
             return;
 
+        struct AnimScale scale = {
+            .origin_x = transformation->origin_x,
+            .origin_y = transformation->origin_y,
+            .origin_z = transformation->origin_z,
+            .scale_x = arg_x,
+            .scale_y = arg_y,
+            .scale_z = arg_z,
+        };
+
         for( int i = 0; i < bone_group_length; i++ )
         {
             int bone_index = bone_group[i];
             if( bone_index >= vertex_bones_count )
                 continue;
 
-            boneint_t* bone = vertex_bones[bone_index];
-            int bone_length = vertex_bones_sizes[bone_index];
-
-            for( int j = 0; j < bone_length; ++j )
-            {
-                int vertex_index = bone[j];
-                int x = (int)vertices_x[vertex_index] - transformation->origin_x;
-                int y = (int)vertices_y[vertex_index] - transformation->origin_y;
-                int z = (int)vertices_z[vertex_index] - transformation->origin_z;
-                x = arg_x * x / 128;
-                y = arg_y * y / 128;
-                z = arg_z * z / 128;
-                vertices_x[vertex_index] = anim_vertexint_clamp(x + transformation->origin_x);
-                vertices_y[vertex_index] = anim_vertexint_clamp(y + transformation->origin_y);
-                vertices_z[vertex_index] = anim_vertexint_clamp(z + transformation->origin_z);
-            }
+            anim_bone_scale(
+                vertex_bones[bone_index],
+                vertex_bones_sizes[bone_index],
+                vertices_x,
+                vertices_y,
+                vertices_z,
+                &scale);
         }
         break;
     }
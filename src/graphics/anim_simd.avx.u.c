@@ -0,0 +1,124 @@
+#ifndef ANIM_SIMD_AVX_U_C
+#define ANIM_SIMD_AVX_U_C
+
+#if defined(__AVX2__) && !defined(AVX2_DISABLED)
+#include <immintrin.h>
+
+/* Lanes are gathered with scalar loads: a 32-bit hardware gather over int16 vertices would read
+ * past the last vertex. */
+static inline __m256i
+anim_gather8_avx(
+    const vertexint_t* v,
+    const boneint_t* idx)
+{
+    return _mm256_setr_epi32(
+        v[idx[0]], v[idx[1]], v[idx[2]], v[idx[3]], v[idx[4]], v[idx[5]], v[idx[6]], v[idx[7]]);
+}
+
+static inline void
+anim_scatter8_avx(
+    vertexint_t* v,
+    const boneint_t* idx,
+    __m256i x)
+{
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, x);
+    for( int k = 0; k < 8; k++ )
+        v[idx[k]] = (vertexint_t)lanes[k];
+}
+
+static inline void
+anim_rotate_pair_avx(
+    __m256i* p,
+    __m256i* q,
+    __m256i s,
+    __m256i c)
+{
+    __m256i np = _mm256_add_epi32(_mm256_mullo_epi32(s, *q), _mm256_mullo_epi32(c, *p));
+    __m256i nq = _mm256_sub_epi32(_mm256_mullo_epi32(c, *q), _mm256_mullo_epi32(s, *p));
+    *p = _mm256_srai_epi32(np, 16);
+    *q = _mm256_srai_epi32(nq, 16);
+}
+
+static inline __m256i
+anim_div128_avx(__m256i v)
+{
+    __m256i bias = _mm256_and_si256(_mm256_srai_epi32(v, 31), _mm256_set1_epi32(127));
+    return _mm256_srai_epi32(_mm256_add_epi32(v, bias), 7);
+}
+
+static inline void
+anim_bone_rotate_avx(
+    const boneint_t* bone,
+    int length,
+    vertexint_t* vertices_x,
+    vertexint_t* vertices_y,
+    vertexint_t* vertices_z,
+    const struct AnimRotate* r)
+{
+    __m256i ox = _mm256_set1_epi32(r->origin_x);
+    __m256i oy = _mm256_set1_epi32(r->origin_y);
+    __m256i oz = _mm256_set1_epi32(r->origin_z);
+    __m256i sin_roll = _mm256_set1_epi32(r->sin_roll);
+    __m256i cos_roll = _mm256_set1_epi32(r->cos_roll);
+    __m256i sin_pitch = _mm256_set1_epi32(r->sin_pitch);
+    __m256i cos_pitch = _mm256_set1_epi32(r->cos_pitch);
+    __m256i sin_yaw = _mm256_set1_epi32(r->sin_yaw);
+    __m256i cos_yaw = _mm256_set1_epi32(r->cos_yaw);
+
+    int j = 0;
+    for( ; j + 8 <= length; j += 8 )
+    {
+        const boneint_t* idx = &bone[j];
+        __m256i x = _mm256_sub_epi32(anim_gather8_avx(vertices_x, idx), ox);
+        __m256i y = _mm256_sub_epi32(anim_gather8_avx(vertices_y, idx), oy);
+        __m256i z = _mm256_sub_epi32(anim_gather8_avx(vertices_z, idx), oz);
+        if( r->has_roll )
+            anim_rotate_pair_avx(&x, &y, sin_roll, cos_roll);
+        if( r->has_pitch )
+            anim_rotate_pair_avx(&z, &y, sin_pitch, cos_pitch);
+        if( r->has_yaw )
+            anim_rotate_pair_avx(&x, &z, sin_yaw, cos_yaw);
+        anim_scatter8_avx(vertices_x, idx, _mm256_add_epi32(x, ox));
+        anim_scatter8_avx(vertices_y, idx, _mm256_add_epi32(y, oy));
+        anim_scatter8_avx(vertices_z, idx, _mm256_add_epi32(z, oz));
+    }
+    anim_bone_rotate_scalar(&bone[j], length - j, vertices_x, vertices_y, vertices_z, r);
+}
+
+static inline void
+anim_bone_scale_avx(
+    const boneint_t* bone,
+    int length,
+    vertexint_t* vertices_x,
+    vertexint_t* vertices_y,
+    vertexint_t* vertices_z,
+    const struct AnimScale* s)
+{
+    __m256i ox = _mm256_set1_epi32(s->origin_x);
+    __m256i oy = _mm256_set1_epi32(s->origin_y);
+    __m256i oz = _mm256_set1_epi32(s->origin_z);
+    __m256i sx = _mm256_set1_epi32(s->scale_x);
+    __m256i sy = _mm256_set1_epi32(s->scale_y);
+    __m256i sz = _mm256_set1_epi32(s->scale_z);
+
+    int j = 0;
+    for( ; j + 8 <= length; j += 8 )
+    {
+        const boneint_t* idx = &bone[j];
+        __m256i x = _mm256_sub_epi32(anim_gather8_avx(vertices_x, idx), ox);
+        __m256i y = _mm256_sub_epi32(anim_gather8_avx(vertices_y, idx), oy);
+        __m256i z = _mm256_sub_epi32(anim_gather8_avx(vertices_z, idx), oz);
+        x = anim_div128_avx(_mm256_mullo_epi32(sx, x));
+        y = anim_div128_avx(_mm256_mullo_epi32(sy, y));
+        z = anim_div128_avx(_mm256_mullo_epi32(sz, z));
+        anim_scatter8_avx(vertices_x, idx, _mm256_add_epi32(x, ox));
+        anim_scatter8_avx(vertices_y, idx, _mm256_add_epi32(y, oy));
+        anim_scatter8_avx(vertices_z, idx, _mm256_add_epi32(z, oz));
+    }
+    anim_bone_scale_scalar(&bone[j], length - j, vertices_x, vertices_y, vertices_z, s);
+}
+
+#endif
+
+#endif
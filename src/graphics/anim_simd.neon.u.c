@@ -0,0 +1,124 @@
+#ifndef ANIM_SIMD_NEON_U_C
+#define ANIM_SIMD_NEON_U_C
+
+#if ( defined(__ARM_NEON) || defined(__ARM_NEON__) ) && !defined(NEON_DISABLED)
+#include <arm_neon.h>
+
+static inline int32x4_t
+anim_gather4_neon(
+    const vertexint_t* v,
+    const boneint_t* idx)
+{
+    int32_t lanes[4] = { v[idx[0]], v[idx[1]], v[idx[2]], v[idx[3]] };
+    return vld1q_s32(lanes);
+}
+
+static inline void
+anim_scatter4_neon(
+    vertexint_t* v,
+    const boneint_t* idx,
+    int32x4_t x)
+{
+    int32_t lanes[4];
+    vst1q_s32(lanes, x);
+    v[idx[0]] = (vertexint_t)lanes[0];
+    v[idx[1]] = (vertexint_t)lanes[1];
+    v[idx[2]] = (vertexint_t)lanes[2];
+    v[idx[3]] = (vertexint_t)lanes[3];
+}
+
+static inline void
+anim_rotate_pair_neon(
+    int32x4_t* p,
+    int32x4_t* q,
+    int32x4_t s,
+    int32x4_t c)
+{
+    int32x4_t np = vmlaq_s32(vmulq_s32(s, *q), c, *p);
+    int32x4_t nq = vmlsq_s32(vmulq_s32(c, *q), s, *p);
+    *p = vshrq_n_s32(np, 16);
+    *q = vshrq_n_s32(nq, 16);
+}
+
+static inline int32x4_t
+anim_div128_neon(int32x4_t v)
+{
+    int32x4_t bias = vandq_s32(vshrq_n_s32(v, 31), vdupq_n_s32(127));
+    return vshrq_n_s32(vaddq_s32(v, bias), 7);
+}
+
+static inline void
+anim_bone_rotate_neon(
+    const boneint_t* bone,
+    int length,
+    vertexint_t* vertices_x,
+    vertexint_t* vertices_y,
+    vertexint_t* vertices_z,
+    const struct AnimRotate* r)
+{
+    int32x4_t ox = vdupq_n_s32(r->origin_x);
+    int32x4_t oy = vdupq_n_s32(r->origin_y);
+    int32x4_t oz = vdupq_n_s32(r->origin_z);
+    int32x4_t sin_roll = vdupq_n_s32(r->sin_roll);
+    int32x4_t cos_roll = vdupq_n_s32(r->cos_roll);
+    int32x4_t sin_pitch = vdupq_n_s32(r->sin_pitch);
+    int32x4_t cos_pitch = vdupq_n_s32(r->cos_pitch);
+    int32x4_t sin_yaw = vdupq_n_s32(r->sin_yaw);
+    int32x4_t cos_yaw = vdupq_n_s32(r->cos_yaw);
+
+    int j = 0;
+    for( ; j + 4 <= length; j += 4 )
+    {
+        const boneint_t* idx = &bone[j];
+        int32x4_t x = vsubq_s32(anim_gather4_neon(vertices_x, idx), ox);
+        int32x4_t y = vsubq_s32(anim_gather4_neon(vertices_y, idx), oy);
+        int32x4_t z = vsubq_s32(anim_gather4_neon(vertices_z, idx), oz);
+        if( r->has_roll )
+            anim_rotate_pair_neon(&x, &y, sin_roll, cos_roll);
+        if( r->has_pitch )
+            anim_rotate_pair_neon(&z, &y, sin_pitch, cos_pitch);
+        if( r->has_yaw )
+            anim_rotate_pair_neon(&x, &z, sin_yaw, cos_yaw);
+        anim_scatter4_neon(vertices_x, idx, vaddq_s32(x, ox));
+        anim_scatter4_neon(vertices_y, idx, vaddq_s32(y, oy));
+        anim_scatter4_neon(vertices_z, idx, vaddq_s32(z, oz));
+    }
+    anim_bone_rotate_scalar(&bone[j], length - j, vertices_x, vertices_y, vertices_z, r);
+}
+
+static inline void
+anim_bone_scale_neon(
+    const boneint_t* bone,
+    int length,
+    vertexint_t* vertices_x,
+    vertexint_t* vertices_y,
+    vertexint_t* vertices_z,
+    const struct AnimScale* s)
+{
+    int32x4_t ox = vdupq_n_s32(s->origin_x);
+    int32x4_t oy = vdupq_n_s32(s->origin_y);
+    int32x4_t oz = vdupq_n_s32(s->origin_z);
+    int32x4_t sx = vdupq_n_s32(s->scale_x);
+    int32x4_t sy = vdupq_n_s32(s->scale_y);
+    int32x4_t sz = vdupq_n_s32(s->scale_z);
+
+    int j = 0;
+    for( ; j + 4 <= length; j += 4 )
+    {
+        const boneint_t* idx = &bone[j];
+        int32x4_t x = vsubq_s32(anim_gather4_neon(vertices_x, idx), ox);
+        int32x4_t y = vsubq_s32(anim_gather4_neon(vertices_y, idx), oy);
+        int32x4_t z = vsubq_s32(anim_gather4_neon(vertices_z, idx), oz);
+        x = anim_div128_neon(vmulq_s32(sx, x));
+        y = anim_div128_neon(vmulq_s32(sy, y));
+        z = anim_div128_neon(vmulq_s32(sz, z));
+        anim_scatter4_neon(vertices_x, idx, vaddq_s32(x, ox));
+        anim_scatter4_neon(vertices_y, idx, vaddq_s32(y, oy));
+        anim_scatter4_neon(vertices_z, idx, vaddq_s32(z, oz));
+    }
+    anim_bone_scale_scalar(&bone[j], length - j, vertices_x, vertices_y, vertices_z, s);
+}
+
+#endif
+
+#endif
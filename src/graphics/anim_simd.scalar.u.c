@@ -0,0 +1,91 @@
+#ifndef ANIM_SIMD_SCALAR_U_C
+#define ANIM_SIMD_SCALAR_U_C
+
+static inline void
+anim_bone_translate_scalar(
+    const boneint_t* bone,
+    int length,
+    vertexint_t* vertices_x,
+    vertexint_t* vertices_y,
+    vertexint_t* vertices_z,
+    int dx,
+    int dy,
+    int dz)
+{
+    for( int j = 0; j < length; ++j )
+    {
+        int vertex_index = bone[j];
+        vertices_x[vertex_index] = (vertexint_t)((int)vertices_x[vertex_index] + dx);
+        vertices_y[vertex_index] = (vertexint_t)((int)vertices_y[vertex_index] + dy);
+        vertices_z[vertex_index] = (vertexint_t)((int)vertices_z[vertex_index] + dz);
+    }
+}
+
+static inline void
+anim_bone_rotate_scalar(
+    const boneint_t* bone,
+    int length,
+    vertexint_t* vertices_x,
+    vertexint_t* vertices_y,
+    vertexint_t* vertices_z,
+    const struct AnimRotate* r)
+{
+    for( int j = 0; j < length; ++j )
+    {
+        int vertex_index = bone[j];
+        int x = (int)vertices_x[vertex_index] - r->origin_x;
+        int y = (int)vertices_y[vertex_index] - r->origin_y;
+        int z = (int)vertices_z[vertex_index] - r->origin_z;
+        int var17;
+        if( r->has_roll )
+        {
+            var17 = (r->sin_roll * y + r->cos_roll * x) >> 16;
+            y = (r->cos_roll * y - r->sin_roll * x) >> 16;
+            x = var17;
+        }
+
+        if( r->has_pitch )
+        {
+            var17 = (r->cos_pitch * y - r->sin_pitch * z) >> 16;
+            z = (r->sin_pitch * y + r->cos_pitch * z) >> 16;
+            y = var17;
+        }
+
+        if( r->has_yaw )
+        {
+            var17 = (r->sin_yaw * z + r->cos_yaw * x) >> 16;
+            z = (r->cos_yaw * z - r->sin_yaw * x) >> 16;
+            x = var17;
+        }
+
+        vertices_x[vertex_index] = (vertexint_t)(x + r->origin_x);
+        vertices_y[vertex_index] = (vertexint_t)(y + r->origin_y);
+        vertices_z[vertex_index] = (vertexint_t)(z + r->origin_z);
+    }
+}
+
+static inline void
+anim_bone_scale_scalar(
+    const boneint_t* bone,
+    int length,
+    vertexint_t* vertices_x,
+    vertexint_t* vertices_y,
+    vertexint_t* vertices_z,
+    const struct AnimScale* s)
+{
+    for( int j = 0; j < length; ++j )
+    {
+        int vertex_index = bone[j];
+        int x = (int)vertices_x[vertex_index] - s->origin_x;
+        int y = (int)vertices_y[vertex_index] - s->origin_y;
+        int z = (int)vertices_z[vertex_index] - s->origin_z;
+        x = s->scale_x * x / 128;
+        y = s->scale_y * y / 128;
+        z = s->scale_z * z / 128;
+        vertices_x[vertex_index] = (vertexint_t)(x + s->origin_x);
+        vertices_y[vertex_index] = (vertexint_t)(y + s->origin_y);
+        vertices_z[vertex_index] = (vertexint_t)(z + s->origin_z);
+    }
+}
+
+#endif
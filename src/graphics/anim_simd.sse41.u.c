@@ -0,0 +1,123 @@
+#ifndef ANIM_SIMD_SSE41_U_C
+#define ANIM_SIMD_SSE41_U_C
+
+#if defined(__SSE4_1__) && !defined(SSE2_DISABLED)
+#include <smmintrin.h>
+
+static inline __m128i
+anim_gather4_sse41(
+    const vertexint_t* v,
+    const boneint_t* idx)
+{
+    return _mm_setr_epi32(v[idx[0]], v[idx[1]], v[idx[2]], v[idx[3]]);
+}
+
+static inline void
+anim_scatter4_sse41(
+    vertexint_t* v,
+    const boneint_t* idx,
+    __m128i x)
+{
+    v[idx[0]] = (vertexint_t)_mm_cvtsi128_si32(x);
+    v[idx[1]] = (vertexint_t)_mm_extract_epi32(x, 1);
+    v[idx[2]] = (vertexint_t)_mm_extract_epi32(x, 2);
+    v[idx[3]] = (vertexint_t)_mm_extract_epi32(x, 3);
+}
+
+/* p' = (s*q + c*p) >> 16, q' = (c*q - s*p) >> 16: roll is (x, y), pitch (z, y), yaw (x, z). */
+static inline void
+anim_rotate_pair_sse41(
+    __m128i* p,
+    __m128i* q,
+    __m128i s,
+    __m128i c)
+{
+    __m128i np = _mm_add_epi32(_mm_mullo_epi32(s, *q), _mm_mullo_epi32(c, *p));
+    __m128i nq = _mm_sub_epi32(_mm_mullo_epi32(c, *q), _mm_mullo_epi32(s, *p));
+    *p = _mm_srai_epi32(np, 16);
+    *q = _mm_srai_epi32(nq, 16);
+}
+
+/* C division by 128 truncates toward zero: bias negative values by 127 before the shift. */
+static inline __m128i
+anim_div128_sse41(__m128i v)
+{
+    __m128i bias = _mm_and_si128(_mm_srai_epi32(v, 31), _mm_set1_epi32(127));
+    return _mm_srai_epi32(_mm_add_epi32(v, bias), 7);
+}
+
+static inline void
+anim_bone_rotate_sse41(
+    const boneint_t* bone,
+    int length,
+    vertexint_t* vertices_x,
+    vertexint_t* vertices_y,
+    vertexint_t* vertices_z,
+    const struct AnimRotate* r)
+{
+    __m128i ox = _mm_set1_epi32(r->origin_x);
+    __m128i oy = _mm_set1_epi32(r->origin_y);
+    __m128i oz = _mm_set1_epi32(r->origin_z);
+    __m128i sin_roll = _mm_set1_epi32(r->sin_roll);
+    __m128i cos_roll = _mm_set1_epi32(r->cos_roll);
+    __m128i sin_pitch = _mm_set1_epi32(r->sin_pitch);
+    __m128i cos_pitch = _mm_set1_epi32(r->cos_pitch);
+    __m128i sin_yaw = _mm_set1_epi32(r->sin_yaw);
+    __m128i cos_yaw = _mm_set1_epi32(r->cos_yaw);
+
+    int j = 0;
+    for( ; j + 4 <= length; j += 4 )
+    {
+        const boneint_t* idx = &bone[j];
+        __m128i x = _mm_sub_epi32(anim_gather4_sse41(vertices_x, idx), ox);
+        __m128i y = _mm_sub_epi32(anim_gather4_sse41(vertices_y, idx), oy);
+        __m128i z = _mm_sub_epi32(anim_gather4_sse41(vertices_z, idx), oz);
+        if( r->has_roll )
+            anim_rotate_pair_sse41(&x, &y, sin_roll, cos_roll);
+        if( r->has_pitch )
+            anim_rotate_pair_sse41(&z, &y, sin_pitch, cos_pitch);
+        if( r->has_yaw )
+            anim_rotate_pair_sse41(&x, &z, sin_yaw, cos_yaw);
+        anim_scatter4_sse41(vertices_x, idx, _mm_add_epi32(x, ox));
+        anim_scatter4_sse41(vertices_y, idx, _mm_add_epi32(y, oy));
+        anim_scatter4_sse41(vertices_z, idx, _mm_add_epi32(z, oz));
+    }
+    anim_bone_rotate_scalar(&bone[j], length - j, vertices_x, vertices_y, vertices_z, r);
+}
+
+static inline void
+anim_bone_scale_sse41(
+    const boneint_t* bone,
+    int length,
+    vertexint_t* vertices_x,
+    vertexint_t* vertices_y,
+    vertexint_t* vertices_z,
+    const struct AnimScale* s)
+{
+    __m128i ox = _mm_set1_epi32(s->origin_x);
+    __m128i oy = _mm_set1_epi32(s->origin_y);
+    __m128i oz = _mm_set1_epi32(s->origin_z);
+    __m128i sx = _mm_set1_epi32(s->scale_x);
+    __m128i sy = _mm_set1_epi32(s->scale_y);
+    __m128i sz = _mm_set1_epi32(s->scale_z);
+
+    int j = 0;
+    for( ; j + 4 <= length; j += 4 )
+    {
+        const boneint_t* idx = &bone[j];
+        __m128i x = _mm_sub_epi32(anim_gather4_sse41(vertices_x, idx), ox);
+        __m128i y = _mm_sub_epi32(anim_gather4_sse41(vertices_y, idx), oy);
+        __m128i z = _mm_sub_epi32(anim_gather4_sse41(vertices_z, idx), oz);
+        x = anim_div128_sse41(_mm_mullo_epi32(sx, x));
+        y = anim_div128_sse41(_mm_mullo_epi32(sy, y));
+        z = anim_div128_sse41(_mm_mullo_epi32(sz, z));
+        anim_scatter4_sse41(vertices_x, idx, _mm_add_epi32(x, ox));
+        anim_scatter4_sse41(vertices_y, idx, _mm_add_epi32(y, oy));
+        anim_scatter4_sse41(vertices_z, idx, _mm_add_epi32(z, oz));
+    }
+    anim_bone_scale_scalar(&bone[j], length - j, vertices_x, vertices_y, vertices_z, s);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef ANIM_SIMD_U_C
+#define ANIM_SIMD_U_C
+
+#include "dash_boneint.h"
+#include "dash_vertexint.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Per-bone vertex kernels for anim.u.c. A bone lists each vertex once, so its vertices can be
+ * transformed in lanes: gather by index, transform, scatter back. Every variant matches the scalar
+ * kernels bit for bit (wrapping 32-bit products, arithmetic >> 16, truncating / 128). */
+
+struct AnimRotate
+{
+    int origin_x;
+    int origin_y;
+    int origin_z;
+    bool has_roll;
+    bool has_pitch;
+    bool has_yaw;
+    int sin_roll;
+    int cos_roll;
+    int sin_pitch;
+    int cos_pitch;
+    int sin_yaw;
+    int cos_yaw;
+};
+
+struct AnimScale
+{
+    int origin_x;
+    int origin_y;
+    int origin_z;
+    int scale_x;
+    int scale_y;
+    int scale_z;
+};
+
+/* Scalar kernels are always built: they finish the tails of the vector kernels and are the
+ * reference for parity checks. */
+#include "anim_simd.scalar.u.c"
+
+/* A translate is one add per coordinate; gathering and scattering the lanes costs more than it
+ * saves (about 0.6x of scalar on SSE2, SSE4.1 and AVX2 in benchmarks/anim_frame_apply), so it
+ * stays scalar on every ISA. */
+#define anim_bone_translate anim_bone_translate_scalar
+
+#if ( defined(__ARM_NEON) || defined(__ARM_NEON__) ) && !defined(NEON_DISABLED)
+#include "anim_simd.neon.u.c"
+#define anim_bone_rotate anim_bone_rotate_neon
+#define anim_bone_scale anim_bone_scale_neon
+#elif defined(__AVX2__) && !defined(AVX2_DISABLED)
+#include "anim_simd.avx.u.c"
+#define anim_bone_rotate anim_bone_rotate_avx
+#define anim_bone_scale anim_bone_scale_avx
+#elif defined(__SSE4_1__) && !defined(SSE2_DISABLED)
+#include "anim_simd.sse41.u.c"
+#define anim_bone_rotate anim_bone_rotate_sse41
+#define anim_bone_scale anim_bone_scale_sse41
+#else
+/* SSE2 has no 32-bit mullo, and emulating it leaves rotate and scale at about 1.0x of scalar in
+ * benchmarks/anim_frame_apply, so a plain SSE2 build stays scalar too. */
+#define anim_bone_rotate anim_bone_rotate_scalar
+#define anim_bone_scale anim_bone_scale_scalar
+#endif
+
+#endif
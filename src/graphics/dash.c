@@ -32,47 +32,238 @@
 #  endif
 #endif
 
+/* 1 to give every texture with at most 256 colours an 8-bit palette-indexed copy, which the
+ * flat-shaded perspective spans sample instead of the int texels (a quarter of the cache
+ * footprint). See tex_pal8.span.u.c. */
+#ifndef DASH_TEXTURE_PAL8
+#define DASH_TEXTURE_PAL8 0
+#endif
+
+/* 1 to build a 64x64 level for every 128x128 texture and sample it for faces drawn at 64 pixels
+ * across or less. The spans only address 128 and 64 wide textures, so the chain stops there. */
+#ifndef DASH_TEXTURE_MIPMAP
+#define DASH_TEXTURE_MIPMAP 0
+#endif
+
+/* Shared between every DashGraphics created from it. Read-only while any of them is projecting or
+ * rasterizing; textures are registered and animated between frames. */
+struct DashRenderContext
+{
+    struct DashTextureMap texture_map;
+};
+
+/* Face and vertex indices are faceint_t, which bounds every scratch buffer. */
+#define DASH_SCRATCH_MAX ((int)INT16_MAX + 1)
+#define DASH_SCRATCH_INITIAL 1024
+
+/* SPARSE_2D depth buckets hold 1 << DASH_DEPTH_BUCKET_SHIFT faces each. The slack lets the last
+ * bucket overflow in bounds, so the insert loop needs no capacity check. */
+#define DASH_DEPTH_BUCKET_SHIFT 9
+#define DASH_DEPTH_BUCKETS_SLACK DASH_SCRATCH_MAX
+
+/* Per-thread scratch: projection output and face-sort buffers for one model at a time. */
 struct DashGraphics
 {
+    struct DashRenderContext* context;
+    bool owns_context;
+
     struct DashAABB aabb;
     struct DashAABB cylinder_fast_aabb;
 
-    int screen_vertices_x[4096];
-    int screen_vertices_y[4096];
-    int screen_vertices_z[4096];
-    int orthographic_vertices_x[4096];
-    int orthographic_vertices_y[4096];
-    int orthographic_vertices_z[4096];
+    /* Views of the current projection: the scratch arrays below, or an arena record bound with
+     * dash3d_projection_bind. Every dash3d_project* call rebinds to scratch first. */
+    int* screen_vertices_x;
+    int* screen_vertices_y;
+    int* screen_vertices_z;
+    int* orthographic_vertices_x;
+    int* orthographic_vertices_y;
+    int* orthographic_vertices_z;
+    const struct DashProjectedModel* bound_projection;
+
+    /* Scratch storage, grown on demand by dash3d_scratch_reserve_*; contents do not survive a
+     * grow, which only happens before a projection or sort overwrites them anyway. */
+    int vertex_capacity;
+    int* scratch_screen_vertices_x;
+    int* scratch_screen_vertices_y;
+    int* scratch_screen_vertices_z;
+    int* scratch_orthographic_vertices_x;
+    int* scratch_orthographic_vertices_y;
+    int* scratch_orthographic_vertices_z;
+
+    /* Every per-face array below holds face_capacity entries (tmp_priority_faces: 12 buckets of
+     * face_capacity), so no bucket can overflow. */
+    int face_capacity;
+
+    /* VA sparse projection: screen verts at face f use slots f*3+{0,1,2}; sparse_a/b/c hold those
+     * indices (see dash3d_projected_face_index_ptrs). Allocated once at DASH_SCRATCH_MAX entries
+     * and never moved: queued tile-bin draws keep pointing into them until the bins flush. */
+    faceint_t* sparse_a;
+    faceint_t* sparse_b;
+    faceint_t* sparse_c;
 
 #if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_LINKED_LIST
     faceint_t bucket_heads[1500];
-    faceint_t face_links[4096];
-#elif DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_PREFIX_SUM
-    faceint_t tmp_depth_face_count[1500];
-    int tmp_depth_face_offsets[1500];
-    faceint_t tmp_dense_sorted_faces[4096];
-    int16_t tmp_face_depths[4096];
+    faceint_t* face_links;
 #else
     faceint_t tmp_depth_face_count[1500];
-    faceint_t tmp_depth_faces[1500 * 512];
+    int tmp_depth_face_offsets[1500];
+    faceint_t* tmp_dense_sorted_faces;
+    int16_t* tmp_face_depths;
+#  if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_SPARSE_2D
+    /* 1500 buckets of 1 << DASH_DEPTH_BUCKET_SHIFT plus slack; allocated by the first sort. */
+    faceint_t* tmp_depth_faces;
+#  endif
 #endif
     faceint_t tmp_priority_face_count[12];
     faceint_t tmp_priority_depth_sum[12];
-    faceint_t tmp_priority_faces[12 * 2000];
-    int tmp_flex_prio11_face_to_depth[1024];
-    int tmp_flex_prio12_face_to_depth[512];
-    // Used to be 1024, but now we need to support larger models.
-    int tmp_face_order[4096];
+    faceint_t* tmp_priority_faces;
+    int* tmp_flex_prio11_face_to_depth;
+    int* tmp_flex_prio12_face_to_depth;
+    int* tmp_face_order;
     int tmp_face_order_count;
+};
 
-    faceint_t sparse_a[4096];
-    faceint_t sparse_b[4096];
-    faceint_t sparse_c[4096];
+static inline void
+dash3d_projection_bind_scratch(struct DashGraphics* dash)
+{
+    dash->screen_vertices_x = dash->scratch_screen_vertices_x;
+    dash->screen_vertices_y = dash->scratch_screen_vertices_y;
+    dash->screen_vertices_z = dash->scratch_screen_vertices_z;
+    dash->orthographic_vertices_x = dash->scratch_orthographic_vertices_x;
+    dash->orthographic_vertices_y = dash->scratch_orthographic_vertices_y;
+    dash->orthographic_vertices_z = dash->scratch_orthographic_vertices_z;
+    dash->bound_projection = NULL;
+}
 
-    struct DashTextureMap texture_map;
-};
+static inline int
+dash3d_scratch_capacity_for(int needed)
+{
+    int capacity = DASH_SCRATCH_INITIAL;
+    while( capacity < needed )
+        capacity *= 2;
+    return capacity;
+}
+
+static bool
+dash3d_scratch_grow_vertices(
+    struct DashGraphics* dash,
+    int needed)
+{
+    if( needed > DASH_SCRATCH_MAX )
+        return false;
+
+    int capacity = dash3d_scratch_capacity_for(needed);
+    int* block = (int*)malloc((size_t)capacity * 6 * sizeof(int));
+    if( !block )
+        return false;
+
+    free(dash->scratch_screen_vertices_x);
+    dash->scratch_screen_vertices_x = block;
+    dash->scratch_screen_vertices_y = block + capacity;
+    dash->scratch_screen_vertices_z = block + capacity * 2;
+    dash->scratch_orthographic_vertices_x = block + capacity * 3;
+    dash->scratch_orthographic_vertices_y = block + capacity * 4;
+    dash->scratch_orthographic_vertices_z = block + capacity * 5;
+    dash->vertex_capacity = capacity;
+
+    if( !dash->bound_projection )
+        dash3d_projection_bind_scratch(dash);
+    return true;
+}
+
+static bool
+dash3d_scratch_grow_faces(
+    struct DashGraphics* dash,
+    int needed)
+{
+    if( needed > DASH_SCRATCH_MAX )
+        return false;
+
+    int capacity = dash3d_scratch_capacity_for(needed);
+    size_t const n = (size_t)capacity;
+    /* One block: int arrays first so everything stays naturally aligned. */
+    size_t bytes = n * 3 * sizeof(int) +       /* face order, flex 11, flex 12 */
+                   n * 12 * sizeof(faceint_t); /* priority buckets */
+#if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_LINKED_LIST
+    bytes += n * sizeof(faceint_t);
+#else
+    bytes += n * (sizeof(faceint_t) + sizeof(int16_t));
+#endif
+    uint8_t* block = (uint8_t*)malloc(bytes);
+    if( !block )
+        return false;
+
+    free(dash->tmp_face_order);
+    dash->tmp_face_order = (int*)block;
+    dash->tmp_flex_prio11_face_to_depth = dash->tmp_face_order + n;
+    dash->tmp_flex_prio12_face_to_depth = dash->tmp_face_order + n * 2;
+    faceint_t* faces = (faceint_t*)(dash->tmp_face_order + n * 3);
+    dash->tmp_priority_faces = faces;
+#if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_LINKED_LIST
+    dash->face_links = faces + n * 12;
+#else
+    dash->tmp_dense_sorted_faces = faces + n * 12;
+    dash->tmp_face_depths = (int16_t*)(faces + n * 13);
+#endif
+    dash->face_capacity = capacity;
+    dash->tmp_face_order_count = 0;
+    return true;
+}
+
+/* Fills sparse_a/b/c for every face the scratch can ever hold (face_capacity never exceeds
+ * DASH_SCRATCH_MAX), so growing the face scratch never moves them. */
+static bool
+dash3d_sparse_faces_init(struct DashGraphics* dash)
+{
+    faceint_t* block = (faceint_t*)malloc((size_t)DASH_SCRATCH_MAX * 3 * sizeof(faceint_t));
+    if( !block )
+        return false;
+    dash->sparse_a = block;
+    dash->sparse_b = block + DASH_SCRATCH_MAX;
+    dash->sparse_c = block + DASH_SCRATCH_MAX * 2;
+
+    /* Slots f*3+2 must stay addressable by faceint_t. */
+    for( int i = 0; i < DASH_SCRATCH_MAX; i++ )
+    {
+        int slot = i * 3 < DASH_SCRATCH_MAX - 2 ? i * 3 : DASH_SCRATCH_MAX - 3;
+        dash->sparse_a[i] = (faceint_t)(slot);
+        dash->sparse_b[i] = (faceint_t)(slot + 1);
+        dash->sparse_c[i] = (faceint_t)(slot + 2);
+    }
+    return true;
+}
+
+static inline bool
+dash3d_scratch_reserve_faces(
+    struct DashGraphics* dash,
+    int face_count)
+{
+    return face_count <= dash->face_capacity || dash3d_scratch_grow_faces(dash, face_count);
+}
+
+static int
+dash3d_projection_slot_count(struct DashModel* model)
+{
+    if( dashmodel__type(model) == DASHMODEL_TYPE_GROUND_VA )
+        return dashmodel_face_count(model) * 3;
+    return dashmodel_vertex_count(model);
+}
+
+/* Capacity for projecting model into the scratch and sorting its faces. VA models index slots
+ * f*3+k, so they are limited to DASH_SCRATCH_MAX / 3 faces. */
+static inline bool
+dash3d_scratch_reserve_model(
+    struct DashGraphics* dash,
+    struct DashModel* model)
+{
+    int slots = dash3d_projection_slot_count(model);
+    if( slots > dash->vertex_capacity && !dash3d_scratch_grow_vertices(dash, slots) )
+        return false;
+    return dash3d_scratch_reserve_faces(dash, dashmodel_face_count(model));
+}
 
-/** After sparse projection, screen verts for face f sit at f*3+{0,1,2}; dash_new fills sparse_*.
+/** After sparse projection, screen verts for face f sit at f*3+{0,1,2}; sparse_* are fixed for
+ * the lifetime of dash, so the pointers may be kept past a face scratch grow.
  *  Dense models use model face index arrays. Call once per operation, not inside face loops. */
 static inline void
 dash3d_projected_face_index_ptrs(
@@ -275,26 +466,63 @@ dash_init(void)
     init_reciprocal16();
 }
 
+struct DashRenderContext*
+dash_context_new(void)
+{
+    struct DashRenderContext* context =
+        (struct DashRenderContext*)malloc(sizeof(struct DashRenderContext));
+    if( context == NULL )
+        return NULL;
+    memset(context, 0, sizeof(struct DashRenderContext));
+
+    dashtexturemap_init(&context->texture_map);
+
+    return context;
+}
+
+void //
+dash_context_free(struct DashRenderContext* context)
+{
+    free(context);
+}
+
 struct DashGraphics*
-dash_new()
+dash_new_with_context(struct DashRenderContext* context)
 {
+    assert(context != NULL);
     struct DashGraphics* dash = (struct DashGraphics*)malloc(sizeof(struct DashGraphics));
     if( dash == NULL )
         return NULL;
     memset(dash, 0, sizeof(struct DashGraphics));
 
-    /* VA sparse projection: screen verts at face f use slots f*3+{0,1,2}; sparse_a/b/c hold those
-     * indices (see dash3d_projected_face_index_ptrs). face_count must stay <= 4096. */
-    for( int i = 0; i < 4096; i++ )
+    dash->context = context;
+    if( !dash3d_sparse_faces_init(dash) ||
+        !dash3d_scratch_grow_vertices(dash, DASH_SCRATCH_INITIAL) ||
+        !dash3d_scratch_grow_faces(dash, DASH_SCRATCH_INITIAL) )
     {
-        dash->sparse_a[i] = (faceint_t)(i * 3);
-        dash->sparse_b[i] = (faceint_t)(i * 3 + 1);
-        dash->sparse_c[i] = (faceint_t)(i * 3 + 2);
+        dash_free(dash);
+        return NULL;
     }
 
-    printf("Sizeof(struct DashGraphics): %zu\n", sizeof(struct DashGraphics));
+    return dash;
+}
+
+struct DashGraphics*
+dash_new()
+{
+    struct DashRenderContext* context = dash_context_new();
+    if( context == NULL )
+        return NULL;
+
+    struct DashGraphics* dash = dash_new_with_context(context);
+    if( dash == NULL )
+    {
+        dash_context_free(context);
+        return NULL;
+    }
+    dash->owns_context = true;
 
-    dashtexturemap_init(&dash->texture_map);
+    printf("Sizeof(struct DashGraphics): %zu\n", sizeof(struct DashGraphics));
 
     return dash;
 }
@@ -304,9 +532,23 @@ dash_free(struct DashGraphics* dash)
 {
     if( !dash )
         return;
+    if( dash->owns_context )
+        dash_context_free(dash->context);
+    free(dash->scratch_screen_vertices_x);
+    free(dash->tmp_face_order);
+    free(dash->sparse_a);
+#if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_SPARSE_2D
+    free(dash->tmp_depth_faces);
+#endif
     free(dash);
 }
 
+struct DashRenderContext*
+dash_context(struct DashGraphics* dash)
+{
+    return dash->context;
+}
+
 void
 dashtexturemap_init(struct DashTextureMap* map)
 {
@@ -605,10 +847,59 @@ dash3d_calculate_cylinder_aabb_8point(
 
 static const int g_empty_texture_texels[128 * 128] = { 0 };
 
+static bool
+texture_animates_v(const struct DashTexture* texture)
+{
+    return texture->animation_direction == TEXANIM_DIRECTION_V_DOWN ||
+           texture->animation_direction == TEXANIM_DIRECTION_V_UP;
+}
+
+static bool
+texture_animates_u(const struct DashTexture* texture)
+{
+    return texture->animation_direction == TEXANIM_DIRECTION_U_DOWN ||
+           texture->animation_direction == TEXANIM_DIRECTION_U_UP;
+}
+
+/* Texels the rasterizers sample for the texture's current animation phase. Every span reads
+ * texels[u + v * width] with u and v inside the texture, so a V phase is a window starting
+ * `phase` rows into the doubled storage. */
+static inline int*
+texture_sample_texels(const struct DashTexture* texture)
+{
+    if( !texture->animation_texels )
+        return texture->texels;
+    if( texture_animates_v(texture) )
+        return texture->animation_texels + texture->animation_phase * texture->width;
+    return texture->animation_texels;
+}
+
+/* Palette indices matching texture_sample_texels, or NULL to sample the int texels. */
+static inline const uint8_t*
+texture_sample_palette_indices(const struct DashTexture* texture)
+{
+    if( !texture->palette_indices )
+        return NULL;
+    if( texture->animation_texels && texture_animates_v(texture) )
+        return texture->palette_indices + texture->animation_phase * texture->width;
+    return texture->palette_indices;
+}
+
+/* Level 1 texels matching texture_sample_texels. A V phase moves half as many level 1 rows,
+ * rounded down. */
+static inline int*
+texture_sample_mip_texels(const struct DashTexture* texture)
+{
+    if( texture->animation_texels && texture_animates_v(texture) )
+        return texture->mip_texels + (texture->animation_phase >> 1) * (texture->width >> 1);
+    return texture->mip_texels;
+}
+
 enum DashModelRasterFlags
 {
     RASTER_FLAG_GOURAUD_SMOOTH = 1 << 0,
     RASTER_FLAG_TEXTURE_AFFINE = 1 << 1,
+    RASTER_FLAG_TEXTURE_MIPMAP = 1 << 2,
 };
 
 enum FaceType
@@ -657,6 +948,60 @@ struct DashModelRasterContext
     int flags;
 };
 
+/* True when the texture's P/M/N parallelogram projects to at most a quarter of its texel count,
+ * i.e. every pixel covers 2x2 or more level 0 texels. A P/M/N vertex in front of the near plane
+ * keeps level 0; the near clip path needs the full texture anyway. */
+static inline bool
+dash3d_face_texture_minified(
+    struct DashModelRasterContext* ctx,
+    const struct DashTexture* texture,
+    int tp_vertex,
+    int tm_vertex,
+    int tn_vertex)
+{
+    int tp_z = ctx->orthographic_vertex_z_nullable[tp_vertex];
+    int tm_z = ctx->orthographic_vertex_z_nullable[tm_vertex];
+    int tn_z = ctx->orthographic_vertex_z_nullable[tn_vertex];
+    if( tp_z < ctx->near_plane_z || tm_z < ctx->near_plane_z || tn_z < ctx->near_plane_z )
+        return false;
+
+    int64_t tp_x = SCALE_UNIT(ctx->orthographic_vertex_x_nullable[tp_vertex]) / tp_z;
+    int64_t tp_y = SCALE_UNIT(ctx->orthographic_vertex_y_nullable[tp_vertex]) / tp_z;
+    int64_t tm_x = SCALE_UNIT(ctx->orthographic_vertex_x_nullable[tm_vertex]) / tm_z;
+    int64_t tm_y = SCALE_UNIT(ctx->orthographic_vertex_y_nullable[tm_vertex]) / tm_z;
+    int64_t tn_x = SCALE_UNIT(ctx->orthographic_vertex_x_nullable[tn_vertex]) / tn_z;
+    int64_t tn_y = SCALE_UNIT(ctx->orthographic_vertex_y_nullable[tn_vertex]) / tn_z;
+
+    int64_t area = (tm_x - tp_x) * (tn_y - tp_y) - (tm_y - tp_y) * (tn_x - tp_x);
+    if( area < 0 )
+        area = -area;
+    return area * 4 <= (int64_t)texture->width * texture->height;
+}
+
+/* Swaps the sampled texels for the texture's level 1 when the face is minified. The palette
+ * indices describe level 0 only, so the level 1 path samples the int texels. */
+static inline void
+dash3d_face_texture_select_level(
+    struct DashModelRasterContext* ctx,
+    const struct DashTexture* texture,
+    int tp_vertex,
+    int tm_vertex,
+    int tn_vertex,
+    int** texels,
+    const uint8_t** texel_indices,
+    int* texture_size)
+{
+    if( g_raster_bench.active || (ctx->flags & RASTER_FLAG_TEXTURE_MIPMAP) == 0 ||
+        !texture->mip_texels )
+        return;
+    if( !dash3d_face_texture_minified(ctx, texture, tp_vertex, tm_vertex, tn_vertex) )
+        return;
+
+    *texels = texture_sample_mip_texels(texture);
+    *texel_indices = NULL;
+    *texture_size = texture->width >> 1;
+}
+
 static inline void
 dash3d_raster_model_face(
     int face,
@@ -722,6 +1067,8 @@ dash3d_raster_model_face(
     // }
 
     int* texels = g_empty_texture_texels;
+    const uint8_t* texel_indices = NULL;
+    const int* palette = NULL;
     int texture_size = 0;
     int texture_opaque = true;
     int tex_id_row = -1;
@@ -735,7 +1082,9 @@ dash3d_raster_model_face(
         texture = dashtexturemap_get(ctx->texture_map, texture_id);
         assert(texture != NULL);
 
-        texels = texture->texels;
+        texels = texture_sample_texels(texture);
+        texel_indices = texture_sample_palette_indices(texture);
+        palette = texture->palette;
         texture_size = texture->width;
         texture_opaque = texture->opaque;
 
@@ -877,6 +1226,16 @@ dash3d_raster_model_face(
             assert(tm_vertex < ctx->num_vertices);
             assert(tn_vertex < ctx->num_vertices);
 
+            dash3d_face_texture_select_level(
+                ctx,
+                texture,
+                tp_vertex,
+                tm_vertex,
+                tn_vertex,
+                &texels,
+                &texel_indices,
+                &texture_size);
+
             if( !g_raster_bench.active && (ctx->flags & RASTER_FLAG_TEXTURE_AFFINE) != 0 )
             {
                 raster_face_texture_blend_affine_v3(
@@ -974,6 +1333,16 @@ dash3d_raster_model_face(
             assert(tm_vertex < ctx->num_vertices);
             assert(tn_vertex < ctx->num_vertices);
 
+            dash3d_face_texture_select_level(
+                ctx,
+                texture,
+                tp_vertex,
+                tm_vertex,
+                tn_vertex,
+                &texels,
+                &texel_indices,
+                &texture_size);
+
             if( !g_raster_bench.active && (ctx->flags & RASTER_FLAG_TEXTURE_AFFINE) != 0 )
             {
                 raster_face_texture_flat_affine_v3(
@@ -1026,6 +1395,8 @@ dash3d_raster_model_face(
                     ctx->orthographic_vertex_z_nullable,
                     ctx->colors_a,
                     texels,
+                    texel_indices,
+                    palette,
                     texture_size,
                     texture_opaque,
                     ctx->near_plane_z,
@@ -1133,6 +1504,7 @@ static inline void
 parition_faces_by_priority(
     faceint_t* face_priority_buckets,
     faceint_t* face_priority_bucket_counts,
+    int priority_stride,
     faceint_t* bucket_heads,
     faceint_t* face_links,
     int num_faces,
@@ -1155,7 +1527,7 @@ parition_faces_by_priority(
         {
             int prio = dashmodel__get_face_priority(face_priorities, (int)face_idx);
             int priority_face_count = face_priority_bucket_counts[prio]++;
-            face_priority_buckets[prio * 2000 + priority_face_count] = face_idx;
+            face_priority_buckets[prio * priority_stride + priority_face_count] = face_idx;
         }
     }
 }
@@ -1186,6 +1558,7 @@ sort_face_draw_order(
     faceint_t* face_links,
     faceint_t* face_priority_buckets,
     faceint_t* face_priority_bucket_counts,
+    int priority_stride,
     int num_faces,
     const uint8_t* face_priorities,
     int depth_lower_bound,
@@ -1255,7 +1628,7 @@ sort_face_draw_order(
     {
         for( int i = 0; i < counts[prio]; i++ )
         {
-            face_draw_order[order_index++] = face_priority_buckets[prio * 2000 + i];
+            face_draw_order[order_index++] = face_priority_buckets[prio * priority_stride + i];
         }
     }
 
@@ -1272,7 +1645,7 @@ sort_face_draw_order(
     {
         for( int i = 0; i < counts[prio]; i++ )
         {
-            face_draw_order[order_index++] = face_priority_buckets[prio * 2000 + i];
+            face_draw_order[order_index++] = face_priority_buckets[prio * priority_stride + i];
         }
     }
 
@@ -1289,7 +1662,7 @@ sort_face_draw_order(
     {
         for( int i = 0; i < counts[prio]; i++ )
         {
-            face_draw_order[order_index++] = face_priority_buckets[prio * 2000 + i];
+            face_draw_order[order_index++] = face_priority_buckets[prio * priority_stride + i];
         }
     }
 
@@ -1315,10 +1688,11 @@ div3_fast_fixedpoint(int z_sum)
     return (z_sum * 21845) >> 16;
 }
 
-#if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_PREFIX_SUM
+/* Prefix-sum (dense) variant. Always built outside LINKED_LIST: SPARSE_2D falls back to it when a
+ * model puts more faces on one depth than a 2D bucket holds. */
 
 static inline int
-bucket_sort_by_average_depth(
+bucket_sort_by_average_depth_dense(
     faceint_t* restrict dense_sorted_faces,
     faceint_t* restrict face_depth_bucket_counts,
     int* restrict face_depth_bucket_offsets,
@@ -1394,9 +1768,10 @@ bucket_sort_by_average_depth(
 }
 
 static inline void
-parition_faces_by_priority(
+parition_faces_by_priority_dense(
     faceint_t* face_priority_buckets,
     faceint_t* face_priority_bucket_counts,
+    int priority_stride,
     faceint_t* dense_sorted_faces,
     faceint_t* face_depth_bucket_counts,
     int* face_depth_bucket_offsets,
@@ -1421,7 +1796,7 @@ parition_faces_by_priority(
             faceint_t face_idx = faces[i];
             int prio = dashmodel__get_face_priority(face_priorities, (int)face_idx);
             int priority_face_count = face_priority_bucket_counts[prio]++;
-            face_priority_buckets[prio * 2000 + priority_face_count] = face_idx;
+            face_priority_buckets[prio * priority_stride + priority_face_count] = face_idx;
         }
     }
 }
@@ -1430,7 +1805,7 @@ parition_faces_by_priority(
  * Same as linked-list variant; prefix-sum mode uses tmp_dense_sorted_faces and offsets.
  */
 static inline int
-sort_face_draw_order(
+sort_face_draw_order_dense(
     faceint_t* priority_depths,
     int* flex_prio11_face_to_depth,
     int* flex_prio12_face_to_depth,
@@ -1440,6 +1815,7 @@ sort_face_draw_order(
     int* face_depth_bucket_offsets,
     faceint_t* face_priority_buckets,
     faceint_t* face_priority_bucket_counts,
+    int priority_stride,
     int num_faces,
     const uint8_t* face_priorities,
     int depth_lower_bound,
@@ -1511,7 +1887,7 @@ sort_face_draw_order(
     {
         for( int i = 0; i < counts[prio]; i++ )
         {
-            face_draw_order[order_index++] = face_priority_buckets[prio * 2000 + i];
+            face_draw_order[order_index++] = face_priority_buckets[prio * priority_stride + i];
         }
     }
 
@@ -1526,7 +1902,7 @@ sort_face_draw_order(
     {
         for( int i = 0; i < counts[prio]; i++ )
         {
-            face_draw_order[order_index++] = face_priority_buckets[prio * 2000 + i];
+            face_draw_order[order_index++] = face_priority_buckets[prio * priority_stride + i];
         }
     }
 
@@ -1541,7 +1917,7 @@ sort_face_draw_order(
     {
         for( int i = 0; i < counts[prio]; i++ )
         {
-            face_draw_order[order_index++] = face_priority_buckets[prio * 2000 + i];
+            face_draw_order[order_index++] = face_priority_buckets[prio * priority_stride + i];
         }
     }
 
@@ -1554,7 +1930,7 @@ sort_face_draw_order(
     return order_index;
 }
 
-#else /* DASH_BUCKET_SORT_MODE_SPARSE_2D */
+#if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_SPARSE_2D
 
 static inline int
 bucket_sort_by_average_depth(
@@ -1599,9 +1975,10 @@ bucket_sort_by_average_depth(
                 const int count = face_depth_bucket_counts[depth_avg];
                 face_depth_bucket_counts[depth_avg] = count + 1;
 
-                // (depth << 9) is a 512-entry stride.
+                // (depth << DASH_DEPTH_BUCKET_SHIFT) is a 512-entry stride.
                 // Ensure face_depth_buckets is aligned to cache lines.
-                face_depth_buckets[(depth_avg << 9) + count] = (faceint_t)f;
+                // A full bucket spills into the next one (see DASH_DEPTH_BUCKETS_SLACK).
+                face_depth_buckets[(depth_avg << DASH_DEPTH_BUCKET_SHIFT) + count] = (faceint_t)f;
 
                 // Branchless min/max (optional, depends on architecture)
                 if( depth_avg < min_d )
@@ -1615,6 +1992,17 @@ bucket_sort_by_average_depth(
     // Handle case where no faces were added
     if( min_d > max_d )
         return 0;
+
+    /* Only a model with more faces than a bucket holds can spill; the caller re-sorts it with the
+     * dense variant. */
+    if( num_faces > (1 << DASH_DEPTH_BUCKET_SHIFT) )
+    {
+        for( int d = min_d; d <= max_d; d++ )
+        {
+            if( face_depth_bucket_counts[d] > (1 << DASH_DEPTH_BUCKET_SHIFT) )
+                return -1;
+        }
+    }
     return (min_d) | (max_d << 16);
 }
 
@@ -1622,6 +2010,7 @@ static inline void
 parition_faces_by_priority(
     faceint_t* face_priority_buckets,
     faceint_t* face_priority_bucket_counts,
+    int priority_stride,
     faceint_t* face_depth_buckets,
     faceint_t* face_depth_bucket_counts,
     int num_faces,
@@ -1638,13 +2027,13 @@ parition_faces_by_priority(
         if( face_count == 0 )
             continue;
 
-        faceint_t* faces = &face_depth_buckets[depth << 9];
+        faceint_t* faces = &face_depth_buckets[depth << DASH_DEPTH_BUCKET_SHIFT];
         for( int i = 0; i < face_count; i++ )
         {
             faceint_t face_idx = faces[i];
             int prio = dashmodel__get_face_priority(face_priorities, (int)face_idx);
             int priority_face_count = face_priority_bucket_counts[prio]++;
-            face_priority_buckets[prio * 2000 + priority_face_count] = face_idx;
+            face_priority_buckets[prio * priority_stride + priority_face_count] = face_idx;
         }
     }
 }
@@ -1662,6 +2051,7 @@ sort_face_draw_order(
     faceint_t* face_depth_bucket_counts,
     faceint_t* face_priority_buckets,
     faceint_t* face_priority_bucket_counts,
+    int priority_stride,
     int num_faces,
     const uint8_t* face_priorities,
     int depth_lower_bound,
@@ -1674,7 +2064,7 @@ sort_face_draw_order(
         if( n == 0 )
             continue;
 
-        faceint_t* faces = &face_depth_buckets[depth << 9];
+        faceint_t* faces = &face_depth_buckets[depth << DASH_DEPTH_BUCKET_SHIFT];
         for( int i = 0; i < n; i++ )
         {
             faceint_t face_idx = faces[i];
@@ -1732,7 +2122,7 @@ sort_face_draw_order(
     {
         for( int i = 0; i < counts[prio]; i++ )
         {
-            face_draw_order[order_index++] = face_priority_buckets[prio * 2000 + i];
+            face_draw_order[order_index++] = face_priority_buckets[prio * priority_stride + i];
         }
     }
 
@@ -1747,7 +2137,7 @@ sort_face_draw_order(
     {
         for( int i = 0; i < counts[prio]; i++ )
         {
-            face_draw_order[order_index++] = face_priority_buckets[prio * 2000 + i];
+            face_draw_order[order_index++] = face_priority_buckets[prio * priority_stride + i];
         }
     }
 
@@ -1762,7 +2152,7 @@ sort_face_draw_order(
     {
         for( int i = 0; i < counts[prio]; i++ )
         {
-            face_draw_order[order_index++] = face_priority_buckets[prio * 2000 + i];
+            face_draw_order[order_index++] = face_priority_buckets[prio * priority_stride + i];
         }
     }
 
@@ -1775,7 +2165,7 @@ sort_face_draw_order(
     return order_index;
 }
 
-#endif /* SPARSE_2D vs PREFIX_SUM */
+#endif /* SPARSE_2D */
 
 #endif /* LINKED_LIST vs rest */
 
@@ -1792,6 +2182,13 @@ dash3d_sort_face_draw_order(
     faceint_t* fib,
     faceint_t* fic)
 {
+    int face_count = dashmodel_face_count(model);
+    if( !dash3d_scratch_reserve_faces(dash, face_count) )
+    {
+        dash->tmp_face_order_count = 0;
+        return;
+    }
+
     int model_min_depth = dashmodel_bounds_cylinder_const(model)->min_z_depth_any_rotation;
 #if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_LINKED_LIST
     memset(dash->bucket_heads, 0xFF, sizeof(dash->bucket_heads));
@@ -1800,26 +2197,7 @@ dash3d_sort_face_draw_order(
         dash->bucket_heads,
         dash->face_links,
         model_min_depth,
-        dashmodel_face_count(model),
-        dash->screen_vertices_x,
-        dash->screen_vertices_y,
-        dash->screen_vertices_z,
-        fia,
-        fib,
-        fic);
-#elif DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_PREFIX_SUM
-    memset(
-        dash->tmp_depth_face_count,
-        0,
-        (size_t)(model_min_depth * 2 + 1) * sizeof(dash->tmp_depth_face_count[0]));
-
-    int bounds = bucket_sort_by_average_depth(
-        dash->tmp_dense_sorted_faces,
-        dash->tmp_depth_face_count,
-        dash->tmp_depth_face_offsets,
-        dash->tmp_face_depths,
-        model_min_depth,
-        dashmodel_face_count(model),
+        face_count,
         dash->screen_vertices_x,
         dash->screen_vertices_y,
         dash->screen_vertices_z,
@@ -1827,22 +2205,74 @@ dash3d_sort_face_draw_order(
         fib,
         fic);
 #else
+    /* Buckets span [0, 2 * min depth]; faces deeper than the table are dropped anyway. */
+    int depth_span = model_min_depth * 2 + 1;
+    if( depth_span > 1500 )
+        depth_span = 1500;
     memset(
         dash->tmp_depth_face_count,
         0,
-        (size_t)(model_min_depth * 2 + 1) * sizeof(dash->tmp_depth_face_count[0]));
+        (size_t)depth_span * sizeof(dash->tmp_depth_face_count[0]));
 
-    int bounds = bucket_sort_by_average_depth(
-        dash->tmp_depth_faces,
-        dash->tmp_depth_face_count,
-        model_min_depth,
-        dashmodel_face_count(model),
-        dash->screen_vertices_x,
-        dash->screen_vertices_y,
-        dash->screen_vertices_z,
-        fia,
-        fib,
-        fic);
+#  if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_SPARSE_2D
+    /* The 2D buckets are only allocated by the first sort that uses them. */
+    bool dense = false;
+    if( !dash->tmp_depth_faces )
+    {
+        dash->tmp_depth_faces = (faceint_t*)malloc(
+            (size_t)((1500 << DASH_DEPTH_BUCKET_SHIFT) + DASH_DEPTH_BUCKETS_SLACK) *
+            sizeof(dash->tmp_depth_faces[0]));
+        if( !dash->tmp_depth_faces )
+            dense = true;
+    }
+
+    int bounds = -1;
+    if( !dense )
+    {
+        bounds = bucket_sort_by_average_depth(
+            dash->tmp_depth_faces,
+            dash->tmp_depth_face_count,
+            model_min_depth,
+            face_count,
+            dash->screen_vertices_x,
+            dash->screen_vertices_y,
+            dash->screen_vertices_z,
+            fia,
+            fib,
+            fic);
+    }
+
+    /* More faces landed on one depth than a bucket holds; the dense sort visits faces in the same
+     * order, so the result is identical. */
+    if( bounds < 0 )
+    {
+        dense = true;
+        memset(
+            dash->tmp_depth_face_count,
+            0,
+            (size_t)depth_span * sizeof(dash->tmp_depth_face_count[0]));
+    }
+#  else
+    bool const dense = true;
+    int bounds;
+#  endif
+
+    if( dense )
+    {
+        bounds = bucket_sort_by_average_depth_dense(
+            dash->tmp_dense_sorted_faces,
+            dash->tmp_depth_face_count,
+            dash->tmp_depth_face_offsets,
+            dash->tmp_face_depths,
+            model_min_depth,
+            face_count,
+            dash->screen_vertices_x,
+            dash->screen_vertices_y,
+            dash->screen_vertices_z,
+            fia,
+            fib,
+            fic);
+    }
 #endif
 
     model_min_depth = bounds & 0xFFFF;
@@ -1851,6 +2281,8 @@ dash3d_sort_face_draw_order(
     if( !dashmodel_face_priorities(model) )
     {
         int order_index = 0;
+        /* Local: face_order is heap scratch and stores through it would force reloads. */
+        int* restrict face_order = dash->tmp_face_order;
         if( model_max_depth >= 1500 )
             model_max_depth = 1499;
         for( int depth = model_max_depth; depth >= model_min_depth; depth-- )
@@ -1859,30 +2291,24 @@ dash3d_sort_face_draw_order(
             for( faceint_t face_idx = dash->bucket_heads[depth]; face_idx != (faceint_t)-1;
                  face_idx = dash->face_links[face_idx] )
             {
-                dash->tmp_face_order[order_index++] = face_idx;
-            }
-#elif DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_PREFIX_SUM
-            {
-                int bucket_count = (int)dash->tmp_depth_face_count[depth];
-                if( bucket_count == 0 )
-                    continue;
-
-                int end = dash->tmp_depth_face_offsets[depth];
-                faceint_t* faces = &dash->tmp_dense_sorted_faces[end - bucket_count];
-                for( int j = 0; j < bucket_count; j++ )
-                {
-                    dash->tmp_face_order[order_index++] = faces[j];
-                }
+                face_order[order_index++] = face_idx;
             }
 #else
             int bucket_count = (int)dash->tmp_depth_face_count[depth];
             if( bucket_count == 0 )
                 continue;
 
-            faceint_t* faces = &dash->tmp_depth_faces[depth << 9];
+            faceint_t* faces;
+            if( dense )
+                faces = &dash->tmp_dense_sorted_faces[dash->tmp_depth_face_offsets[depth] -
+                                                      bucket_count];
+#  if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_SPARSE_2D
+            else
+                faces = &dash->tmp_depth_faces[depth << DASH_DEPTH_BUCKET_SHIFT];
+#  endif
             for( int j = 0; j < bucket_count; j++ )
             {
-                dash->tmp_face_order[order_index++] = faces[j];
+                face_order[order_index++] = faces[j];
             }
 #endif
         }
@@ -1898,9 +2324,10 @@ dash3d_sort_face_draw_order(
         parition_faces_by_priority(
             dash->tmp_priority_faces,
             dash->tmp_priority_face_count,
+            dash->face_capacity,
             dash->bucket_heads,
             dash->face_links,
-            dashmodel_face_count(model),
+            face_count,
             dashmodel_face_priorities(model),
             model_min_depth,
             model_max_depth);
@@ -1914,60 +2341,73 @@ dash3d_sort_face_draw_order(
             dash->face_links,
             dash->tmp_priority_faces,
             dash->tmp_priority_face_count,
-            dashmodel_face_count(model),
-            dashmodel_face_priorities(model),
-            model_min_depth,
-            model_max_depth);
-#elif DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_PREFIX_SUM
-        parition_faces_by_priority(
-            dash->tmp_priority_faces,
-            dash->tmp_priority_face_count,
-            dash->tmp_dense_sorted_faces,
-            dash->tmp_depth_face_count,
-            dash->tmp_depth_face_offsets,
-            dashmodel_face_count(model),
-            dashmodel_face_priorities(model),
-            model_min_depth,
-            model_max_depth);
-
-        int valid_faces = sort_face_draw_order(
-            dash->tmp_priority_depth_sum,
-            dash->tmp_flex_prio11_face_to_depth,
-            dash->tmp_flex_prio12_face_to_depth,
-            dash->tmp_face_order,
-            dash->tmp_dense_sorted_faces,
-            dash->tmp_depth_face_count,
-            dash->tmp_depth_face_offsets,
-            dash->tmp_priority_faces,
-            dash->tmp_priority_face_count,
-            dashmodel_face_count(model),
+            dash->face_capacity,
+            face_count,
             dashmodel_face_priorities(model),
             model_min_depth,
             model_max_depth);
 #else
-        parition_faces_by_priority(
-            dash->tmp_priority_faces,
-            dash->tmp_priority_face_count,
-            dash->tmp_depth_faces,
-            dash->tmp_depth_face_count,
-            dashmodel_face_count(model),
-            dashmodel_face_priorities(model),
-            model_min_depth,
-            model_max_depth);
-
-        int valid_faces = sort_face_draw_order(
-            dash->tmp_priority_depth_sum,
-            dash->tmp_flex_prio11_face_to_depth,
-            dash->tmp_flex_prio12_face_to_depth,
-            dash->tmp_face_order,
-            dash->tmp_depth_faces,
-            dash->tmp_depth_face_count,
-            dash->tmp_priority_faces,
-            dash->tmp_priority_face_count,
-            dashmodel_face_count(model),
-            dashmodel_face_priorities(model),
-            model_min_depth,
-            model_max_depth);
+        int valid_faces;
+        if( dense )
+        {
+            parition_faces_by_priority_dense(
+                dash->tmp_priority_faces,
+                dash->tmp_priority_face_count,
+                dash->face_capacity,
+                dash->tmp_dense_sorted_faces,
+                dash->tmp_depth_face_count,
+                dash->tmp_depth_face_offsets,
+                face_count,
+                dashmodel_face_priorities(model),
+                model_min_depth,
+                model_max_depth);
+
+            valid_faces = sort_face_draw_order_dense(
+                dash->tmp_priority_depth_sum,
+                dash->tmp_flex_prio11_face_to_depth,
+                dash->tmp_flex_prio12_face_to_depth,
+                dash->tmp_face_order,
+                dash->tmp_dense_sorted_faces,
+                dash->tmp_depth_face_count,
+                dash->tmp_depth_face_offsets,
+                dash->tmp_priority_faces,
+                dash->tmp_priority_face_count,
+                dash->face_capacity,
+                face_count,
+                dashmodel_face_priorities(model),
+                model_min_depth,
+                model_max_depth);
+        }
+#  if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_SPARSE_2D
+        else
+        {
+            parition_faces_by_priority(
+                dash->tmp_priority_faces,
+                dash->tmp_priority_face_count,
+                dash->face_capacity,
+                dash->tmp_depth_faces,
+                dash->tmp_depth_face_count,
+                face_count,
+                dashmodel_face_priorities(model),
+                model_min_depth,
+                model_max_depth);
+
+            valid_faces = sort_face_draw_order(
+                dash->tmp_priority_depth_sum,
+                dash->tmp_flex_prio11_face_to_depth,
+                dash->tmp_flex_prio12_face_to_depth,
+                dash->tmp_face_order,
+                dash->tmp_depth_faces,
+                dash->tmp_depth_face_count,
+                dash->tmp_priority_faces,
+                dash->tmp_priority_face_count,
+                dash->face_capacity,
+                face_count,
+                dashmodel_face_priorities(model),
+                model_min_depth,
+                model_max_depth);
+        }
+#  endif
 #endif
 
         dash->tmp_face_order_count = valid_faces;
@@ -2024,6 +2464,9 @@ dash3d_raster_with_face_indices(
     {
         flags |= RASTER_FLAG_TEXTURE_AFFINE;
     }
+#if DASH_TEXTURE_MIPMAP
+    flags |= RASTER_FLAG_TEXTURE_MIPMAP;
+#endif
 
     struct DashModelRasterContext ctx = {
         .pixel_buffer = pixel_buffer,
@@ -2057,7 +2500,7 @@ dash3d_raster_with_face_indices(
         .screen_height = view_port->height,
         .stride = view_port->stride,
         .camera_fov = camera->fov_rpi2048,
-        .texture_map = &dash->texture_map,
+        .texture_map = &dash->context->texture_map,
         .flags = flags,
     };
 
@@ -2079,6 +2522,8 @@ dash3d_raster(
 {
     if( dashmodel__is_ground_va(model) )
     {
+        if( !dash3d_scratch_reserve_faces(dash, dashmodel_face_count(model)) )
+            return;
         dash3d_raster_with_face_indices(
             dash,
             model,
@@ -2115,189 +2560,25 @@ dash3d_compute_projected_face_order(
     faceint_t* fic = NULL;
     dash3d_projected_face_index_ptrs(dash, model, &fia, &fib, &fic);
 
-    int model_min_depth = dashmodel_bounds_cylinder_const(model)->min_z_depth_any_rotation;
-#if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_LINKED_LIST
-    memset(dash->bucket_heads, 0xFF, sizeof(dash->bucket_heads));
-
-    int bounds = bucket_sort_by_average_depth(
-        dash->bucket_heads,
-        dash->face_links,
-        model_min_depth,
-        dashmodel_face_count(model),
-        dash->screen_vertices_x,
-        dash->screen_vertices_y,
-        dash->screen_vertices_z,
-        fia,
-        fib,
-        fic);
-#elif DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_PREFIX_SUM
-    memset(
-        dash->tmp_depth_face_count,
-        0,
-        (size_t)(model_min_depth * 2 + 1) * sizeof(dash->tmp_depth_face_count[0]));
-
-    int bounds = bucket_sort_by_average_depth(
-        dash->tmp_dense_sorted_faces,
-        dash->tmp_depth_face_count,
-        dash->tmp_depth_face_offsets,
-        dash->tmp_face_depths,
-        model_min_depth,
-        dashmodel_face_count(model),
-        dash->screen_vertices_x,
-        dash->screen_vertices_y,
-        dash->screen_vertices_z,
-        fia,
-        fib,
-        fic);
-#else
-    memset(
-        dash->tmp_depth_face_count,
-        0,
-        (size_t)(model_min_depth * 2 + 1) * sizeof(dash->tmp_depth_face_count[0]));
-
-    int bounds = bucket_sort_by_average_depth(
-        dash->tmp_depth_faces,
-        dash->tmp_depth_face_count,
-        model_min_depth,
-        dashmodel_face_count(model),
-        dash->screen_vertices_x,
-        dash->screen_vertices_y,
-        dash->screen_vertices_z,
-        fia,
-        fib,
-        fic);
-#endif
-
-    model_min_depth = bounds & 0xFFFF;
-    int model_max_depth = bounds >> 16;
-
-    if( !dashmodel_face_priorities(model) )
-    {
-        int order_index = 0;
-        for( int depth = model_max_depth; depth < 1500 && depth >= model_min_depth; depth-- )
-        {
-#if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_LINKED_LIST
-            for( faceint_t face_idx = dash->bucket_heads[depth]; face_idx != (faceint_t)-1;
-                 face_idx = dash->face_links[face_idx] )
-            {
-                dash->tmp_face_order[order_index++] = face_idx;
-            }
-#elif DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_PREFIX_SUM
-            {
-                int bucket_count = (int)dash->tmp_depth_face_count[depth];
-                if( bucket_count == 0 )
-                    continue;
-
-                int end = dash->tmp_depth_face_offsets[depth];
-                faceint_t* faces = &dash->tmp_dense_sorted_faces[end - bucket_count];
-                for( int j = 0; j < bucket_count; j++ )
-                {
-                    dash->tmp_face_order[order_index++] = faces[j];
-                }
-            }
-#else
-            int bucket_count = (int)dash->tmp_depth_face_count[depth];
-            if( bucket_count == 0 )
-                continue;
-
-            faceint_t* faces = &dash->tmp_depth_faces[depth << 9];
-            for( int j = 0; j < bucket_count; j++ )
-            {
-                dash->tmp_face_order[order_index++] = faces[j];
-            }
-#endif
-        }
-        dash->tmp_face_order_count = order_index;
-        return;
-    }
-
-    memset(dash->tmp_priority_depth_sum, 0, sizeof(dash->tmp_priority_depth_sum));
-    memset(dash->tmp_priority_face_count, 0, sizeof(dash->tmp_priority_face_count));
-
-#if DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_LINKED_LIST
-    parition_faces_by_priority(
-        dash->tmp_priority_faces,
-        dash->tmp_priority_face_count,
-        dash->bucket_heads,
-        dash->face_links,
-        dashmodel_face_count(model),
-        dashmodel_face_priorities(model),
-        model_min_depth,
-        model_max_depth);
-
-    dash->tmp_face_order_count = sort_face_draw_order(
-        dash->tmp_priority_depth_sum,
-        dash->tmp_flex_prio11_face_to_depth,
-        dash->tmp_flex_prio12_face_to_depth,
-        dash->tmp_face_order,
-        dash->bucket_heads,
-        dash->face_links,
-        dash->tmp_priority_faces,
-        dash->tmp_priority_face_count,
-        dashmodel_face_count(model),
-        dashmodel_face_priorities(model),
-        model_min_depth,
-        model_max_depth);
-#elif DASH_BUCKET_SORT_MODE == DASH_BUCKET_SORT_MODE_PREFIX_SUM
-    parition_faces_by_priority(
-        dash->tmp_priority_faces,
-        dash->tmp_priority_face_count,
-        dash->tmp_dense_sorted_faces,
-        dash->tmp_depth_face_count,
-        dash->tmp_depth_face_offsets,
-        dashmodel_face_count(model),
-        dashmodel_face_priorities(model),
-        model_min_depth,
-        model_max_depth);
-
-    dash->tmp_face_order_count = sort_face_draw_order(
-        dash->tmp_priority_depth_sum,
-        dash->tmp_flex_prio11_face_to_depth,
-        dash->tmp_flex_prio12_face_to_depth,
-        dash->tmp_face_order,
-        dash->tmp_dense_sorted_faces,
-        dash->tmp_depth_face_count,
-        dash->tmp_depth_face_offsets,
-        dash->tmp_priority_faces,
-        dash->tmp_priority_face_count,
-        dashmodel_face_count(model),
-        dashmodel_face_priorities(model),
-        model_min_depth,
-        model_max_depth);
-#else
-    parition_faces_by_priority(
-        dash->tmp_priority_faces,
-        dash->tmp_priority_face_count,
-        dash->tmp_depth_faces,
-        dash->tmp_depth_face_count,
-        dashmodel_face_count(model),
-        dashmodel_face_priorities(model),
-        model_min_depth,
-        model_max_depth);
-
-    dash->tmp_face_order_count = sort_face_draw_order(
-        dash->tmp_priority_depth_sum,
-        dash->tmp_flex_prio11_face_to_depth,
-        dash->tmp_flex_prio12_face_to_depth,
-        dash->tmp_face_order,
-        dash->tmp_depth_faces,
-        dash->tmp_depth_face_count,
-        dash->tmp_priority_faces,
-        dash->tmp_priority_face_count,
-        dashmodel_face_count(model),
-        dashmodel_face_priorities(model),
-        model_min_depth,
-        model_max_depth);
-#endif
-}
+    dash3d_sort_face_draw_order(dash, model, NULL, NULL, NULL, false, fia, fib, fic);
+}
 
 static inline int
-dash3d_project(
-    struct DashGraphics* dash,
+dash3d_project_to(
+    struct DashAABB* fast_aabb,
+    struct DashAABB* aabb,
+    int* screen_vertices_x,
+    int* screen_vertices_y,
+    int* screen_vertices_z,
+    int* orthographic_vertices_x,
+    int* orthographic_vertices_y,
+    int* orthographic_vertices_z,
     struct DashModel* model,
     struct DashPosition* position,
     struct DashViewPort* view_port,
-    struct DashCamera* camera)
+    struct DashCamera* camera,
+    const struct DashCoverage* coverage,
+    int* out_center_z)
 {
     struct ProjectedVertex center_projection;
     int cull = DASHCULL_VISIBLE;
@@ -2305,36 +2586,45 @@ dash3d_project(
     if( model == NULL || dashmodel_vertex_count(model) == 0 || dashmodel_face_count(model) == 0 )
         return DASHCULL_ERROR;
 
-    cull = dash3d_fast_cull(
-        &dash->cylinder_fast_aabb, view_port, model, position, camera, &center_projection);
+    cull = dash3d_fast_cull(fast_aabb, view_port, model, position, camera, &center_projection);
     if( cull != DASHCULL_VISIBLE )
     {
         return cull;
     }
 
-    dash3d_calculate_cylinder_aabb_8point(&dash->aabb, model, position, view_port, camera);
+    dash3d_calculate_cylinder_aabb_8point(aabb, model, position, view_port, camera);
 
-    cull = dash3d_aabb_cull(&dash->aabb, view_port, camera);
+    cull = dash3d_aabb_cull(aabb, view_port, camera);
     if( cull != DASHCULL_VISIBLE )
     {
         return cull;
     }
 
+    *out_center_z = center_projection.z;
+
+    if( coverage )
+    {
+        int min_depth = center_projection.z -
+                        dashmodel_bounds_cylinder_const(model)->min_z_depth_any_rotation;
+        if( dash_coverage_hidden(coverage, aabb, min_depth) )
+            return DASHCULL_CULLED_OCCLUDED;
+    }
+
     switch( dashmodel__type(model) )
     {
     case DASHMODEL_TYPE_GROUND_VA:
     {
         int nf = dashmodel_face_count(model);
-        assert(nf <= 4096);
+        assert(nf * 3 <= DASH_SCRATCH_MAX);
         if( dashmodel_has_textures(model) )
         {
             project_vertices_array_sparse_fused(
-                dash->orthographic_vertices_x,
-                dash->orthographic_vertices_y,
-                dash->orthographic_vertices_z,
-                dash->screen_vertices_x,
-                dash->screen_vertices_y,
-                dash->screen_vertices_z,
+                orthographic_vertices_x,
+                orthographic_vertices_y,
+                orthographic_vertices_z,
+                screen_vertices_x,
+                screen_vertices_y,
+                screen_vertices_z,
                 dashmodel_vertices_x(model),
                 dashmodel_vertices_y(model),
                 dashmodel_vertices_z(model),
@@ -2355,9 +2645,9 @@ dash3d_project(
         else
         {
             project_vertices_array_sparse_fused_notex(
-                dash->screen_vertices_x,
-                dash->screen_vertices_y,
-                dash->screen_vertices_z,
+                screen_vertices_x,
+                screen_vertices_y,
+                screen_vertices_z,
                 dashmodel_vertices_x(model),
                 dashmodel_vertices_y(model),
                 dashmodel_vertices_z(model),
@@ -2382,12 +2672,12 @@ dash3d_project(
         if( dashmodel_has_textures(model) )
         {
             project_vertices_array_fused(
-                dash->orthographic_vertices_x,
-                dash->orthographic_vertices_y,
-                dash->orthographic_vertices_z,
-                dash->screen_vertices_x,
-                dash->screen_vertices_y,
-                dash->screen_vertices_z,
+                orthographic_vertices_x,
+                orthographic_vertices_y,
+                orthographic_vertices_z,
+                screen_vertices_x,
+                screen_vertices_y,
+                screen_vertices_z,
                 dashmodel_vertices_x(model),
                 dashmodel_vertices_y(model),
                 dashmodel_vertices_z(model),
@@ -2405,9 +2695,9 @@ dash3d_project(
         else
         {
             project_vertices_array_fused_notex(
-                dash->screen_vertices_x,
-                dash->screen_vertices_y,
-                dash->screen_vertices_z,
+                screen_vertices_x,
+                screen_vertices_y,
+                screen_vertices_z,
                 dashmodel_vertices_x(model),
                 dashmodel_vertices_y(model),
                 dashmodel_vertices_z(model),
@@ -2430,6 +2720,36 @@ dash3d_project(
     return DASHCULL_VISIBLE;
 }
 
+static inline int
+dash3d_project(
+    struct DashGraphics* dash,
+    struct DashModel* model,
+    struct DashPosition* position,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera)
+{
+    int center_z = 0;
+
+    dash3d_projection_bind_scratch(dash);
+    if( model == NULL || !dash3d_scratch_reserve_model(dash, model) )
+        return DASHCULL_ERROR;
+    return dash3d_project_to(
+        &dash->cylinder_fast_aabb,
+        &dash->aabb,
+        dash->screen_vertices_x,
+        dash->screen_vertices_y,
+        dash->screen_vertices_z,
+        dash->orthographic_vertices_x,
+        dash->orthographic_vertices_y,
+        dash->orthographic_vertices_z,
+        model,
+        position,
+        view_port,
+        camera,
+        NULL,
+        &center_z);
+}
+
 struct DashAABB*
 dash3d_projected_model_aabb(struct DashGraphics* dash)
 {
@@ -2454,6 +2774,525 @@ dash3d_project_model(
     return cull;
 }
 
+/* Blocks are chained and never reallocated, so records stay put until reset. */
+#define DASH_PROJECTION_ARENA_BLOCK_SIZE (256 * 1024)
+
+struct DashProjectionArenaBlock
+{
+    struct DashProjectionArenaBlock* next;
+    size_t capacity;
+    size_t used;
+    /* Followed by capacity bytes. */
+};
+
+/* Header padded to 16 so payloads stay 16-byte aligned for the SIMD projectors. */
+#define DASH_PROJECTION_ARENA_HEADER                                                              \
+    ((sizeof(struct DashProjectionArenaBlock) + 15) & ~(size_t)15)
+
+struct DashProjectionArena
+{
+    struct DashProjectionArenaBlock* head;
+    struct DashProjectionArenaBlock* current;
+    size_t used_total;
+};
+
+struct DashProjectionArena*
+dash_projection_arena_new(void)
+{
+    struct DashProjectionArena* arena =
+        (struct DashProjectionArena*)malloc(sizeof(struct DashProjectionArena));
+    memset(arena, 0, sizeof(struct DashProjectionArena));
+    return arena;
+}
+
+void
+dash_projection_arena_free(struct DashProjectionArena* arena)
+{
+    if( !arena )
+        return;
+    struct DashProjectionArenaBlock* block = arena->head;
+    while( block )
+    {
+        struct DashProjectionArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
+
+void
+dash_projection_arena_reset(struct DashProjectionArena* arena)
+{
+    for( struct DashProjectionArenaBlock* block = arena->head; block; block = block->next )
+        block->used = 0;
+    arena->current = arena->head;
+    arena->used_total = 0;
+}
+
+size_t
+dash_projection_arena_used(struct DashProjectionArena* arena)
+{
+    return arena ? arena->used_total : 0;
+}
+
+static void*
+dash_projection_arena_push(
+    struct DashProjectionArena* arena,
+    size_t size)
+{
+    size = (size + 15) & ~(size_t)15;
+
+    struct DashProjectionArenaBlock* block = arena->current;
+    while( block && block->capacity - block->used < size )
+        block = block->next;
+
+    if( !block )
+    {
+        size_t capacity = size > DASH_PROJECTION_ARENA_BLOCK_SIZE
+                              ? size
+                              : DASH_PROJECTION_ARENA_BLOCK_SIZE;
+        block = (struct DashProjectionArenaBlock*)malloc(DASH_PROJECTION_ARENA_HEADER + capacity);
+        if( !block )
+            return NULL;
+        block->capacity = capacity;
+        block->used = 0;
+        block->next = NULL;
+
+        /* Append after the current block; anything past it was skipped as too small. */
+        if( arena->current )
+        {
+            block->next = arena->current->next;
+            arena->current->next = block;
+        }
+        else
+        {
+            block->next = arena->head;
+            arena->head = block;
+        }
+    }
+    arena->current = block;
+
+    void* ptr = (uint8_t*)block + DASH_PROJECTION_ARENA_HEADER + block->used;
+    block->used += size;
+    arena->used_total += size;
+    return ptr;
+}
+
+struct DashProjectedModel*
+dash3d_projection_arena_alloc(
+    struct DashProjectionArena* arena,
+    struct DashModel* model)
+{
+    if( model == NULL || dashmodel_vertex_count(model) == 0 || dashmodel_face_count(model) == 0 )
+        return NULL;
+
+    int count = dash3d_projection_slot_count(model);
+    int arrays = dashmodel_has_textures(model) ? 6 : 3;
+    size_t array_size = ((size_t)count * sizeof(int) + 15) & ~(size_t)15;
+
+    struct DashProjectedModel* projected = (struct DashProjectedModel*)dash_projection_arena_push(
+        arena, sizeof(struct DashProjectedModel) + array_size * arrays);
+    if( !projected )
+        return NULL;
+
+    uint8_t* storage = (uint8_t*)projected +
+                       ((sizeof(struct DashProjectedModel) + 15) & ~(size_t)15);
+    memset(projected, 0, sizeof(struct DashProjectedModel));
+    projected->model = model;
+    projected->vertex_count = count;
+    projected->cull = DASHCULL_ERROR;
+    projected->screen_vertices_x = (int*)(storage + array_size * 0);
+    projected->screen_vertices_y = (int*)(storage + array_size * 1);
+    projected->screen_vertices_z = (int*)(storage + array_size * 2);
+    if( arrays == 6 )
+    {
+        projected->orthographic_vertices_x = (int*)(storage + array_size * 3);
+        projected->orthographic_vertices_y = (int*)(storage + array_size * 4);
+        projected->orthographic_vertices_z = (int*)(storage + array_size * 5);
+    }
+    return projected;
+}
+
+static int
+dash3d_project_model_to_occluded(
+    struct DashProjectedModel* out,
+    struct DashPosition* position,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera,
+    const struct DashCoverage* coverage)
+{
+    out->cull = dash3d_project_to(
+        &out->cylinder_fast_aabb,
+        &out->aabb,
+        out->screen_vertices_x,
+        out->screen_vertices_y,
+        out->screen_vertices_z,
+        out->orthographic_vertices_x,
+        out->orthographic_vertices_y,
+        out->orthographic_vertices_z,
+        out->model,
+        position,
+        view_port,
+        camera,
+        coverage,
+        &out->center_z);
+    return out->cull;
+}
+
+int
+dash3d_project_model_to(
+    struct DashProjectedModel* out,
+    struct DashPosition* position,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera)
+{
+    return dash3d_project_model_to_occluded(out, position, view_port, camera, NULL);
+}
+
+struct DashProjectedModel*
+dash3d_project_model_arena(
+    struct DashProjectionArena* arena,
+    struct DashModel* model,
+    struct DashPosition* position,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera)
+{
+    return dash3d_project_model_arena_occluded(arena, model, position, view_port, camera, NULL);
+}
+
+struct DashProjectedModel*
+dash3d_project_model_arena_occluded(
+    struct DashProjectionArena* arena,
+    struct DashModel* model,
+    struct DashPosition* position,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera,
+    const struct DashCoverage* coverage)
+{
+    struct DashProjectedModel* projected = dash3d_projection_arena_alloc(arena, model);
+    if( projected )
+        dash3d_project_model_to_occluded(projected, position, view_port, camera, coverage);
+    return projected;
+}
+
+/* 8x8 pixel cells: one bit per pixel in a uint64_t, row y at bits [y * 8, y * 8 + 8). */
+#define DASH_COVERAGE_CELL_SHIFT 3
+#define DASH_COVERAGE_CELL_SIZE (1 << DASH_COVERAGE_CELL_SHIFT)
+#define DASH_COVERAGE_FULL UINT64_MAX
+
+struct DashCoverage
+{
+    int width;
+    int height;
+    int cells_wide;
+    int cells_high;
+    int cell_capacity;
+    uint64_t* masks;
+    /* Farthest depth written into each cell; only meaningful once its mask is full. */
+    int* depths;
+};
+
+struct DashCoverage*
+dash_coverage_new(void)
+{
+    struct DashCoverage* coverage = (struct DashCoverage*)malloc(sizeof(struct DashCoverage));
+    memset(coverage, 0, sizeof(struct DashCoverage));
+    return coverage;
+}
+
+void
+dash_coverage_free(struct DashCoverage* coverage)
+{
+    if( !coverage )
+        return;
+    free(coverage->masks);
+    free(coverage->depths);
+    free(coverage);
+}
+
+void
+dash_coverage_reset(
+    struct DashCoverage* coverage,
+    struct DashViewPort* view_port)
+{
+    int width = view_port->width > 0 ? view_port->width : 0;
+    int height = view_port->height > 0 ? view_port->height : 0;
+    int cells_wide = (width + DASH_COVERAGE_CELL_SIZE - 1) >> DASH_COVERAGE_CELL_SHIFT;
+    int cells_high = (height + DASH_COVERAGE_CELL_SIZE - 1) >> DASH_COVERAGE_CELL_SHIFT;
+    int cell_count = cells_wide * cells_high;
+
+    if( cell_count > coverage->cell_capacity )
+    {
+        free(coverage->masks);
+        free(coverage->depths);
+        coverage->masks = (uint64_t*)malloc(sizeof(uint64_t) * cell_count);
+        coverage->depths = (int*)malloc(sizeof(int) * cell_count);
+        coverage->cell_capacity = cell_count;
+    }
+
+    coverage->width = width;
+    coverage->height = height;
+    coverage->cells_wide = cells_wide;
+    coverage->cells_high = cells_high;
+    if( cell_count == 0 )
+        return;
+
+    memset(coverage->masks, 0, sizeof(uint64_t) * cell_count);
+    for( int i = 0; i < cell_count; i++ )
+        coverage->depths[i] = INT_MIN;
+
+    /* Pixels past the right and bottom edges can never be drawn, so the edge cells start with
+     * them set; otherwise those cells could never fill. */
+    int tail_x = width & (DASH_COVERAGE_CELL_SIZE - 1);
+    if( tail_x )
+    {
+        uint64_t row = (uint8_t)(0xFF << tail_x);
+        uint64_t tail = row * 0x0101010101010101ULL;
+        for( int cy = 0; cy < cells_high; cy++ )
+            coverage->masks[cy * cells_wide + cells_wide - 1] |= tail;
+    }
+    int tail_y = height & (DASH_COVERAGE_CELL_SIZE - 1);
+    if( tail_y )
+    {
+        uint64_t tail = DASH_COVERAGE_FULL << (tail_y * 8);
+        for( int cx = 0; cx < cells_wide; cx++ )
+            coverage->masks[(cells_high - 1) * cells_wide + cx] |= tail;
+    }
+}
+
+/* Scanline-fills one screen-space triangle (viewport pixels) into the cell masks. Like the raster,
+ * rows run [y0, y2) and spans [left, right), so a pixel on an edge shared by two triangles is
+ * covered by only one of them. */
+static void
+dash_coverage_fill_triangle(
+    struct DashCoverage* coverage,
+    int x0,
+    int y0,
+    int x1,
+    int y1,
+    int x2,
+    int y2,
+    int depth)
+{
+    int t;
+    if( y1 < y0 )
+    {
+        t = x0;
+        x0 = x1;
+        x1 = t;
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    if( y2 < y0 )
+    {
+        t = x0;
+        x0 = x2;
+        x2 = t;
+        t = y0;
+        y0 = y2;
+        y2 = t;
+    }
+    if( y2 < y1 )
+    {
+        t = x1;
+        x1 = x2;
+        x2 = t;
+        t = y1;
+        y1 = y2;
+        y2 = t;
+    }
+
+    if( y2 < 0 || y0 >= coverage->height || y0 == y2 )
+        return;
+
+    int y_start = y0 < 0 ? 0 : y0;
+    int y_end = y2 > coverage->height ? coverage->height : y2;
+    int cells_wide = coverage->cells_wide;
+
+    for( int y = y_start; y < y_end; y++ )
+    {
+        /* Long edge 0-2, short edge 0-1 above y1 and 1-2 below. Spans are computed in 64-bit so
+         * far off-screen vertices cannot overflow. */
+        int64_t xa = x0 + (int64_t)(x2 - x0) * (y - y0) / (y2 - y0);
+        int64_t xb;
+        if( y < y1 || y1 == y2 )
+            xb = y1 == y0 ? x1 : x0 + (int64_t)(x1 - x0) * (y - y0) / (y1 - y0);
+        else
+            xb = x1 + (int64_t)(x2 - x1) * (y - y1) / (y2 - y1);
+
+        int64_t left = xa < xb ? xa : xb;
+        int64_t right = xa < xb ? xb : xa;
+        if( right <= 0 || left >= coverage->width || left == right )
+            continue;
+        if( left < 0 )
+            left = 0;
+        /* Last pixel of the span. */
+        right = right > coverage->width ? coverage->width - 1 : right - 1;
+
+        int row_shift = (y & (DASH_COVERAGE_CELL_SIZE - 1)) * 8;
+        int cell_row = (y >> DASH_COVERAGE_CELL_SHIFT) * cells_wide;
+        int cx_start = (int)left >> DASH_COVERAGE_CELL_SHIFT;
+        int cx_end = (int)right >> DASH_COVERAGE_CELL_SHIFT;
+        for( int cx = cx_start; cx <= cx_end; cx++ )
+        {
+            int cell = cell_row + cx;
+            if( coverage->masks[cell] == DASH_COVERAGE_FULL )
+                continue;
+
+            int lo = cx == cx_start ? ((int)left & (DASH_COVERAGE_CELL_SIZE - 1)) : 0;
+            int hi = cx == cx_end ? ((int)right & (DASH_COVERAGE_CELL_SIZE - 1))
+                                  : DASH_COVERAGE_CELL_SIZE - 1;
+            uint64_t bits = (uint64_t)((0xFFu >> (7 - hi)) & (0xFFu << lo)) << row_shift;
+
+            coverage->masks[cell] |= bits;
+            if( depth > coverage->depths[cell] )
+                coverage->depths[cell] = depth;
+        }
+    }
+}
+
+void
+dash_coverage_add_projected(
+    struct DashCoverage* coverage,
+    struct DashGraphics* dash,
+    const struct DashProjectedModel* projected,
+    struct DashViewPort* view_port)
+{
+    if( !projected || projected->cull != DASHCULL_VISIBLE || coverage->cells_wide == 0 )
+        return;
+
+    struct DashModel* model = projected->model;
+    int face_count = dashmodel_face_count(model);
+    bool sparse = dashmodel__is_ground_va(model);
+    faceint_t* face_a = dashmodel_face_indices_a(model);
+    faceint_t* face_b = dashmodel_face_indices_b(model);
+    faceint_t* face_c = dashmodel_face_indices_c(model);
+    int* face_infos = dashmodel_face_infos(model);
+    hsl16_t* colors_c = dashmodel_face_colors_c(model);
+    alphaint_t* face_alphas = dashmodel_face_alphas(model);
+    faceint_t* face_textures = dashmodel_face_textures(model);
+    const int* vx = projected->screen_vertices_x;
+    const int* vy = projected->screen_vertices_y;
+    const int* vz = projected->screen_vertices_z;
+    int cx = view_port->x_center;
+    int cy = view_port->y_center;
+
+    for( int f = 0; f < face_count; f++ )
+    {
+        if( face_infos && (face_infos[f] & 0x3) == 2 )
+            continue;
+        if( colors_c[f] == DASHHSL16_HIDDEN )
+            continue;
+        if( face_alphas && face_alphas[f] != 0 )
+            continue;
+        if( face_textures && face_textures[f] != -1 )
+        {
+            struct DashTexture* texture =
+                dashtexturemap_get(&dash->context->texture_map, face_textures[f]);
+            if( !texture || !texture->opaque )
+                continue;
+        }
+
+        int a = sparse ? f * 3 : face_a[f];
+        int b = sparse ? f * 3 + 1 : face_b[f];
+        int c = sparse ? f * 3 + 2 : face_c[f];
+
+        /* Vertices behind the near plane are flagged with x == -5000 by the projectors. */
+        if( vx[a] == -5000 || vx[b] == -5000 || vx[c] == -5000 )
+            continue;
+
+        /* Same winding test as the raster; back faces are never drawn. */
+        int dot_product = (vx[a] - vx[b]) * (vy[c] - vy[b]) - (vy[a] - vy[b]) * (vx[c] - vx[b]);
+        if( dot_product <= 0 )
+            continue;
+
+        int depth = vz[a];
+        if( vz[b] > depth )
+            depth = vz[b];
+        if( vz[c] > depth )
+            depth = vz[c];
+
+        dash_coverage_fill_triangle(
+            coverage,
+            vx[a] + cx,
+            vy[a] + cy,
+            vx[b] + cx,
+            vy[b] + cy,
+            vx[c] + cx,
+            vy[c] + cy,
+            depth + projected->center_z);
+    }
+}
+
+bool
+dash_coverage_hidden(
+    const struct DashCoverage* coverage,
+    const struct DashAABB* aabb,
+    int min_depth)
+{
+    if( coverage->cells_wide == 0 )
+        return false;
+
+    int min_x = aabb->min_screen_x < 0 ? 0 : aabb->min_screen_x;
+    int min_y = aabb->min_screen_y < 0 ? 0 : aabb->min_screen_y;
+    int max_x = aabb->max_screen_x >= coverage->width ? coverage->width - 1 : aabb->max_screen_x;
+    int max_y = aabb->max_screen_y >= coverage->height ? coverage->height - 1 : aabb->max_screen_y;
+    if( min_x > max_x || min_y > max_y )
+        return false;
+
+    int cx_start = min_x >> DASH_COVERAGE_CELL_SHIFT;
+    int cx_end = max_x >> DASH_COVERAGE_CELL_SHIFT;
+    int cy_start = min_y >> DASH_COVERAGE_CELL_SHIFT;
+    int cy_end = max_y >> DASH_COVERAGE_CELL_SHIFT;
+    for( int cy = cy_start; cy <= cy_end; cy++ )
+    {
+        const uint64_t* masks = coverage->masks + cy * coverage->cells_wide;
+        const int* depths = coverage->depths + cy * coverage->cells_wide;
+        for( int cx = cx_start; cx <= cx_end; cx++ )
+        {
+            if( masks[cx] != DASH_COVERAGE_FULL || depths[cx] >= min_depth )
+                return false;
+        }
+    }
+    return true;
+}
+
+void
+dash3d_projection_bind(
+    struct DashGraphics* dash,
+    const struct DashProjectedModel* projected)
+{
+    if( !projected )
+    {
+        dash3d_projection_bind_scratch(dash);
+        return;
+    }
+
+    dash->screen_vertices_x = projected->screen_vertices_x;
+    dash->screen_vertices_y = projected->screen_vertices_y;
+    dash->screen_vertices_z = projected->screen_vertices_z;
+    /* Untextured records have no orthographic storage; keep the scratch so no view is NULL. */
+    dash->orthographic_vertices_x = projected->orthographic_vertices_x
+                                        ? projected->orthographic_vertices_x
+                                        : dash->scratch_orthographic_vertices_x;
+    dash->orthographic_vertices_y = projected->orthographic_vertices_y
+                                        ? projected->orthographic_vertices_y
+                                        : dash->scratch_orthographic_vertices_y;
+    dash->orthographic_vertices_z = projected->orthographic_vertices_z
+                                        ? projected->orthographic_vertices_z
+                                        : dash->scratch_orthographic_vertices_z;
+    dash->aabb = projected->aabb;
+    dash->cylinder_fast_aabb = projected->cylinder_fast_aabb;
+    dash->bound_projection = projected;
+}
+
+const struct DashProjectedModel*
+dash3d_projection_bound(struct DashGraphics* dash)
+{
+    return dash->bound_projection;
+}
+
 int
 dash3d_prepare_projected_face_order(
     struct DashGraphics* dash,
@@ -2517,8 +3356,10 @@ dash3d_project_raw(
     struct DashViewPort* view_port,
     struct DashCamera* camera)
 {
+    dash3d_projection_bind_scratch(dash);
     struct ProjectedVertex center_projection;
-    if( model == NULL || dashmodel_vertex_count(model) == 0 || dashmodel_face_count(model) == 0 )
+    if( model == NULL || dashmodel_vertex_count(model) == 0 || dashmodel_face_count(model) == 0 ||
+        !dash3d_scratch_reserve_model(dash, model) )
         return DASHCULL_ERROR;
 
     project_orthographic_fast(
@@ -2538,7 +3379,7 @@ dash3d_project_raw(
     case DASHMODEL_TYPE_GROUND_VA:
     {
         int nf = dashmodel_face_count(model);
-        assert(nf <= 4096);
+        assert(nf * 3 <= DASH_SCRATCH_MAX);
         if( dashmodel_has_textures(model) )
         {
             project_vertices_array_sparse_fused(
@@ -2716,10 +3557,12 @@ dash3d_project6(
     struct DashViewPort* view_port,
     struct DashCamera* camera)
 {
+    dash3d_projection_bind_scratch(dash);
     struct ProjectedVertex center_projection;
     int cull = DASHCULL_VISIBLE;
 
-    if( model == NULL || dashmodel_vertex_count(model) == 0 || dashmodel_face_count(model) == 0 )
+    if( model == NULL || dashmodel_vertex_count(model) == 0 || dashmodel_face_count(model) == 0 ||
+        !dash3d_scratch_reserve_model(dash, model) )
         return DASHCULL_ERROR;
 
     cull = dash3d_fast_cull(
@@ -2738,7 +3581,7 @@ dash3d_project6(
     case DASHMODEL_TYPE_GROUND_VA:
     {
         int nf = dashmodel_face_count(model);
-        assert(nf <= 4096);
+        assert(nf * 3 <= DASH_SCRATCH_MAX);
         if( dashmodel_has_textures(model) )
         {
             project_vertices_array6_sparse_fused(
@@ -2880,6 +3723,396 @@ dash3d_raster_projected_model(
     dash3d_raster(dash, model, view_port, camera, pixel_buffer, smooth);
 }
 
+/* -----------------------------------------------------------------------------------------------
+ * Tile bins: deferred, band-parallel rasterization.
+ *
+ * Each pushed model is sorted once (same painter order as dash3d_raster_projected_model). A model
+ * bound from a projection arena is referenced as is; one projected into the DashGraphics scratch
+ * is copied into the bins' own arena, since the scratch is reused by the next projection. Faces
+ * are then binned into full-width horizontal bands by screen y. A band holds (draw, face) pairs
+ * in push order, so painter's order is preserved within every band and bands never share pixels;
+ * any thread may raster any band.
+ *
+ * Bands are full-width rather than square tiles because the perspective texture spans measure x
+ * from the viewport center; keeping the width leaves x untouched and only y needs rebasing (see
+ * g_raster_origin_dy).
+ * ---------------------------------------------------------------------------------------------*/
+
+struct DashTileDraw
+{
+    struct DashModel* model;
+    faceint_t* face_indices_a;
+    faceint_t* face_indices_b;
+    faceint_t* face_indices_c;
+    /* A bound arena record, or a copy of the scratch in DashTileBins.projections. */
+    int const* screen_vertices_x;
+    int const* screen_vertices_y;
+    int const* screen_vertices_z;
+    int const* orthographic_vertices_x;
+    int const* orthographic_vertices_y;
+    int const* orthographic_vertices_z;
+    /* Animation rewrites face alphas in place; -1 when the model has none. */
+    int alpha_offset;
+    int flags;
+};
+
+struct DashTileFace
+{
+    int draw;
+    int face;
+};
+
+struct DashTileBin
+{
+    struct DashTileFace* faces;
+    int count;
+    int capacity;
+};
+
+struct DashTileBins
+{
+    struct DashTileDraw* draws;
+    int draw_count;
+    int draw_capacity;
+
+    struct DashProjectionArena* projections;
+
+    alphaint_t* alpha_arena;
+    int alpha_arena_count;
+    int alpha_arena_capacity;
+
+    struct DashTileBin* bins;
+    int bin_count;
+    int bin_capacity;
+    int tile_height;
+
+    int screen_width;
+    int screen_height;
+    int stride;
+    int near_plane_z;
+    int camera_fov;
+    struct DashTextureMap* texture_map;
+};
+
+static bool
+dash_grow(
+    void** data,
+    int* capacity,
+    int needed,
+    size_t elem_size)
+{
+    if( needed <= *capacity )
+        return true;
+    int cap = *capacity > 0 ? *capacity : 64;
+    while( cap < needed )
+        cap *= 2;
+    void* p = realloc(*data, (size_t)cap * elem_size);
+    if( !p )
+        return false;
+    *data = p;
+    *capacity = cap;
+    return true;
+}
+
+struct DashTileBins*
+dash3d_tile_bins_new(void)
+{
+    struct DashTileBins* bins = (struct DashTileBins*)malloc(sizeof(struct DashTileBins));
+    if( !bins )
+        return NULL;
+    memset(bins, 0, sizeof(struct DashTileBins));
+    bins->tile_height = DASH_TILE_HEIGHT_DEFAULT;
+    bins->projections = dash_projection_arena_new();
+    return bins;
+}
+
+void
+dash3d_tile_bins_free(struct DashTileBins* bins)
+{
+    if( !bins )
+        return;
+    for( int i = 0; i < bins->bin_capacity; i++ )
+        free(bins->bins[i].faces);
+    free(bins->bins);
+    free(bins->alpha_arena);
+    dash_projection_arena_free(bins->projections);
+    free(bins->draws);
+    free(bins);
+}
+
+void
+dash3d_tile_bins_reset(
+    struct DashTileBins* bins,
+    struct DashGraphics* dash,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera,
+    int tile_height)
+{
+    if( tile_height <= 0 )
+        tile_height = DASH_TILE_HEIGHT_DEFAULT;
+
+    bins->draw_count = 0;
+    dash_projection_arena_reset(bins->projections);
+    bins->alpha_arena_count = 0;
+    bins->tile_height = tile_height;
+    bins->screen_width = view_port->width;
+    bins->screen_height = view_port->height;
+    bins->stride = view_port->stride;
+    bins->near_plane_z = camera->near_plane_z;
+    bins->camera_fov = camera->fov_rpi2048;
+    bins->texture_map = &dash->context->texture_map;
+
+    int bin_count = (view_port->height + tile_height - 1) / tile_height;
+    if( bin_count > bins->bin_capacity )
+    {
+        struct DashTileBin* p = (struct DashTileBin*)realloc(
+            bins->bins, (size_t)bin_count * sizeof(struct DashTileBin));
+        if( !p )
+            bin_count = bins->bin_capacity;
+        else
+        {
+            memset(
+                p + bins->bin_capacity,
+                0,
+                (size_t)(bin_count - bins->bin_capacity) * sizeof(struct DashTileBin));
+            bins->bins = p;
+            bins->bin_capacity = bin_count;
+        }
+    }
+    bins->bin_count = bin_count;
+    for( int i = 0; i < bins->bin_count; i++ )
+        bins->bins[i].count = 0;
+}
+
+int
+dash3d_tile_bins_tile_count(struct DashTileBins* bins)
+{
+    return bins ? bins->bin_count : 0;
+}
+
+int
+dash3d_tile_bins_draw_count(struct DashTileBins* bins)
+{
+    return bins ? bins->draw_count : 0;
+}
+
+static inline void
+dash3d_tile_bin_push(
+    struct DashTileBin* bin,
+    int draw,
+    int face)
+{
+    if( bin->count == bin->capacity &&
+        !dash_grow((void**)&bin->faces, &bin->capacity, bin->count + 1, sizeof(*bin->faces)) )
+        return;
+    bin->faces[bin->count].draw = draw;
+    bin->faces[bin->count].face = face;
+    bin->count++;
+}
+
+bool
+dash3d_tile_bins_push_projected_model(
+    struct DashTileBins* bins,
+    struct DashGraphics* dash,
+    struct DashModel* model,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera,
+    bool smooth)
+{
+    faceint_t* fia;
+    faceint_t* fib;
+    faceint_t* fic;
+    dash3d_projected_face_index_ptrs(dash, model, &fia, &fib, &fic);
+
+    dash3d_sort_face_draw_order(dash, model, view_port, camera, NULL, smooth, fia, fib, fic);
+    if( dash->tmp_face_order_count <= 0 )
+        return true;
+
+    alphaint_t* face_alphas = dashmodel_face_alphas(model);
+    int face_count = dashmodel_face_count(model);
+
+    /* A bound arena record outlives the frame's draws; scratch is overwritten by the next
+     * projection and has to be copied. */
+    const struct DashProjectedModel* projected = dash->bound_projection;
+    if( !projected || projected->model != model )
+    {
+        struct DashProjectedModel* copy = dash3d_projection_arena_alloc(bins->projections, model);
+        if( !copy )
+            return false;
+        size_t const bytes = (size_t)copy->vertex_count * sizeof(int);
+        memcpy(copy->screen_vertices_x, dash->screen_vertices_x, bytes);
+        memcpy(copy->screen_vertices_y, dash->screen_vertices_y, bytes);
+        memcpy(copy->screen_vertices_z, dash->screen_vertices_z, bytes);
+        if( copy->orthographic_vertices_x )
+        {
+            memcpy(copy->orthographic_vertices_x, dash->orthographic_vertices_x, bytes);
+            memcpy(copy->orthographic_vertices_y, dash->orthographic_vertices_y, bytes);
+            memcpy(copy->orthographic_vertices_z, dash->orthographic_vertices_z, bytes);
+        }
+        projected = copy;
+    }
+
+    if( (face_alphas && !dash_grow(
+                            (void**)&bins->alpha_arena,
+                            &bins->alpha_arena_capacity,
+                            bins->alpha_arena_count + face_count,
+                            sizeof(alphaint_t))) ||
+        !dash_grow(
+            (void**)&bins->draws,
+            &bins->draw_capacity,
+            bins->draw_count + 1,
+            sizeof(struct DashTileDraw)) )
+        return false;
+
+    int draw_index = bins->draw_count++;
+    struct DashTileDraw* draw = &bins->draws[draw_index];
+    draw->model = model;
+    draw->face_indices_a = fia;
+    draw->face_indices_b = fib;
+    draw->face_indices_c = fic;
+    draw->screen_vertices_x = projected->screen_vertices_x;
+    draw->screen_vertices_y = projected->screen_vertices_y;
+    draw->screen_vertices_z = projected->screen_vertices_z;
+    draw->orthographic_vertices_x = projected->orthographic_vertices_x;
+    draw->orthographic_vertices_y = projected->orthographic_vertices_y;
+    draw->orthographic_vertices_z = projected->orthographic_vertices_z;
+    draw->flags = 0;
+    if( smooth )
+        draw->flags |= RASTER_FLAG_GOURAUD_SMOOTH;
+    if( dashmodel__is_ground_any(model) )
+        draw->flags |= RASTER_FLAG_TEXTURE_AFFINE;
+#if DASH_TEXTURE_MIPMAP
+    draw->flags |= RASTER_FLAG_TEXTURE_MIPMAP;
+#endif
+
+    draw->alpha_offset = -1;
+    if( face_alphas )
+    {
+        draw->alpha_offset = bins->alpha_arena_count;
+        memcpy(
+            bins->alpha_arena + bins->alpha_arena_count,
+            face_alphas,
+            (size_t)face_count * sizeof(alphaint_t));
+        bins->alpha_arena_count += face_count;
+    }
+
+    int const offset_y = bins->screen_height >> 1;
+    int const last_bin = bins->bin_count - 1;
+    int const tile_height = bins->tile_height;
+    int const* vx = draw->screen_vertices_x;
+    int const* vy = draw->screen_vertices_y;
+    for( int i = 0; i < dash->tmp_face_order_count; i++ )
+    {
+        int face = dash->tmp_face_order[i];
+        int a = fia[face];
+        int b = fib[face];
+        int c = fic[face];
+
+        int first = 0;
+        int last = last_bin;
+        /* Near-clipped faces get new vertices at raster time; let every band clip them. */
+        if( vx[a] != -5000 && vx[b] != -5000 && vx[c] != -5000 )
+        {
+            int min_y = vy[a];
+            int max_y = vy[a];
+            if( vy[b] < min_y )
+                min_y = vy[b];
+            if( vy[b] > max_y )
+                max_y = vy[b];
+            if( vy[c] < min_y )
+                min_y = vy[c];
+            if( vy[c] > max_y )
+                max_y = vy[c];
+            min_y += offset_y;
+            max_y += offset_y;
+            if( max_y < 0 || min_y >= bins->screen_height )
+                continue;
+
+            if( min_y > 0 )
+                first = min_y / tile_height;
+            if( max_y < bins->screen_height )
+                last = max_y / tile_height;
+        }
+
+        for( int t = first; t <= last; t++ )
+            dash3d_tile_bin_push(&bins->bins[t], draw_index, face);
+    }
+
+    return true;
+}
+
+void
+dash3d_tile_bins_raster_tile(
+    struct DashTileBins* bins,
+    int tile,
+    int* pixel_buffer)
+{
+    assert(tile >= 0 && tile < bins->bin_count);
+    struct DashTileBin* bin = &bins->bins[tile];
+    if( bin->count == 0 )
+        return;
+
+    int const band_top = tile * bins->tile_height;
+    int band_height = bins->tile_height;
+    if( band_top + band_height > bins->screen_height )
+        band_height = bins->screen_height - band_top;
+
+    /* Kernels see the band as the whole screen; textured kernels re-center their view origin. */
+    g_raster_origin_dy = band_top + (band_height >> 1) - (bins->screen_height >> 1);
+
+    struct DashModelRasterContext ctx = { 0 };
+    ctx.pixel_buffer = pixel_buffer + band_top * bins->stride;
+    ctx.offset_x = bins->screen_width >> 1;
+    ctx.offset_y = (bins->screen_height >> 1) - band_top;
+    ctx.near_plane_z = bins->near_plane_z;
+    ctx.screen_width = bins->screen_width;
+    ctx.screen_height = band_height;
+    ctx.stride = bins->stride;
+    ctx.camera_fov = bins->camera_fov;
+    ctx.texture_map = bins->texture_map;
+
+    int current_draw = -1;
+    for( int i = 0; i < bin->count; i++ )
+    {
+        struct DashTileFace* entry = &bin->faces[i];
+        if( entry->draw != current_draw )
+        {
+            current_draw = entry->draw;
+            struct DashTileDraw* draw = &bins->draws[current_draw];
+            struct DashModel* model = draw->model;
+
+            ctx.face_infos = dashmodel_face_infos(model);
+            ctx.face_indices_a = draw->face_indices_a;
+            ctx.face_indices_b = draw->face_indices_b;
+            ctx.face_indices_c = draw->face_indices_c;
+            ctx.num_faces = dashmodel_face_count(model);
+            ctx.vertex_x = (int*)draw->screen_vertices_x;
+            ctx.vertex_y = (int*)draw->screen_vertices_y;
+            ctx.vertex_z = (int*)draw->screen_vertices_z;
+            ctx.orthographic_vertex_x_nullable = (int*)draw->orthographic_vertices_x;
+            ctx.orthographic_vertex_y_nullable = (int*)draw->orthographic_vertices_y;
+            ctx.orthographic_vertex_z_nullable = (int*)draw->orthographic_vertices_z;
+            ctx.num_vertices = dashmodel_vertex_count(model);
+            ctx.face_textures = dashmodel_face_textures(model);
+            ctx.face_texture_coords = dashmodel_face_texture_coords(model);
+            ctx.face_texture_coords_length = dashmodel_textured_face_count(model);
+            ctx.face_p_coordinate_nullable = dashmodel_textured_p_coordinate(model);
+            ctx.face_m_coordinate_nullable = dashmodel_textured_m_coordinate(model);
+            ctx.face_n_coordinate_nullable = dashmodel_textured_n_coordinate(model);
+            ctx.num_textured_faces = dashmodel_textured_face_count(model);
+            ctx.colors_a = dashmodel_face_colors_a(model);
+            ctx.colors_b = dashmodel_face_colors_b(model);
+            ctx.colors_c = dashmodel_face_colors_c(model);
+            ctx.face_alphas_nullable =
+                draw->alpha_offset >= 0 ? bins->alpha_arena + draw->alpha_offset : NULL;
+            ctx.flags = draw->flags;
+        }
+        dash3d_raster_model_face(entry->face, &ctx);
+    }
+
+    g_raster_origin_dy = 0;
+}
+
 static inline bool
 dash3d_projected_model_contains_aabb(
     struct DashGraphics* dash,
@@ -3092,12 +4325,187 @@ dashmodel_calculate_vertex_normals(struct DashModel* model)
     struct DashModelNormals* mm = dashmodel_merged_normals(model);
     if( mm && mm->lighting_vertex_normals )
     {
-        memcpy(
-            mm->lighting_vertex_normals,
-            nm->lighting_vertex_normals,
-            sizeof(struct LightingNormal) * (size_t)vc);
+        memcpy(
+            mm->lighting_vertex_normals,
+            nm->lighting_vertex_normals,
+            sizeof(struct LightingNormal) * (size_t)vc);
+    }
+}
+
+/* U phase: each row starts `phase` columns in and wraps. Two contiguous copies per row. */
+static void
+texture_write_u_phase(struct DashTexture* texture)
+{
+    int width = texture->width;
+    int phase = texture->animation_phase;
+    for( int row = 0; row < texture->height; row++ )
+    {
+        const int* src = texture->texels + row * width;
+        int* dst = texture->animation_texels + row * width;
+        memcpy(dst, src + phase, (size_t)(width - phase) * sizeof(int));
+        memcpy(dst + width - phase, src, (size_t)phase * sizeof(int));
+    }
+}
+
+static void
+texture_prepare_animation(struct DashTexture* texture)
+{
+    if( texture->animation_texels || !texture->texels )
+        return;
+
+    size_t length = (size_t)texture->width * (size_t)texture->height;
+    if( texture_animates_v(texture) )
+    {
+        texture->animation_texels = (int*)malloc(2 * length * sizeof(int));
+        if( !texture->animation_texels )
+            return;
+        memcpy(texture->animation_texels, texture->texels, length * sizeof(int));
+        memcpy(texture->animation_texels + length, texture->texels, length * sizeof(int));
+    }
+    else if( texture_animates_u(texture) )
+    {
+        texture->animation_texels = (int*)malloc(length * sizeof(int));
+        if( !texture->animation_texels )
+            return;
+        texture_write_u_phase(texture);
+    }
+}
+
+/* Average of a 2x2 block. Transparent textures use texel 0 as a hole: a block with three or more
+ * holes stays a hole, otherwise the holes are left out and the result is kept non-zero. */
+static int
+texture_mip_average(
+    const int* block,
+    int width,
+    bool opaque)
+{
+    int texels[4] = { block[0], block[1], block[width], block[width + 1] };
+    uint32_t alpha = 0;
+    int r = 0;
+    int g = 0;
+    int b = 0;
+    int count = 0;
+    for( int i = 0; i < 4; i++ )
+    {
+        if( !opaque && texels[i] == 0 )
+            continue;
+        alpha |= (uint32_t)texels[i] & 0xff000000u;
+        r += (texels[i] >> 16) & 0xff;
+        g += (texels[i] >> 8) & 0xff;
+        b += texels[i] & 0xff;
+        count++;
+    }
+    if( count < 2 )
+        return 0;
+
+    int color = (int)(alpha | (uint32_t)((r / count) << 16) | (uint32_t)((g / count) << 8) |
+                      (uint32_t)(b / count));
+    if( !opaque && color == 0 )
+        color = 1;
+    return color;
+}
+
+/* Rebuilds level 1 from the sampling texels; U-animated textures call this on every phase
+ * change since their sampling copy is rewritten. */
+static void
+texture_write_mip(struct DashTexture* texture)
+{
+    const int* src = texture_animates_u(texture) ? texture->animation_texels : texture->texels;
+    int width = texture->width;
+    int mip_width = width >> 1;
+    int mip_height = texture->height >> 1;
+    for( int y = 0; y < mip_height; y++ )
+    {
+        for( int x = 0; x < mip_width; x++ )
+        {
+            texture->mip_texels[y * mip_width + x] =
+                texture_mip_average(src + 2 * y * width + 2 * x, width, texture->opaque);
+        }
+    }
+
+    if( texture_animates_v(texture) )
+    {
+        memcpy(
+            texture->mip_texels + mip_width * mip_height,
+            texture->mip_texels,
+            (size_t)mip_width * mip_height * sizeof(int));
+    }
+}
+
+#if DASH_TEXTURE_MIPMAP
+static void
+texture_prepare_mip(struct DashTexture* texture)
+{
+    if( texture->mip_texels || !texture->texels || texture->width != 128 ||
+        texture->height != 128 )
+        return;
+    /* Animated textures sample their level 1 through the same phase as level 0. */
+    if( (texture_animates_v(texture) || texture_animates_u(texture)) &&
+        !texture->animation_texels )
+        return;
+
+    int copies = texture_animates_v(texture) ? 2 : 1;
+    texture->mip_texels = (int*)malloc((size_t)64 * 64 * copies * sizeof(int));
+    if( !texture->mip_texels )
+        return;
+    texture_write_mip(texture);
+}
+#endif
+
+#if DASH_TEXTURE_PAL8
+/* Builds palette_indices/palette when the texture has at most 256 distinct colours. U-animated
+ * textures are skipped: their sampling copy is rewritten whenever the phase moves. */
+static void
+texture_prepare_palette(struct DashTexture* texture)
+{
+    if( texture->palette_indices || !texture->texels || texture_animates_u(texture) )
+        return;
+
+    enum
+    {
+        SLOTS = 512,
+    };
+    int slot_color[SLOTS];
+    int16_t slot_index[SLOTS];
+    memset(slot_index, 0xff, sizeof(slot_index));
+
+    int length = texture->width * texture->height;
+    int copies = texture_animates_v(texture) ? 2 : 1;
+    int* palette = (int*)calloc(256, sizeof(int));
+    uint8_t* indices = (uint8_t*)malloc((size_t)length * copies + 3);
+    if( !palette || !indices )
+        goto fail;
+
+    int palette_count = 0;
+    for( int i = 0; i < length; i++ )
+    {
+        int color = texture->texels[i];
+        uint32_t slot = ((uint32_t)color * 0x9E3779B1u) >> 23;
+        while( slot_index[slot] != -1 && slot_color[slot] != color )
+            slot = (slot + 1) & (SLOTS - 1);
+        if( slot_index[slot] == -1 )
+        {
+            if( palette_count == 256 )
+                goto fail;
+            slot_color[slot] = color;
+            slot_index[slot] = (int16_t)palette_count;
+            palette[palette_count++] = color;
+        }
+        indices[i] = (uint8_t)slot_index[slot];
     }
+    if( copies == 2 )
+        memcpy(indices + length, indices, (size_t)length);
+    memset(indices + (size_t)length * copies, 0, 3);
+
+    texture->palette_indices = indices;
+    texture->palette = palette;
+    return;
+
+fail:
+    free(palette);
+    free(indices);
 }
+#endif
 
 void //
 dash3d_add_texture(
@@ -3105,96 +4513,48 @@ dash3d_add_texture(
     int texture_id, //
     struct DashTexture* texture)
 {
-    dashtexturemap_set(&dash->texture_map, texture_id, texture);
+    if( texture )
+    {
+        texture_prepare_animation(texture);
+#if DASH_TEXTURE_PAL8
+        texture_prepare_palette(texture);
+#endif
+#if DASH_TEXTURE_MIPMAP
+        texture_prepare_mip(texture);
+#endif
+    }
+    dashtexturemap_set(&dash->context->texture_map, texture_id, texture);
 }
 
 /* Texture animation - matches Java animate_texture (res/animate_texture.java) and Client.ts.
  * RuneScape uses: direction 1,3 = V (vertical), 2,4 = U (horizontal);
  * direction 1,2 = DOWN (negate offset), 3,4 = UP.
- * In-place: process by cycles (one temp int per cycle) to avoid overwrite. */
-static int
-gcd(int a,
-    int b)
-{
-    a = a < 0 ? -a : a;
-    b = b < 0 ? -b : b;
-    while( b )
-    {
-        int t = b;
-        b = a % b;
-        a = t;
-    }
-    return a;
-}
-
+ * Java rotates the texels in place; here only the phase advances and sampling picks it up
+ * (texture_sample_texels), so the source texels are never written. */
 static void
 animate_texture(
     struct DashTexture* texture,
     int time_delta)
 {
-    if( texture->animation_direction == TEXANIM_DIRECTION_NONE )
+    if( !texture->animation_texels )
         return;
 
-    int animation_speed = texture->animation_speed;
-    int animation_direction = texture->animation_direction;
+    int size = texture_animates_v(texture) ? texture->height : texture->width;
+    int offset = (texture->animation_speed * time_delta) & (size - 1);
+    if( texture->animation_direction == TEXANIM_DIRECTION_V_DOWN ||
+        texture->animation_direction == TEXANIM_DIRECTION_U_DOWN )
+        offset = -offset;
 
-    int width = texture->width;
-    int length = width * texture->height;
-
-    int* pixels = texture->texels;
-
-    /* V direction (1 or 3): shift by whole rows. Java: var4 = arg0 * width * animationSpeed */
-    if( animation_direction == TEXANIM_DIRECTION_V_DOWN ||
-        animation_direction == TEXANIM_DIRECTION_V_UP )
-    {
-        int v_offset = width * time_delta * animation_speed;
-        if( animation_direction == TEXANIM_DIRECTION_V_DOWN )
-            v_offset = -v_offset;
+    int phase = (texture->animation_phase + offset) & (size - 1);
+    if( phase == texture->animation_phase )
+        return;
+    texture->animation_phase = phase;
 
-        int mask = length - 1;
-        int g = gcd(v_offset, length);
-        for( int start = 0; start < g; start++ )
-        {
-            int saved = pixels[start];
-            int pos = start;
-            int next = (pos + v_offset) & mask;
-            while( next != start )
-            {
-                pixels[pos] = pixels[next];
-                pos = next;
-                next = (pos + v_offset) & mask;
-            }
-            pixels[pos] = saved;
-        }
-    }
-    /* U direction (2 or 4): shift by columns within each row. Java: var11 = animationSpeed * arg0
-     */
-    else if(
-        animation_direction == TEXANIM_DIRECTION_U_DOWN ||
-        animation_direction == TEXANIM_DIRECTION_U_UP )
+    if( texture_animates_u(texture) )
     {
-        int u_offset = animation_speed * time_delta;
-        if( animation_direction == TEXANIM_DIRECTION_U_DOWN )
-            u_offset = -u_offset;
-
-        int col_mask = width - 1;
-        int g = gcd(u_offset, width);
-        for( int row_start = 0; row_start < length; row_start += width )
-        {
-            for( int start = 0; start < g; start++ )
-            {
-                int saved = pixels[row_start + start];
-                int pos = start;
-                int next = (pos + u_offset) & col_mask;
-                while( next != start )
-                {
-                    pixels[row_start + pos] = pixels[row_start + next];
-                    pos = next;
-                    next = (pos + u_offset) & col_mask;
-                }
-                pixels[row_start + pos] = saved;
-            }
-        }
+        texture_write_u_phase(texture);
+        if( texture->mip_texels )
+            texture_write_mip(texture);
     }
 }
 
@@ -3205,7 +4565,7 @@ dash_animate_textures(
 {
     int cursor = 0;
     struct DashTexture* tex;
-    while( (tex = dashtexturemap_iter_next(&dash->texture_map, &cursor)) )
+    while( (tex = dashtexturemap_iter_next(&dash->context->texture_map, &cursor)) )
         animate_texture(tex, time_delta);
 }
 
@@ -3523,87 +4883,29 @@ static void
 dashfont_draw_mask(
     int w,
     int h,
-    int* src,
-    int src_offset,
-    int src_step,
+    const uint8_t* bits,
     int* dst,
     int dst_offset,
-    int dst_step,
+    int stride,
     int rgb)
 {
-    int hw = -(w >> 2);
-    w = -(w & 0x3);
-    for( int y = -h; y < 0; y++ )
+    int bits_stride = (w + 7) >> 3;
+    for( int row = 0; row < h; row++ )
     {
-        for( int x = hw; x < 0; x++ )
-        {
-            if( src[src_offset++] == 0 )
-            {
-                dst_offset++;
-            }
-            else
-            {
-                dst[dst_offset++] = rgb;
-            }
-
-            if( src[src_offset++] == 0 )
-            {
-                dst_offset++;
-            }
-            else
-            {
-                dst[dst_offset++] = rgb;
-            }
-
-            if( src[src_offset++] == 0 )
-            {
-                dst_offset++;
-            }
-            else
-            {
-                dst[dst_offset++] = rgb;
-            }
-
-            if( src[src_offset++] == 0 )
-            {
-                dst_offset++;
-            }
-            else
-            {
-                dst[dst_offset++] = rgb;
-            }
-        }
-
-        for( int x = w; x < 0; x++ )
-        {
-            if( src[src_offset++] == 0 )
-            {
-                dst_offset++;
-            }
-            else
-            {
-                dst[dst_offset++] = rgb;
-            }
-        }
-
-        dst_offset += dst_step;
-        src_offset += src_step;
+        dash2d_fill_mask1_fast((uint32_t*)dst + dst_offset, bits, 0, w, (uint32_t)rgb);
+        bits += bits_stride;
+        dst_offset += stride;
     }
 }
 
 /* Like dashfont_draw_mask but only writes pixels inside [clip_left, clip_right) x [clip_top,
- * clip_bottom). base_x, base_y = top-left of character in buffer coords; stride used to compute
- * row. */
+ * clip_bottom). base_x, base_y = top-left of character in buffer coords. */
 static void
 dashfont_draw_mask_clipped(
     int w,
     int h,
-    int* src,
-    int src_offset,
-    int src_step,
+    const uint8_t* bits,
     int* dst,
-    int dst_offset,
-    int dst_step,
     int stride,
     int base_x,
     int base_y,
@@ -3613,44 +4915,81 @@ dashfont_draw_mask_clipped(
     int clip_bottom,
     int rgb)
 {
-    int hw = -(w >> 2);
-    int w_rem = -(w & 0x3);
-    for( int y = -h; y < 0; y++ )
+    int col_start = clip_left > base_x ? clip_left - base_x : 0;
+    int col_end = clip_right - base_x < w ? clip_right - base_x : w;
+    int row_start = clip_top > base_y ? clip_top - base_y : 0;
+    int row_end = clip_bottom - base_y < h ? clip_bottom - base_y : h;
+    if( col_start >= col_end || row_start >= row_end )
+        return;
+
+    int bits_stride = (w + 7) >> 3;
+    for( int row = row_start; row < row_end; row++ )
     {
-        int row = h + y;
-        int buf_y = base_y + row;
-        if( buf_y < clip_top || buf_y >= clip_bottom )
-        {
-            src_offset += (w >> 2) * 4 + (w & 3);
-            src_offset += src_step;
-            dst_offset += w + dst_step;
-            continue;
-        }
-        int col = 0;
-        for( int x = hw; x < 0; x++ )
-        {
-            for( int i = 0; i < 4 && col < w; i++, col++ )
-            {
-                int buf_x = base_x + col;
-                if( buf_x >= clip_left && buf_x < clip_right && src[src_offset] != 0 )
-                    dst[dst_offset] = rgb;
-                src_offset++;
-                dst_offset++;
-            }
-        }
-        for( int x = w_rem; x < 0; x++, col++ )
-        {
-            int buf_x = base_x + col;
-            if( buf_x >= clip_left && buf_x < clip_right && src[src_offset] != 0 )
-                dst[dst_offset] = rgb;
-            src_offset++;
-            dst_offset++;
-        }
-        dst_offset += dst_step;
-        src_offset += src_step;
+        dash2d_fill_mask1_fast(
+            (uint32_t*)dst + (base_y + row) * stride + base_x + col_start,
+            bits + row * bits_stride,
+            col_start,
+            col_end - col_start,
+            (uint32_t)rgb);
     }
 }
 
+void
+dash2d_fill_mask(
+    int* RESTRICT pixel_buffer,
+    int stride,
+    int x,
+    int y,
+    int width,
+    int height,
+    const uint8_t* bits,
+    int color_rgb)
+{
+    dashfont_draw_mask(width, height, bits, pixel_buffer, y * stride + x, stride, color_rgb);
+}
+
+void
+dash2d_fill_mask_clipped(
+    int* RESTRICT pixel_buffer,
+    int stride,
+    int x,
+    int y,
+    int width,
+    int height,
+    const uint8_t* bits,
+    int color_rgb,
+    int clip_left,
+    int clip_top,
+    int clip_right,
+    int clip_bottom)
+{
+    dashfont_draw_mask_clipped(
+        width,
+        height,
+        bits,
+        pixel_buffer,
+        stride,
+        x,
+        y,
+        clip_left,
+        clip_top,
+        clip_right,
+        clip_bottom,
+        color_rgb);
+}
+
+int
+dashfont_char_advance(
+    struct DashPixFont* pixfont,
+    int c)
+{
+    /* Characters outside the glyph set (space among them) use the extra slot the loader fills. */
+    int adv = pixfont->char_advance[c < DASH_FONT_CHAR_COUNT ? c : DASH_FONT_CHAR_COUNT];
+    if( adv <= 0 )
+        adv = 4; /* space (and any empty glyph) must still advance */
+    return adv;
+}
+
 void
 dashfont_draw_text(
     struct DashPixFont* pixfont,
@@ -3675,17 +5014,14 @@ dashfont_draw_text(
         {
             int w = pixfont->char_mask_width[c];
             int h = pixfont->char_mask_height[c];
-            int* mask = pixfont->char_mask[c];
+            const uint8_t* mask = pixfont->char_bits[c];
             /* Row-major: pixel (px, py) is at py*stride + px; include y so text draws at correct
              * row */
             int dst_offset =
                 y * stride + x + pixfont->char_offset_x[c] + pixfont->char_offset_y[c] * stride;
-            dashfont_draw_mask(w, h, mask, 0, 0, pixels, dst_offset, stride - w, color_rgb);
+            dashfont_draw_mask(w, h, mask, pixels, dst_offset, stride, color_rgb);
         }
-        int adv = pixfont->char_advance[c];
-        if( adv <= 0 )
-            adv = 4; /* space (and any empty glyph) must still advance */
-        x += adv;
+        x += dashfont_char_advance(pixfont, c);
     }
 }
 
@@ -3714,19 +5050,14 @@ dashfont_draw_text_clipped(
         {
             int w = pixfont->char_mask_width[c];
             int h = pixfont->char_mask_height[c];
-            int* mask = pixfont->char_mask[c];
+            const uint8_t* mask = pixfont->char_bits[c];
             int base_x = x + pixfont->char_offset_x[c];
             int base_y = y + pixfont->char_offset_y[c];
-            int dst_offset = base_y * stride + base_x;
             dashfont_draw_mask_clipped(
                 w,
                 h,
                 mask,
-                0,
-                0,
                 pixels,
-                dst_offset,
-                stride - w,
                 stride,
                 base_x,
                 base_y,
@@ -3736,10 +5067,7 @@ dashfont_draw_text_clipped(
                 clip_bottom,
                 color_rgb);
         }
-        int adv = pixfont->char_advance[c];
-        if( adv <= 0 )
-            adv = 4; /* space (and any empty glyph) must still advance */
-        x += adv;
+        x += dashfont_char_advance(pixfont, c);
     }
 }
 
@@ -3798,6 +5126,30 @@ dashfont_charcode_to_glyph(uint8_t code_point)
     return DASH_FONT_CHARCODESET[code_point];
 }
 
+uint8_t*
+dashfont_pack_mask(
+    const int* mask,
+    int w,
+    int h)
+{
+    if( !mask || w <= 0 || h <= 0 )
+        return NULL;
+
+    int bits_stride = (w + 7) >> 3;
+    uint8_t* bits = (uint8_t*)calloc((size_t)bits_stride * h, 1);
+    if( !bits )
+        return NULL;
+    for( int row = 0; row < h; row++ )
+    {
+        for( int col = 0; col < w; col++ )
+        {
+            if( mask[row * w + col] != 0 )
+                bits[row * bits_stride + (col >> 3)] |= (uint8_t)(1 << (col & 7));
+        }
+    }
+    return bits;
+}
+
 struct DashFontAtlas*
 dashfont_build_atlas(struct DashPixFont* pixfont)
 {
@@ -3834,17 +5186,17 @@ dashfont_build_atlas(struct DashPixFont* pixfont)
         atlas->glyph_w[i] = gw;
         atlas->glyph_h[i] = gh;
 
-        int* mask = pixfont->char_mask[i];
-        if( mask && gw > 0 && gh > 0 )
+        const uint8_t* bits = pixfont->char_bits[i];
+        if( bits && gw > 0 && gh > 0 )
         {
+            int bits_stride = (gw + 7) >> 3;
             for( int row = 0; row < gh; row++ )
             {
                 for( int col = 0; col < gw; col++ )
                 {
-                    int src_idx = row * gw + col;
                     size_t dst_idx =
                         ((size_t)row * (size_t)total_w + (size_t)(cursor_x + col)) * 4u;
-                    if( mask[src_idx] != 0 )
+                    if( (bits[row * bits_stride + (col >> 3)] >> (col & 7)) & 1 )
                     {
                         atlas->rgba_pixels[dst_idx + 0] = 0xFF;
                         atlas->rgba_pixels[dst_idx + 1] = 0xFF;
@@ -3877,7 +5229,7 @@ dashpixfont_free(struct DashPixFont* font)
     if( !font )
         return;
     for( int i = 0; i < DASH_FONT_CHAR_COUNT; i++ )
-        free(font->char_mask[i]);
+        free(font->char_bits[i]);
     dashfont_free_atlas(font->atlas);
     free(font->charcode_set);
     free(font);
@@ -3955,15 +5307,12 @@ dashfont_draw_text_ex(
         {
             int w = pixfont->char_mask_width[c];
             int h = pixfont->char_mask_height[c];
-            int* mask = pixfont->char_mask[c];
+            const uint8_t* mask = pixfont->char_bits[c];
             int dst_offset =
                 y * stride + x + pixfont->char_offset_x[c] + pixfont->char_offset_y[c] * stride;
-            dashfont_draw_mask(w, h, mask, 0, 0, pixels, dst_offset, stride - w, color);
+            dashfont_draw_mask(w, h, mask, pixels, dst_offset, stride, color);
         }
-        int adv = pixfont->char_advance[c];
-        if( adv <= 0 )
-            adv = 4;
-        x += adv;
+        x += dashfont_char_advance(pixfont, c);
     }
 }
 
@@ -4006,19 +5355,14 @@ dashfont_draw_text_ex_clipped(
         {
             int w = pixfont->char_mask_width[c];
             int h = pixfont->char_mask_height[c];
-            int* mask = pixfont->char_mask[c];
+            const uint8_t* mask = pixfont->char_bits[c];
             int base_x = x + pixfont->char_offset_x[c];
             int base_y = y + pixfont->char_offset_y[c];
-            int dst_offset = base_y * stride + base_x;
             dashfont_draw_mask_clipped(
                 w,
                 h,
                 mask,
-                0,
-                0,
                 pixels,
-                dst_offset,
-                stride - w,
                 stride,
                 base_x,
                 base_y,
@@ -4028,10 +5372,7 @@ dashfont_draw_text_ex_clipped(
                 clip_bottom,
                 color);
         }
-        int adv = pixfont->char_advance[c];
-        if( adv <= 0 )
-            adv = 4;
-        x += adv;
+        x += dashfont_char_advance(pixfont, c);
     }
 }
 
@@ -4071,23 +5412,18 @@ dashfont_draw_text_clipped_taggable(
         {
             int w = pixfont->char_mask_width[c];
             int h = pixfont->char_mask_height[c];
-            int* mask = pixfont->char_mask[c];
+            const uint8_t* mask = pixfont->char_bits[c];
             int base_x = x + pixfont->char_offset_x[c];
             int base_y = y + pixfont->char_offset_y[c];
             if( shadowed )
             {
                 int shadow_x = base_x + 1;
                 int shadow_y = base_y + 1;
-                int shadow_offset = shadow_y * stride + shadow_x;
                 dashfont_draw_mask_clipped(
                     w,
                     h,
                     mask,
-                    0,
-                    0,
                     pixels,
-                    shadow_offset,
-                    stride - w,
                     stride,
                     shadow_x,
                     shadow_y,
@@ -4097,16 +5433,11 @@ dashfont_draw_text_clipped_taggable(
                     clip_bottom,
                     shadow_color);
             }
-            int dst_offset = base_y * stride + base_x;
             dashfont_draw_mask_clipped(
                 w,
                 h,
                 mask,
-                0,
-                0,
                 pixels,
-                dst_offset,
-                stride - w,
                 stride,
                 base_x,
                 base_y,
@@ -4175,14 +5506,9 @@ dash2d_fill_rect(
     int height,
     int color_rgb)
 {
-    for( int i = 0; i < height; i++ )
-    {
-        for( int j = 0; j < width; j++ )
-        {
-            int pixel_buffer_index = (y + i) * stride + (x + j);
-            pixel_buffer[pixel_buffer_index] = color_rgb;
-        }
-    }
+    uint32_t* row = (uint32_t*)pixel_buffer + y * stride + x;
+    for( int i = 0; i < height; i++, row += stride )
+        dash2d_fill_row_fast(row, width, (uint32_t)color_rgb);
 }
 
 void
@@ -4207,14 +5533,9 @@ dash2d_fill_rect_clipped(
     int rh = ry2 - ry;
     if( rw <= 0 || rh <= 0 )
         return;
-    for( int i = 0; i < rh; i++ )
-    {
-        for( int j = 0; j < rw; j++ )
-        {
-            int pixel_buffer_index = (ry + i) * stride + (rx + j);
-            pixel_buffer[pixel_buffer_index] = color_rgb;
-        }
-    }
+    uint32_t* row = (uint32_t*)pixel_buffer + ry * stride + rx;
+    for( int i = 0; i < rh; i++, row += stride )
+        dash2d_fill_row_fast(row, rw, (uint32_t)color_rgb);
 }
 
 void
@@ -4228,11 +5549,9 @@ dash2d_draw_rect(
     int color_rgb)
 {
     // Top and bottom edges
-    for( int j = 0; j < width; j++ )
-    {
-        pixel_buffer[y * stride + (x + j)] = color_rgb;
-        pixel_buffer[(y + height - 1) * stride + (x + j)] = color_rgb;
-    }
+    dash2d_fill_row_fast((uint32_t*)pixel_buffer + y * stride + x, width, (uint32_t)color_rgb);
+    dash2d_fill_row_fast(
+        (uint32_t*)pixel_buffer + (y + height - 1) * stride + x, width, (uint32_t)color_rgb);
     // Left and right edges
     for( int i = 1; i < height - 1; i++ )
     {
@@ -4252,28 +5571,33 @@ dash2d_fill_rect_alpha(
     int color_rgb,
     int alpha)
 {
-    int r = (color_rgb >> 16) & 0xFF;
-    int g = (color_rgb >> 8) & 0xFF;
-    int b = color_rgb & 0xFF;
-
-    for( int i = 0; i < height; i++ )
-    {
-        for( int j = 0; j < width; j++ )
-        {
-            int pixel_buffer_index = (y + i) * stride + (x + j);
-            int dst_pixel = pixel_buffer[pixel_buffer_index];
-            int dst_r = (dst_pixel >> 16) & 0xFF;
-            int dst_g = (dst_pixel >> 8) & 0xFF;
-            int dst_b = dst_pixel & 0xFF;
-
-            // Alpha blend
-            int out_r = (r * alpha + dst_r * (256 - alpha)) >> 8;
-            int out_g = (g * alpha + dst_g * (256 - alpha)) >> 8;
-            int out_b = (b * alpha + dst_b * (256 - alpha)) >> 8;
+    uint32_t* row = (uint32_t*)pixel_buffer + y * stride + x;
+    for( int i = 0; i < height; i++, row += stride )
+        dash2d_fill_row_alpha_fast(row, width, (uint32_t)color_rgb, alpha);
+}
 
-            pixel_buffer[pixel_buffer_index] = (out_r << 16) | (out_g << 8) | out_b;
-        }
-    }
+void
+dash2d_fill_rect_alpha_clipped(
+    int* RESTRICT pixel_buffer,
+    int stride,
+    int x,
+    int y,
+    int width,
+    int height,
+    int color_rgb,
+    int alpha,
+    int clip_left,
+    int clip_top,
+    int clip_right,
+    int clip_bottom)
+{
+    int rx = x < clip_left ? clip_left : x;
+    int ry = y < clip_top ? clip_top : y;
+    int rx2 = x + width > clip_right ? clip_right : x + width;
+    int ry2 = y + height > clip_bottom ? clip_bottom : y + height;
+    if( rx2 <= rx || ry2 <= ry )
+        return;
+    dash2d_fill_rect_alpha(pixel_buffer, stride, rx, ry, rx2 - rx, ry2 - ry, color_rgb, alpha);
 }
 
 static void
@@ -4420,30 +5744,11 @@ dash2d_draw_rect_alpha(
     int g = (color_rgb >> 8) & 0xFF;
     int b = color_rgb & 0xFF;
 
-    // Top and bottom edges
-    for( int j = 0; j < width; j++ )
-    {
-        int top_idx = y * stride + (x + j);
-        int bot_idx = (y + height - 1) * stride + (x + j);
-
-        int dst_pixel = pixel_buffer[top_idx];
-        int dst_r = (dst_pixel >> 16) & 0xFF;
-        int dst_g = (dst_pixel >> 8) & 0xFF;
-        int dst_b = dst_pixel & 0xFF;
-        int out_r = (r * alpha + dst_r * (256 - alpha)) >> 8;
-        int out_g = (g * alpha + dst_g * (256 - alpha)) >> 8;
-        int out_b = (b * alpha + dst_b * (256 - alpha)) >> 8;
-        pixel_buffer[top_idx] = (out_r << 16) | (out_g << 8) | out_b;
-
-        dst_pixel = pixel_buffer[bot_idx];
-        dst_r = (dst_pixel >> 16) & 0xFF;
-        dst_g = (dst_pixel >> 8) & 0xFF;
-        dst_b = dst_pixel & 0xFF;
-        out_r = (r * alpha + dst_r * (256 - alpha)) >> 8;
-        out_g = (g * alpha + dst_g * (256 - alpha)) >> 8;
-        out_b = (b * alpha + dst_b * (256 - alpha)) >> 8;
-        pixel_buffer[bot_idx] = (out_r << 16) | (out_g << 8) | out_b;
-    }
+    // Top and bottom edges (a one-row rect blends its row twice, as before)
+    dash2d_fill_row_alpha_fast(
+        (uint32_t*)pixel_buffer + y * stride + x, width, (uint32_t)color_rgb, alpha);
+    dash2d_fill_row_alpha_fast(
+        (uint32_t*)pixel_buffer + (y + height - 1) * stride + x, width, (uint32_t)color_rgb, alpha);
 
     // Left and right edges
     for( int i = 1; i < height - 1; i++ )
@@ -4563,49 +5868,29 @@ dash2d_blit_sprite_alpha(
     int alpha,
     int* RESTRICT pixel_buffer)
 {
-    if( !sprite )
+    (void)dash;
+    if( !sprite || !sprite->pixels_argb )
         return;
     x += sprite->crop_x;
     y += sprite->crop_y;
 
-    int* src_pixels = sprite->pixels_argb;
-    int src_width = sprite->width;
-    int src_height = sprite->height;
-    int stride = view_port->stride;
+    int x0 = x < view_port->clip_left ? view_port->clip_left : x;
+    int y0 = y < view_port->clip_top ? view_port->clip_top : y;
+    int x1 = x + sprite->width > view_port->clip_right ? view_port->clip_right : x + sprite->width;
+    int y1 =
+        y + sprite->height > view_port->clip_bottom ? view_port->clip_bottom : y + sprite->height;
+    if( x0 >= x1 || y0 >= y1 )
+        return;
 
-    for( int src_y = 0; src_y < src_height; src_y++ )
+    int stride = view_port->stride;
+    const uint32_t* src_row =
+        (const uint32_t*)sprite->pixels_argb + (y0 - y) * sprite->width + (x0 - x);
+    uint32_t* dst_row = (uint32_t*)pixel_buffer + y0 * stride + x0;
+    for( int row = y0; row < y1; row++ )
     {
-        for( int src_x = 0; src_x < src_width; src_x++ )
-        {
-            int src_pixel = src_pixels[src_y * src_width + src_x];
-            if( src_pixel == 0 )
-                continue;
-
-            int dst_x = x + src_x;
-            int dst_y = y + src_y;
-
-            // Apply clipping bounds
-            if( dst_x < view_port->clip_left || dst_x >= view_port->clip_right ||
-                dst_y < view_port->clip_top || dst_y >= view_port->clip_bottom )
-                continue;
-
-            int dst_idx = dst_y * stride + dst_x;
-            int dst_pixel = pixel_buffer[dst_idx];
-
-            int src_r = (src_pixel >> 16) & 0xFF;
-            int src_g = (src_pixel >> 8) & 0xFF;
-            int src_b = src_pixel & 0xFF;
-
-            int dst_r = (dst_pixel >> 16) & 0xFF;
-            int dst_g = (dst_pixel >> 8) & 0xFF;
-            int dst_b = dst_pixel & 0xFF;
-
-            int out_r = (src_r * alpha + dst_r * (256 - alpha)) >> 8;
-            int out_g = (src_g * alpha + dst_g * (256 - alpha)) >> 8;
-            int out_b = (src_b * alpha + dst_b * (256 - alpha)) >> 8;
-
-            pixel_buffer[dst_idx] = (out_r << 16) | (out_g << 8) | out_b;
-        }
+        dash2d_blit_row_alpha_fast(dst_row, src_row, x1 - x0, alpha);
+        src_row += sprite->width;
+        dst_row += stride;
     }
 }
 
@@ -4646,6 +5931,19 @@ static int g_minimap_tile_mask[16][16] = {
     { 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1 }
 };
 
+/* g_minimap_tile_mask[shape][g_minimap_tile_rotation_map[angle][i]] as bit i, indexed
+ * [angle][shape]; rows 13-15 of the mask table are empty. */
+static const uint16_t g_minimap_tile_bits[4][16] = {
+    { 0x0000, 0xffff, 0xf731, 0x1133, 0x88cc, 0xffee, 0xff77, 0x3333,
+      0x3100, 0xceff, 0x113f, 0xeec0, 0xf600, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0xffff, 0x137f, 0x00cf, 0xfc00, 0xfff3, 0x3fff, 0x00ff,
+      0x0013, 0xffec, 0x88cf, 0x7730, 0x1331, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0xffff, 0x8cef, 0xcc88, 0x3311, 0x77ff, 0xeeff, 0xcccc,
+      0x008c, 0xff73, 0xfc88, 0x0377, 0x006f, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0xffff, 0xfec8, 0xf300, 0x003f, 0xcfff, 0xfffc, 0xff00,
+      0xc800, 0x37ff, 0xf311, 0x0cee, 0x8cc8, 0x0000, 0x0000, 0x0000 },
+};
+
 void
 dash2d_fill_minimap_tile(
     int* RESTRICT pixel_buffer,
@@ -4672,6 +5970,21 @@ dash2d_fill_minimap_tile(
     int* rotation = g_minimap_tile_rotation_map[angle];
 
     int offset = (x) + (y)*stride;
+
+    if( x >= 0 && x + 3 < clip_width && y >= 0 && y + 3 < clip_height )
+    {
+        if( foreground_rgb == 0 && background_rgb == 0 )
+            return;
+        int bits = foreground_rgb != 0 ? g_minimap_tile_bits[angle][shape] : 0;
+        dash2d_fill_tile4_fast(
+            (uint32_t*)pixel_buffer + offset,
+            stride,
+            bits,
+            (uint32_t)foreground_rgb,
+            (uint32_t)background_rgb,
+            background_rgb != 0);
+        return;
+    }
     if( foreground_rgb == 0 )
     {
         if( background_rgb != 0 )
@@ -4926,6 +6239,104 @@ dash2d_blit_rotated(
     // }
 }
 
+/* floor(sqrt(n)) for n >= 0. */
+static int
+dash2d__isqrt(int64_t n)
+{
+    int64_t lo = 0;
+    int64_t hi = 1;
+    while( hi * hi <= n )
+        hi <<= 1;
+    /* lo * lo <= n < hi * hi */
+    while( hi - lo > 1 )
+    {
+        int64_t mid = (lo + hi) >> 1;
+        if( mid * mid <= n )
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return (int)lo;
+}
+
+void
+dash2d_blit_rotated_masked(
+    int* RESTRICT src_buffer,
+    int src_stride,
+    int src_crop_x,
+    int src_crop_y,
+    int src_width,
+    int src_height,
+    int src_anchor_x,
+    int src_anchor_y,
+    int* RESTRICT dst_buffer,
+    int dst_stride,
+    int dst_buffer_height,
+    int dst_x,
+    int dst_y,
+    int dst_width,
+    int dst_height,
+    int dst_anchor_x,
+    int dst_anchor_y,
+    int angle_r2pi2048,
+    bool clip_circle)
+{
+    if( src_width <= 0 || src_height <= 0 )
+        return;
+
+    int sin = dash_sin(angle_r2pi2048);
+    int cos = dash_cos(angle_r2pi2048);
+
+    int min_x = dst_x > 0 ? dst_x : 0;
+    int min_y = dst_y > 0 ? dst_y : 0;
+    int max_x = dst_x + dst_width < dst_stride ? dst_x + dst_width : dst_stride;
+    int max_y = dst_y + dst_height < dst_buffer_height ? dst_y + dst_height : dst_buffer_height;
+    if( min_x >= max_x || min_y >= max_y )
+        return;
+
+    const uint32_t* src =
+        (const uint32_t*)src_buffer + src_crop_y * src_stride + src_crop_x;
+    int64_t ww = (int64_t)dst_width * dst_width;
+    int64_t hh = (int64_t)dst_height * dst_height;
+
+    for( int row = min_y; row < max_y; row++ )
+    {
+        int x0 = min_x;
+        int x1 = max_x;
+        if( clip_circle )
+        {
+            /* Pixel centres inside the ellipse inscribed in the destination rect satisfy
+             * (2x + 1 - w)^2 h^2 + (2y + 1 - h)^2 w^2 <= w^2 h^2, so |2x + 1 - w| <= reach. */
+            int64_t ty = 2 * (int64_t)(row - dst_y) + 1 - dst_height;
+            int reach = dash2d__isqrt((ww * hh - ty * ty * ww) / hh);
+            int span_x0 = dst_x + ((dst_width - reach) >> 1);
+            int span_x1 = dst_x + ((dst_width - 1 + reach) >> 1) + 1;
+            x0 = span_x0 > x0 ? span_x0 : x0;
+            x1 = span_x1 < x1 ? span_x1 : x1;
+            if( x0 >= x1 )
+                continue;
+        }
+
+        int rel_x = x0 - dst_x - dst_anchor_x;
+        int rel_y = row - dst_y - dst_anchor_y;
+        /* 16.16 source position; the integer part matches dash2d_blit_rotated_ex's
+         * src_anchor + ((rel_x * cos + rel_y * sin) >> 16). */
+        int u = src_anchor_x * 65536 + rel_x * cos + rel_y * sin;
+        int v = src_anchor_y * 65536 - rel_x * sin + rel_y * cos;
+        dash2d_blit_rotated_row_fast(
+            (uint32_t*)dst_buffer + row * dst_stride + x0,
+            src,
+            src_stride,
+            src_width,
+            src_height,
+            u,
+            v,
+            cos,
+            -sin,
+            x1 - x0);
+    }
+}
+
 void
 dashframe_free(struct DashFrame* frame)
 {
@@ -158,12 +158,29 @@ enum DashTextureAnimation
 
 struct DashTexture
 {
+    /** Source texels, never rewritten once the texture is added; animation moves the phase. */
     int* texels;
     int width;
     int height;
 
     int animation_direction;
     int animation_speed;
+    /** Scroll phase in rows (V) or columns (U), wrapped to the texture size. */
+    int animation_phase;
+    /** Owned sampling storage for animated textures, built by dash3d_add_texture. V textures
+     * keep their rows twice so any phase is a window into it; U textures keep one copy with
+     * the current column phase applied. NULL for static textures. */
+    int* animation_texels;
+    /** Optional 8-bit storage (DASH_TEXTURE_PAL8): a palette index per sampling texel, laid out
+     * like the int texels (doubled rows for V animation) plus 3 bytes of padding so 32-bit
+     * gathers at the last index stay in bounds. NULL when the texture uses int texels only. */
+    uint8_t* palette_indices;
+    /** 256 colours indexed by palette_indices; unused entries are 0. */
+    int* palette;
+    /** Optional 64x64 level of a 128x128 texture (DASH_TEXTURE_MIPMAP), box filtered from the
+     * sampling texels and laid out like them (doubled rows for V animation). Sampled instead of
+     * the full texture by faces that are minified on screen. NULL when absent. */
+    int* mip_texels;
 
     bool opaque;
 
@@ -312,7 +329,9 @@ struct DashFontAtlas
 struct DashPixFont
 {
     int* charcode_set;
-    int* char_mask[DASH_FONT_CHAR_COUNT];
+    /** Glyph masks, 1 bit per pixel: rows of (width + 7) / 8 bytes, bit 0 is the leftmost pixel.
+     * See dashfont_pack_mask. */
+    uint8_t* char_bits[DASH_FONT_CHAR_COUNT];
     int char_mask_count;
 
     int char_mask_width[DASH_FONT_CHAR_COUNT];
@@ -328,17 +347,41 @@ struct DashPixFont
 void
 dash_init(void);
 
+/* Rendering state is split in two:
+ *  - DashRenderContext: textures and constant index tables, shared read-only by every thread.
+ *  - DashGraphics: per-thread scratch (projected vertices, face-sort buckets). Each thread that
+ *    projects or sorts models needs its own; create them with dash_new_with_context.
+ * Register and animate textures only while no thread is rendering with the context. */
+struct DashRenderContext;
 struct DashGraphics;
+
+struct DashRenderContext*
+dash_context_new(void);
+
+void //
+dash_context_free(struct DashRenderContext* context);
+
+/** Scratch bound to a shared context; the context must outlive it. */
+struct DashGraphics* //
+dash_new_with_context(struct DashRenderContext* context);
+
+/** Scratch with its own context, freed by dash_free. */
 struct DashGraphics* //
 dash_new(void);
 
 void //
 dash_free(struct DashGraphics* dash);
 
+struct DashRenderContext*
+dash_context(struct DashGraphics* dash);
+
 #define DASHCULL_VISIBLE 0
 #define DASHCULL_CULLED_FAST 1
 #define DASHCULL_CULLED_AABB 2
 #define DASHCULL_ERROR 3
+/* Bounds fully behind opaque geometry already in a DashCoverage; see
+ * dash3d_project_model_arena_occluded. */
+#define DASHCULL_CULLED_OCCLUDED 4
 
 int
 dash_hsl16_to_rgb(int hsl16);
@@ -387,6 +430,142 @@ dash3d_project_model(
     struct DashViewPort* view_port,
     struct DashCamera* camera);
 
+/* -----------------------------------------------------------------------------------------------
+ * Projection arena: frame-scoped storage for projected vertices.
+ *
+ * dash3d_project_model writes into the single DashGraphics scratch, so each model has to be
+ * rasterized before the next one is projected. Projecting into an arena record instead keeps the
+ * result alive until dash_projection_arena_reset, which lets draw commands carry their geometry
+ * and lets projection and rasterization run as separate passes.
+ * ---------------------------------------------------------------------------------------------*/
+
+struct DashProjectionArena;
+
+struct DashProjectedModel
+{
+    struct DashModel* model;
+    /* Slots per vertex array; face_count * 3 for sparse (VA ground) models. */
+    int vertex_count;
+    int* screen_vertices_x;
+    int* screen_vertices_y;
+    int* screen_vertices_z;
+    /* NULL when the model has no textures. */
+    int* orthographic_vertices_x;
+    int* orthographic_vertices_y;
+    int* orthographic_vertices_z;
+    struct DashAABB aabb;
+    struct DashAABB cylinder_fast_aabb;
+    /* View-space depth of the model origin; screen_vertices_z are relative to it. */
+    int center_z;
+    /* DASHCULL_* result; the vertex arrays are only valid when DASHCULL_VISIBLE. */
+    int cull;
+};
+
+struct DashProjectionArena*
+dash_projection_arena_new(void);
+
+void
+dash_projection_arena_free(struct DashProjectionArena* arena);
+
+/** Drops every record; pointers handed out since the last reset become invalid. */
+void
+dash_projection_arena_reset(struct DashProjectionArena* arena);
+
+/** Total bytes handed out since the last reset. */
+size_t
+dash_projection_arena_used(struct DashProjectionArena* arena);
+
+/** Reserves a record and its vertex storage for model. Not thread-safe; records never move. */
+struct DashProjectedModel*
+dash3d_projection_arena_alloc(
+    struct DashProjectionArena* arena,
+    struct DashModel* model);
+
+/** Projects into a record from dash3d_projection_arena_alloc. Touches no shared state, so
+ * distinct records may be projected on different threads. Returns the cull result. */
+int
+dash3d_project_model_to(
+    struct DashProjectedModel* out,
+    struct DashPosition* position,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera);
+
+/** dash3d_projection_arena_alloc + dash3d_project_model_to. NULL if model is empty. */
+struct DashProjectedModel*
+dash3d_project_model_arena(
+    struct DashProjectionArena* arena,
+    struct DashModel* model,
+    struct DashPosition* position,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera);
+
+/* -----------------------------------------------------------------------------------------------
+ * Coverage buffer: conservative low-resolution occlusion for model draws.
+ *
+ * The viewport is split into 8x8 pixel cells. Each cell keeps a 64-bit mask of the pixels that
+ * opaque occluder faces cover and the farthest depth of any face that wrote into it. Once a cell's
+ * mask is full, anything deeper than that depth behind the cell cannot be seen. Models whose
+ * bounds (screen AABB, nearest depth of the bounding sphere) land only on such cells are culled
+ * before their vertices are projected.
+ *
+ * The painter draws back to front, so the coverage is filled in a prepass over the near, large
+ * occluders (terrain and walls) before any model is tested. Add the nearest occluders first: a
+ * full cell ignores later faces, so its depth stays as tight as possible.
+ * ---------------------------------------------------------------------------------------------*/
+
+struct DashCoverage;
+
+struct DashCoverage*
+dash_coverage_new(void);
+
+void
+dash_coverage_free(struct DashCoverage* coverage);
+
+/** Sizes the cells to view_port and clears them; call once per frame before adding occluders. */
+void
+dash_coverage_reset(
+    struct DashCoverage* coverage,
+    struct DashViewPort* view_port);
+
+/** Rasterizes the opaque front faces of a DASHCULL_VISIBLE record into the coverage. Alpha and
+ * hidden faces never occlude; textured faces only when dash's texture for them is opaque. */
+void
+dash_coverage_add_projected(
+    struct DashCoverage* coverage,
+    struct DashGraphics* dash,
+    const struct DashProjectedModel* projected,
+    struct DashViewPort* view_port);
+
+/** True when every cell under aabb is full and nearer than min_depth. */
+bool
+dash_coverage_hidden(
+    const struct DashCoverage* coverage,
+    const struct DashAABB* aabb,
+    int min_depth);
+
+/** dash3d_project_model_arena, but models fully hidden in coverage stop after the bounds test
+ * and come back with DASHCULL_CULLED_OCCLUDED. coverage may be NULL. */
+struct DashProjectedModel*
+dash3d_project_model_arena_occluded(
+    struct DashProjectionArena* arena,
+    struct DashModel* model,
+    struct DashPosition* position,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera,
+    const struct DashCoverage* coverage);
+
+/** Points the DashGraphics projection views (screen/orthographic vertices, AABBs) at a record so
+ * the existing raster and face-order entry points consume it. NULL restores the scratch. The next
+ * dash3d_project_model* call also restores the scratch. */
+void
+dash3d_projection_bind(
+    struct DashGraphics* dash,
+    const struct DashProjectedModel* projected);
+
+/** Record currently bound, or NULL when the scratch holds the projection. */
+const struct DashProjectedModel*
+dash3d_projection_bound(struct DashGraphics* dash);
+
 int
 dash3d_prepare_projected_face_order(
     struct DashGraphics* dash,
@@ -450,6 +629,54 @@ dash3d_raster_projected_model(
     int* pixel_buffer,
     bool smooth);
 
+/**
+ * Deferred band-parallel rasterization. Reset once per 3D pass, push every projected model in
+ * painter's order (instead of dash3d_raster_projected_model), then raster each tile; tiles are
+ * disjoint horizontal bands of the viewport, so they may be rastered concurrently.
+ * Projected vertices and face alphas are snapshotted at push; the rest of the model (face
+ * indices, colors, textures) is read at raster time, so pushed models must stay alive until then.
+ */
+#define DASH_TILE_HEIGHT_DEFAULT 32
+
+struct DashTileBins;
+
+struct DashTileBins*
+dash3d_tile_bins_new(void);
+
+void
+dash3d_tile_bins_free(struct DashTileBins* bins);
+
+void
+dash3d_tile_bins_reset(
+    struct DashTileBins* bins,
+    struct DashGraphics* dash,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera,
+    int tile_height);
+
+/** Sorts the model just projected into `dash` and records it. False on allocation failure. */
+bool
+dash3d_tile_bins_push_projected_model(
+    struct DashTileBins* bins,
+    struct DashGraphics* dash,
+    struct DashModel* model,
+    struct DashViewPort* view_port,
+    struct DashCamera* camera,
+    bool smooth);
+
+int
+dash3d_tile_bins_tile_count(struct DashTileBins* bins);
+
+int
+dash3d_tile_bins_draw_count(struct DashTileBins* bins);
+
+/** Thread-safe for distinct `tile` values. `pixel_buffer` is the viewport origin. */
+void
+dash3d_tile_bins_raster_tile(
+    struct DashTileBins* bins,
+    int tile,
+    int* pixel_buffer);
+
 bool
 dash3d_projected_model_contains(
     struct DashGraphics* dash,
@@ -556,6 +783,27 @@ dashmodel_new(void);
 void
 dashmodel_free(struct DashModel* model);
 
+/** Adds an owner to a Full model and returns it. Each owner calls dashmodel_free once; only the
+ * last call releases the model. Shared models must be treated as immutable (no per-owner
+ * lighting, animation or contouring). */
+struct DashModel*
+dashmodel_share(struct DashModel* model);
+
+/** True while more than one owner holds the model. */
+bool
+dashmodel_is_shared(const struct DashModel* model);
+
+/** New Full model that borrows all face, color, normal and bone data from `base` (which gains an
+ * owner) and owns only its vertex positions and face alphas, so it can be animated on its own.
+ * Animation resets from the base's vertices. Neither the base nor its instances may be relit or
+ * edited while instances exist, and the base itself must never be animated. */
+struct DashModel*
+dashmodel_new_instance(struct DashModel* base);
+
+/** The base of a dashmodel_new_instance model; NULL for every other model. */
+struct DashModel*
+dashmodel_instance_base(const struct DashModel* model);
+
 /** Frees all heap fields of `va` and `va` itself (caller-owned geometry; not called from
  * dashmodel_free). */
 void
@@ -999,6 +1247,21 @@ dashfont_draw_text_clipped_taggable(
     int clip_bottom,
     bool shadowed);
 
+/** Pen advance for glyph c (index from dashfont_charcode_to_glyph), as the dashfont_draw_text*
+ * functions apply it. */
+int
+dashfont_char_advance(
+    struct DashPixFont* pixfont,
+    int c);
+
+/** Packs a w*h int glyph mask (non-zero = ink) into DashPixFont.char_bits rows. NULL for an
+ * empty glyph or on allocation failure. */
+uint8_t*
+dashfont_pack_mask(
+    const int* mask,
+    int w,
+    int h);
+
 struct DashFontAtlas*
 dashfont_build_atlas(struct DashPixFont* pixfont);
 
@@ -1048,6 +1311,34 @@ dash2d_draw_rect(
     int height,
     int color_rgb);
 
+/** Sets the pixels of a 1-bit mask (rows of (width + 7) / 8 bytes, bit 0 leftmost, as in
+ * DashPixFont.char_bits) whose top-left lands on (x, y); clear bits leave the buffer as is. */
+void
+dash2d_fill_mask(
+    int* RESTRICT pixel_buffer,
+    int stride,
+    int x,
+    int y,
+    int width,
+    int height,
+    const uint8_t* bits,
+    int color_rgb);
+
+void
+dash2d_fill_mask_clipped(
+    int* RESTRICT pixel_buffer,
+    int stride,
+    int x,
+    int y,
+    int width,
+    int height,
+    const uint8_t* bits,
+    int color_rgb,
+    int clip_left,
+    int clip_top,
+    int clip_right,
+    int clip_bottom);
+
 void
 dash2d_fill_rect_alpha(
     int* RESTRICT pixel_buffer,
@@ -1059,6 +1350,23 @@ dash2d_fill_rect_alpha(
     int color_rgb,
     int alpha);
 
+/** dash2d_fill_rect_alpha limited to [clip_left, clip_right) x [clip_top, clip_bottom). alpha is
+ * the weight of color_rgb, in [0, 256]. */
+void
+dash2d_fill_rect_alpha_clipped(
+    int* RESTRICT pixel_buffer,
+    int stride,
+    int x,
+    int y,
+    int width,
+    int height,
+    int color_rgb,
+    int alpha,
+    int clip_left,
+    int clip_top,
+    int clip_right,
+    int clip_bottom);
+
 void
 dash2d_fill_polygon_alpha(
     int* RESTRICT pixel_buffer,
@@ -1223,6 +1531,31 @@ dash2d_blit_rotated_ex(
     }
 }
 
+/** dash2d_blit_rotated_ex through the dash2d_simd row kernels. With clip_circle, only pixels
+ *  inside the ellipse inscribed in the `dst_width`×`dst_height` rect (the minimap and compass
+ *  windows) are written, and source texels for pixels outside it are never fetched. */
+void
+dash2d_blit_rotated_masked(
+    int* RESTRICT src_buffer,
+    int src_stride,
+    int src_crop_x,
+    int src_crop_y,
+    int src_width,
+    int src_height,
+    int src_anchor_x,
+    int src_anchor_y,
+    int* RESTRICT dst_buffer,
+    int dst_stride,
+    int dst_buffer_height,
+    int dst_x,
+    int dst_y,
+    int dst_width,
+    int dst_height,
+    int dst_anchor_x,
+    int dst_anchor_y,
+    int angle_r2pi2048,
+    bool clip_circle);
+
 /** Copy `src_w`×`src_h` from `src_buffer` (row-major, pitch `src_stride`) into `dst_buffer` at
  *  (`dst_x`, `dst_y`), pitch `dst_stride`. Clips to [0, `dst_clip_w`) × [0, `dst_clip_h`). */
 static inline void
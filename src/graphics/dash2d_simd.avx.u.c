@@ -93,3 +93,230 @@ dash2d_blit_sprite_subrect_avx(
         }
     }
 }
+
+/* dash2d_fill_mask1_scalar; a whole mask byte is one 8-lane _mm256_maskstore_epi32. */
+void
+dash2d_fill_mask1_avx(
+    uint32_t* RESTRICT dst,
+    const uint8_t* RESTRICT bits,
+    int bit_x,
+    int count,
+    uint32_t rgb)
+{
+    int x = 0;
+    for( ; x < count && ((bit_x + x) & 7) != 0; x++ )
+    {
+        if( (bits[(bit_x + x) >> 3] >> ((bit_x + x) & 7)) & 1 )
+            dst[x] = rgb;
+    }
+
+    const __m256i lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    __m256i color = _mm256_set1_epi32((int)rgb);
+
+    for( ; x + 8 <= count; x += 8 )
+    {
+        int byte = bits[(bit_x + x) >> 3];
+        if( byte == 0 )
+            continue;
+
+        __m256i byte_vec = _mm256_set1_epi32(byte);
+        __m256i mask = _mm256_cmpeq_epi32(_mm256_and_si256(byte_vec, lane_bits), lane_bits);
+        _mm256_maskstore_epi32((int*)(dst + x), mask, color);
+    }
+
+    /* Lanes past count are masked off, so the store never touches them. */
+    if( x < count )
+    {
+        int byte = bits[(bit_x + x) >> 3] & ((1 << (count - x)) - 1);
+        __m256i byte_vec = _mm256_set1_epi32(byte);
+        __m256i mask = _mm256_cmpeq_epi32(_mm256_and_si256(byte_vec, lane_bits), lane_bits);
+        _mm256_maskstore_epi32((int*)(dst + x), mask, color);
+    }
+}
+
+/* Eight pixels per step through a masked gather, so lanes outside the source rect are never
+ * loaded, and a masked store that only touches opaque texels. */
+void
+dash2d_blit_rotated_row_avx(
+    uint32_t* RESTRICT dst,
+    const uint32_t* RESTRICT src,
+    int src_stride,
+    int src_w,
+    int src_h,
+    int u,
+    int v,
+    int du,
+    int dv,
+    int count)
+{
+    const __m256i neg_one = _mm256_set1_epi32(-1);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i w_vec = _mm256_set1_epi32(src_w);
+    const __m256i h_vec = _mm256_set1_epi32(src_h);
+    const __m256i stride_vec = _mm256_set1_epi32(src_stride);
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i du8 = _mm256_set1_epi32(du * 8);
+    const __m256i dv8 = _mm256_set1_epi32(dv * 8);
+    __m256i u_vec =
+        _mm256_add_epi32(_mm256_set1_epi32(u), _mm256_mullo_epi32(lane, _mm256_set1_epi32(du)));
+    __m256i v_vec =
+        _mm256_add_epi32(_mm256_set1_epi32(v), _mm256_mullo_epi32(lane, _mm256_set1_epi32(dv)));
+
+    int x = 0;
+    for( ; x + 8 <= count; x += 8 )
+    {
+        __m256i sx = _mm256_srai_epi32(u_vec, 16);
+        __m256i sy = _mm256_srai_epi32(v_vec, 16);
+        __m256i inside = _mm256_and_si256(
+            _mm256_and_si256(_mm256_cmpgt_epi32(sx, neg_one), _mm256_cmpgt_epi32(w_vec, sx)),
+            _mm256_and_si256(_mm256_cmpgt_epi32(sy, neg_one), _mm256_cmpgt_epi32(h_vec, sy)));
+        if( !_mm256_testz_si256(inside, inside) )
+        {
+            __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(sy, stride_vec), sx);
+            __m256i texels =
+                _mm256_mask_i32gather_epi32(zero, (const int*)src, index, inside, 4);
+            __m256i write = _mm256_andnot_si256(_mm256_cmpeq_epi32(texels, zero), inside);
+            _mm256_maskstore_epi32((int*)(dst + x), write, texels);
+        }
+        u_vec = _mm256_add_epi32(u_vec, du8);
+        v_vec = _mm256_add_epi32(v_vec, dv8);
+    }
+
+    u += du * x;
+    v += dv * x;
+    for( ; x < count; x++ )
+    {
+        int sx = u >> 16;
+        int sy = v >> 16;
+        if( (unsigned)sx < (unsigned)src_w && (unsigned)sy < (unsigned)src_h )
+        {
+            uint32_t texel = src[sy * src_stride + sx];
+            if( texel != 0 )
+                dst[x] = texel;
+        }
+        u += du;
+        v += dv;
+    }
+}
+
+/* Full 8-pixel stores, then one masked store for the remainder. */
+void
+dash2d_fill_row_avx(
+    uint32_t* RESTRICT dst,
+    int count,
+    uint32_t rgb)
+{
+    __m256i color = _mm256_set1_epi32((int)rgb);
+    int x = 0;
+    for( ; x + 8 <= count; x += 8 )
+        _mm256_storeu_si256((__m256i*)(dst + x), color);
+    if( x < count )
+    {
+        __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(count - x), lanes);
+        _mm256_maskstore_epi32((int*)(dst + x), mask, color);
+    }
+}
+
+/* (src_scaled + d * inv_alpha) >> 8 on 16-bit channels. The unpacks and the final pack both work
+ * within 128-bit lanes, so pixel order survives without a permute. */
+static inline __m256i
+dash2d__blend_u16_avx(
+    __m256i src_scaled,
+    __m256i d16,
+    __m256i inv_alpha)
+{
+    return _mm256_srli_epi16(_mm256_add_epi16(src_scaled, _mm256_mullo_epi16(d16, inv_alpha)), 8);
+}
+
+void
+dash2d_fill_row_alpha_avx(
+    uint32_t* RESTRICT dst,
+    int count,
+    uint32_t rgb,
+    int alpha)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i rgb_mask = _mm256_set1_epi32(0x00FFFFFF);
+    __m256i inv_alpha = _mm256_set1_epi16((short)(256 - alpha));
+    __m256i color16 = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)rgb), zero);
+    __m256i color_scaled = _mm256_mullo_epi16(color16, _mm256_set1_epi16((short)alpha));
+
+    int x = 0;
+    for( ; x + 8 <= count; x += 8 )
+    {
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dst + x));
+        __m256i lo = dash2d__blend_u16_avx(color_scaled, _mm256_unpacklo_epi8(d, zero), inv_alpha);
+        __m256i hi = dash2d__blend_u16_avx(color_scaled, _mm256_unpackhi_epi8(d, zero), inv_alpha);
+        __m256i result = _mm256_and_si256(_mm256_packus_epi16(lo, hi), rgb_mask);
+        _mm256_storeu_si256((__m256i*)(dst + x), result);
+    }
+
+    for( ; x < count; x++ )
+        dst[x] = dash2d_blend_rgb(rgb, dst[x], alpha);
+}
+
+void
+dash2d_blit_row_alpha_avx(
+    uint32_t* RESTRICT dst,
+    const uint32_t* RESTRICT src,
+    int count,
+    int alpha)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i rgb_mask = _mm256_set1_epi32(0x00FFFFFF);
+    __m256i alpha16 = _mm256_set1_epi16((short)alpha);
+    __m256i inv_alpha = _mm256_set1_epi16((short)(256 - alpha));
+
+    int x = 0;
+    for( ; x + 8 <= count; x += 8 )
+    {
+        __m256i s = _mm256_loadu_si256((const __m256i*)(src + x));
+        if( _mm256_testz_si256(s, s) )
+            continue;
+        __m256i keep = _mm256_cmpeq_epi32(s, zero);
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dst + x));
+        __m256i lo = dash2d__blend_u16_avx(
+            _mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), alpha16),
+            _mm256_unpacklo_epi8(d, zero),
+            inv_alpha);
+        __m256i hi = dash2d__blend_u16_avx(
+            _mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), alpha16),
+            _mm256_unpackhi_epi8(d, zero),
+            inv_alpha);
+        __m256i blended = _mm256_and_si256(_mm256_packus_epi16(lo, hi), rgb_mask);
+        _mm256_storeu_si256((__m256i*)(dst + x), _mm256_blendv_epi8(blended, d, keep));
+    }
+
+    for( ; x < count; x++ )
+    {
+        if( src[x] != 0 )
+            dst[x] = dash2d_blend_rgb(src[x], dst[x], alpha);
+    }
+}
+
+/* A 4-pixel tile row fits one 128-bit lane; foreground-only tiles use a masked store and never
+ * read dst. */
+void
+dash2d_fill_tile4_avx(
+    uint32_t* RESTRICT dst,
+    int stride,
+    int bits,
+    uint32_t fg,
+    uint32_t bg,
+    int write_bg)
+{
+    const __m128i lane_bits = _mm_setr_epi32(1, 2, 4, 8);
+    __m128i fg_vec = _mm_set1_epi32((int)fg);
+    __m128i bg_vec = _mm_set1_epi32((int)bg);
+    for( int row = 0; row < 4; row++ )
+    {
+        __m128i row_bits = _mm_set1_epi32((bits >> (row * 4)) & 0xF);
+        __m128i mask = _mm_cmpeq_epi32(_mm_and_si128(row_bits, lane_bits), lane_bits);
+        if( write_bg )
+            _mm_storeu_si128((__m128i*)dst, _mm_blendv_epi8(bg_vec, fg_vec, mask));
+        else
+            _mm_maskstore_epi32((int*)dst, mask, fg_vec);
+        dst += stride;
+    }
+}
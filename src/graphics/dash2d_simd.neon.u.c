@@ -102,3 +102,248 @@ dash2d_blit_sprite_subrect_neon(
         }
     }
 }
+
+/* The kernels below have not been built or run through dash2d_simd_test.c on aarch64 yet, so
+ * they are opt-in; without DASH2D_NEON_ROW_KERNELS NEON builds use the scalar ones. */
+#ifdef DASH2D_NEON_ROW_KERNELS
+
+/* dash2d_fill_mask1_scalar; a whole mask byte is two vtstq/vbslq selects. */
+void
+dash2d_fill_mask1_neon(
+    uint32_t* RESTRICT dst,
+    const uint8_t* RESTRICT bits,
+    int bit_x,
+    int count,
+    uint32_t rgb)
+{
+    int x = 0;
+    for( ; x < count && ((bit_x + x) & 7) != 0; x++ )
+    {
+        if( (bits[(bit_x + x) >> 3] >> ((bit_x + x) & 7)) & 1 )
+            dst[x] = rgb;
+    }
+
+    static const uint32_t lane_bits[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint32x4_t lo_bits = vld1q_u32(lane_bits);
+    uint32x4_t hi_bits = vld1q_u32(lane_bits + 4);
+    uint32x4_t color = vdupq_n_u32(rgb);
+
+    for( ; x + 8 <= count; x += 8 )
+    {
+        uint32_t byte = bits[(bit_x + x) >> 3];
+        if( byte == 0 )
+            continue;
+        if( byte == 0xff )
+        {
+            vst1q_u32(dst + x, color);
+            vst1q_u32(dst + x + 4, color);
+            continue;
+        }
+
+        uint32x4_t byte_vec = vdupq_n_u32(byte);
+        /* All ones in lanes whose bit is set. */
+        uint32x4_t lo_mask = vtstq_u32(byte_vec, lo_bits);
+        uint32x4_t hi_mask = vtstq_u32(byte_vec, hi_bits);
+        vst1q_u32(dst + x, vbslq_u32(lo_mask, color, vld1q_u32(dst + x)));
+        vst1q_u32(dst + x + 4, vbslq_u32(hi_mask, color, vld1q_u32(dst + x + 4)));
+    }
+
+    if( x < count )
+    {
+        uint32_t byte = bits[(bit_x + x) >> 3] & ((1u << (count - x)) - 1);
+        if( count - x >= 4 )
+        {
+            uint32x4_t lo_mask = vtstq_u32(vdupq_n_u32(byte), lo_bits);
+            vst1q_u32(dst + x, vbslq_u32(lo_mask, color, vld1q_u32(dst + x)));
+            x += 4;
+            byte >>= 4;
+        }
+        for( int i = 0; byte != 0; i++, byte >>= 1 )
+        {
+            if( byte & 1 )
+                dst[x + i] = rgb;
+        }
+    }
+}
+
+/* NEON has no gather: indices are computed 4 wide with vmlaq, the loads are scalar (lanes outside
+ * the source rect read texel 0), and vbsl writes the opaque texels. */
+void
+dash2d_blit_rotated_row_neon(
+    uint32_t* RESTRICT dst,
+    const uint32_t* RESTRICT src,
+    int src_stride,
+    int src_w,
+    int src_h,
+    int u,
+    int v,
+    int du,
+    int dv,
+    int count)
+{
+    const int32_t lane_init[4] = { 0, 1, 2, 3 };
+    const int32x4_t lane = vld1q_s32(lane_init);
+    const uint32x4_t w_vec = vdupq_n_u32((uint32_t)src_w);
+    const uint32x4_t h_vec = vdupq_n_u32((uint32_t)src_h);
+    const int32x4_t du4 = vdupq_n_s32(du * 4);
+    const int32x4_t dv4 = vdupq_n_s32(dv * 4);
+    int32x4_t u_vec = vmlaq_n_s32(vdupq_n_s32(u), lane, du);
+    int32x4_t v_vec = vmlaq_n_s32(vdupq_n_s32(v), lane, dv);
+
+    int x = 0;
+    for( ; x + 4 <= count; x += 4 )
+    {
+        int32x4_t sx = vshrq_n_s32(u_vec, 16);
+        int32x4_t sy = vshrq_n_s32(v_vec, 16);
+        /* Unsigned compare folds the >= 0 test in. */
+        uint32x4_t inside = vandq_u32(
+            vcltq_u32(vreinterpretq_u32_s32(sx), w_vec),
+            vcltq_u32(vreinterpretq_u32_s32(sy), h_vec));
+        uint32x2_t any = vorr_u32(vget_low_u32(inside), vget_high_u32(inside));
+        if( (vget_lane_u32(any, 0) | vget_lane_u32(any, 1)) != 0 )
+        {
+            uint32x4_t index = vandq_u32(
+                vreinterpretq_u32_s32(vmlaq_n_s32(sx, sy, src_stride)), inside);
+            uint32_t index_lane[4];
+            vst1q_u32(index_lane, index);
+            uint32_t texel_lane[4] = {
+                src[index_lane[0]], src[index_lane[1]], src[index_lane[2]], src[index_lane[3]]
+            };
+            uint32x4_t texels = vld1q_u32(texel_lane);
+            uint32x4_t write = vandq_u32(vtstq_u32(texels, texels), inside);
+            vst1q_u32(dst + x, vbslq_u32(write, texels, vld1q_u32(dst + x)));
+        }
+        u_vec = vaddq_s32(u_vec, du4);
+        v_vec = vaddq_s32(v_vec, dv4);
+    }
+
+    u += du * x;
+    v += dv * x;
+    for( ; x < count; x++ )
+    {
+        int sx = u >> 16;
+        int sy = v >> 16;
+        if( (unsigned)sx < (unsigned)src_w && (unsigned)sy < (unsigned)src_h )
+        {
+            uint32_t texel = src[sy * src_stride + sx];
+            if( texel != 0 )
+                dst[x] = texel;
+        }
+        u += du;
+        v += dv;
+    }
+}
+
+void
+dash2d_fill_row_neon(
+    uint32_t* RESTRICT dst,
+    int count,
+    uint32_t rgb)
+{
+    uint32x4_t color = vdupq_n_u32(rgb);
+    int x = 0;
+    for( ; x + 8 <= count; x += 8 )
+    {
+        vst1q_u32(dst + x, color);
+        vst1q_u32(dst + x + 4, color);
+    }
+    for( ; x + 4 <= count; x += 4 )
+        vst1q_u32(dst + x, color);
+    for( ; x < count; x++ )
+        dst[x] = rgb;
+}
+
+/* Four pixels as 16 bytes widened to two u16x8 halves: (src_scaled + d * inv_alpha) >> 8, then
+ * narrowed back. Products stay below 2^16 for alpha in [0, 256]. */
+static inline uint32x4_t
+dash2d__blend4_neon(
+    uint16x8_t src_scaled_lo,
+    uint16x8_t src_scaled_hi,
+    uint32x4_t d,
+    uint16x8_t inv_alpha)
+{
+    uint8x16_t d8 = vreinterpretq_u8_u32(d);
+    uint16x8_t lo = vshrq_n_u16(vmlaq_u16(src_scaled_lo, vmovl_u8(vget_low_u8(d8)), inv_alpha), 8);
+    uint16x8_t hi = vshrq_n_u16(vmlaq_u16(src_scaled_hi, vmovl_u8(vget_high_u8(d8)), inv_alpha), 8);
+    uint32x4_t out = vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+    return vandq_u32(out, vdupq_n_u32(0x00FFFFFF));
+}
+
+void
+dash2d_fill_row_alpha_neon(
+    uint32_t* RESTRICT dst,
+    int count,
+    uint32_t rgb,
+    int alpha)
+{
+    uint16x8_t inv_alpha = vdupq_n_u16((uint16_t)(256 - alpha));
+    uint8x16_t color8 = vreinterpretq_u8_u32(vdupq_n_u32(rgb));
+    uint16x8_t color_scaled = vmulq_n_u16(vmovl_u8(vget_low_u8(color8)), (uint16_t)alpha);
+
+    int x = 0;
+    for( ; x + 4 <= count; x += 4 )
+    {
+        uint32x4_t d = vld1q_u32(dst + x);
+        vst1q_u32(dst + x, dash2d__blend4_neon(color_scaled, color_scaled, d, inv_alpha));
+    }
+
+    for( ; x < count; x++ )
+        dst[x] = dash2d_blend_rgb(rgb, dst[x], alpha);
+}
+
+void
+dash2d_blit_row_alpha_neon(
+    uint32_t* RESTRICT dst,
+    const uint32_t* RESTRICT src,
+    int count,
+    int alpha)
+{
+    uint16x8_t inv_alpha = vdupq_n_u16((uint16_t)(256 - alpha));
+
+    int x = 0;
+    for( ; x + 4 <= count; x += 4 )
+    {
+        uint32x4_t s = vld1q_u32(src + x);
+        uint32x2_t any = vorr_u32(vget_low_u32(s), vget_high_u32(s));
+        if( (vget_lane_u32(any, 0) | vget_lane_u32(any, 1)) == 0 )
+            continue;
+        uint32x4_t keep = vceqq_u32(s, vdupq_n_u32(0));
+        uint32x4_t d = vld1q_u32(dst + x);
+        uint8x16_t s8 = vreinterpretq_u8_u32(s);
+        uint16x8_t s_lo = vmulq_n_u16(vmovl_u8(vget_low_u8(s8)), (uint16_t)alpha);
+        uint16x8_t s_hi = vmulq_n_u16(vmovl_u8(vget_high_u8(s8)), (uint16_t)alpha);
+        uint32x4_t blended = dash2d__blend4_neon(s_lo, s_hi, d, inv_alpha);
+        vst1q_u32(dst + x, vbslq_u32(keep, d, blended));
+    }
+
+    for( ; x < count; x++ )
+    {
+        if( src[x] != 0 )
+            dst[x] = dash2d_blend_rgb(src[x], dst[x], alpha);
+    }
+}
+
+/* dash2d_fill_tile4_scalar; vtst turns the row nibble into a lane mask for vbsl. */
+void
+dash2d_fill_tile4_neon(
+    uint32_t* RESTRICT dst,
+    int stride,
+    int bits,
+    uint32_t fg,
+    uint32_t bg,
+    int write_bg)
+{
+    static const uint32_t lane_bit_values[4] = { 1, 2, 4, 8 };
+    uint32x4_t lane_bits = vld1q_u32(lane_bit_values);
+    uint32x4_t fg_vec = vdupq_n_u32(fg);
+    uint32x4_t bg_vec = vdupq_n_u32(bg);
+    for( int row = 0; row < 4; row++ )
+    {
+        uint32x4_t mask = vtstq_u32(vdupq_n_u32((uint32_t)(bits >> (row * 4)) & 0xF), lane_bits);
+        uint32x4_t base = write_bg ? bg_vec : vld1q_u32(dst);
+        vst1q_u32(dst, vbslq_u32(mask, fg_vec, base));
+        dst += stride;
+    }
+}
+
+#endif
@@ -1,3 +1,6 @@
+#ifndef DASH2D_SIMD_SCALAR_U_C
+#define DASH2D_SIMD_SCALAR_U_C
+
 #include "dash.h"
 
 #include <stdint.h>
@@ -81,3 +84,139 @@ dash2d_blit_sprite_subrect_scalar(
         dst_ptr += dst_stride;
     }
 }
+
+/* Writes rgb to dst[i] for every set bit i of mask bits [bit_x, bit_x + count) of a 1-bit glyph
+ * row (bit 0 of bits[0] is the leftmost pixel). Empty mask bytes are skipped whole. */
+void
+dash2d_fill_mask1_scalar(
+    uint32_t* RESTRICT dst,
+    const uint8_t* RESTRICT bits,
+    int bit_x,
+    int count,
+    uint32_t rgb)
+{
+    int x = 0;
+    for( ; x < count && ((bit_x + x) & 7) != 0; x++ )
+    {
+        if( (bits[(bit_x + x) >> 3] >> ((bit_x + x) & 7)) & 1 )
+            dst[x] = rgb;
+    }
+
+    for( ; x + 8 <= count; x += 8 )
+    {
+        int byte = bits[(bit_x + x) >> 3];
+        for( int i = 0; byte != 0; i++, byte >>= 1 )
+        {
+            if( byte & 1 )
+                dst[x + i] = rgb;
+        }
+    }
+
+    if( x < count )
+    {
+        int byte = bits[(bit_x + x) >> 3] & ((1 << (count - x)) - 1);
+        for( int i = 0; byte != 0; i++, byte >>= 1 )
+        {
+            if( byte & 1 )
+                dst[x + i] = rgb;
+        }
+    }
+}
+
+/* One destination row of a rotated blit. Pixel i samples src at ((u + i * du) >> 16,
+ * (v + i * dv) >> 16) in 16.16 fixed point; texels outside [0, src_w) x [0, src_h) and zero
+ * (transparent) texels leave dst as is. src is the top-left of the source rect, src_stride its
+ * row pitch in pixels. */
+void
+dash2d_blit_rotated_row_scalar(
+    uint32_t* RESTRICT dst,
+    const uint32_t* RESTRICT src,
+    int src_stride,
+    int src_w,
+    int src_h,
+    int u,
+    int v,
+    int du,
+    int dv,
+    int count)
+{
+    for( int x = 0; x < count; x++ )
+    {
+        int sx = u >> 16;
+        int sy = v >> 16;
+        if( (unsigned)sx < (unsigned)src_w && (unsigned)sy < (unsigned)src_h )
+        {
+            uint32_t texel = src[sy * src_stride + sx];
+            if( texel != 0 )
+                dst[x] = texel;
+        }
+        u += du;
+        v += dv;
+    }
+}
+
+/* Writes rgb to dst[0, count). */
+void
+dash2d_fill_row_scalar(
+    uint32_t* RESTRICT dst,
+    int count,
+    uint32_t rgb)
+{
+    for( int x = 0; x < count; x++ )
+        dst[x] = rgb;
+}
+
+/* Blends rgb over dst[0, count) with dash2d_blend_rgb. alpha is in [0, 256], which keeps every
+ * channel product within 16 bits for the vector variants. */
+void
+dash2d_fill_row_alpha_scalar(
+    uint32_t* RESTRICT dst,
+    int count,
+    uint32_t rgb,
+    int alpha)
+{
+    for( int x = 0; x < count; x++ )
+        dst[x] = dash2d_blend_rgb(rgb, dst[x], alpha);
+}
+
+/* dash2d_fill_row_alpha_scalar with a per-pixel source color; zero (transparent) source pixels
+ * leave dst as is. */
+void
+dash2d_blit_row_alpha_scalar(
+    uint32_t* RESTRICT dst,
+    const uint32_t* RESTRICT src,
+    int count,
+    int alpha)
+{
+    for( int x = 0; x < count; x++ )
+    {
+        if( src[x] != 0 )
+            dst[x] = dash2d_blend_rgb(src[x], dst[x], alpha);
+    }
+}
+
+/* Fills a 4x4 minimap tile. Bit (row * 4 + col) of bits selects fg for that pixel; clear bits
+ * take bg when write_bg is set and are left alone otherwise. */
+void
+dash2d_fill_tile4_scalar(
+    uint32_t* RESTRICT dst,
+    int stride,
+    int bits,
+    uint32_t fg,
+    uint32_t bg,
+    int write_bg)
+{
+    for( int row = 0; row < 4; row++ )
+    {
+        for( int col = 0; col < 4; col++ )
+        {
+            if( (bits >> (row * 4 + col)) & 1 )
+                dst[col] = fg;
+            else if( write_bg )
+                dst[col] = bg;
+        }
+        dst += stride;
+    }
+}
+
+#endif
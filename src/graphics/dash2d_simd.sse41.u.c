@@ -81,3 +81,249 @@ dash2d_blit_sprite_subrect_sse41(
         }
     }
 }
+
+/* dash2d_fill_mask1_scalar with _mm_blendv_epi8 per 4 pixels of a whole mask byte. */
+void
+dash2d_fill_mask1_sse41(
+    uint32_t* RESTRICT dst,
+    const uint8_t* RESTRICT bits,
+    int bit_x,
+    int count,
+    uint32_t rgb)
+{
+    int x = 0;
+    for( ; x < count && ((bit_x + x) & 7) != 0; x++ )
+    {
+        if( (bits[(bit_x + x) >> 3] >> ((bit_x + x) & 7)) & 1 )
+            dst[x] = rgb;
+    }
+
+    const __m128i lo_bits = _mm_setr_epi32(1, 2, 4, 8);
+    const __m128i hi_bits = _mm_setr_epi32(16, 32, 64, 128);
+    __m128i color = _mm_set1_epi32((int)rgb);
+
+    for( ; x + 8 <= count; x += 8 )
+    {
+        int byte = bits[(bit_x + x) >> 3];
+        if( byte == 0 )
+            continue;
+        if( byte == 0xff )
+        {
+            _mm_storeu_si128((__m128i*)(dst + x), color);
+            _mm_storeu_si128((__m128i*)(dst + x + 4), color);
+            continue;
+        }
+
+        __m128i byte_vec = _mm_set1_epi32(byte);
+        __m128i lo_mask = _mm_cmpeq_epi32(_mm_and_si128(byte_vec, lo_bits), lo_bits);
+        __m128i hi_mask = _mm_cmpeq_epi32(_mm_and_si128(byte_vec, hi_bits), hi_bits);
+        __m128i lo_dst = _mm_loadu_si128((const __m128i*)(dst + x));
+        __m128i hi_dst = _mm_loadu_si128((const __m128i*)(dst + x + 4));
+        _mm_storeu_si128((__m128i*)(dst + x), _mm_blendv_epi8(lo_dst, color, lo_mask));
+        _mm_storeu_si128((__m128i*)(dst + x + 4), _mm_blendv_epi8(hi_dst, color, hi_mask));
+    }
+
+    if( x < count )
+    {
+        int byte = bits[(bit_x + x) >> 3] & ((1 << (count - x)) - 1);
+        if( count - x >= 4 )
+        {
+            __m128i lo_mask =
+                _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(byte), lo_bits), lo_bits);
+            __m128i lo_dst = _mm_loadu_si128((const __m128i*)(dst + x));
+            _mm_storeu_si128((__m128i*)(dst + x), _mm_blendv_epi8(lo_dst, color, lo_mask));
+            x += 4;
+            byte >>= 4;
+        }
+        for( int i = 0; byte != 0; i++, byte >>= 1 )
+        {
+            if( byte & 1 )
+                dst[x + i] = rgb;
+        }
+    }
+}
+
+/* Four pixels per step: texel indices come from _mm_mullo_epi32, out-of-rect lanes are pointed
+ * at texel 0 so the four scalar loads are always in bounds, and blendv writes the opaque ones. */
+void
+dash2d_blit_rotated_row_sse41(
+    uint32_t* RESTRICT dst,
+    const uint32_t* RESTRICT src,
+    int src_stride,
+    int src_w,
+    int src_h,
+    int u,
+    int v,
+    int du,
+    int dv,
+    int count)
+{
+    const __m128i neg_one = _mm_set1_epi32(-1);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i w_vec = _mm_set1_epi32(src_w);
+    const __m128i h_vec = _mm_set1_epi32(src_h);
+    const __m128i stride_vec = _mm_set1_epi32(src_stride);
+    const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i du4 = _mm_set1_epi32(du * 4);
+    const __m128i dv4 = _mm_set1_epi32(dv * 4);
+    __m128i u_vec = _mm_add_epi32(_mm_set1_epi32(u), _mm_mullo_epi32(lane, _mm_set1_epi32(du)));
+    __m128i v_vec = _mm_add_epi32(_mm_set1_epi32(v), _mm_mullo_epi32(lane, _mm_set1_epi32(dv)));
+
+    int x = 0;
+    for( ; x + 4 <= count; x += 4 )
+    {
+        __m128i sx = _mm_srai_epi32(u_vec, 16);
+        __m128i sy = _mm_srai_epi32(v_vec, 16);
+        __m128i inside = _mm_and_si128(
+            _mm_and_si128(_mm_cmpgt_epi32(sx, neg_one), _mm_cmpgt_epi32(w_vec, sx)),
+            _mm_and_si128(_mm_cmpgt_epi32(sy, neg_one), _mm_cmpgt_epi32(h_vec, sy)));
+        if( !_mm_testz_si128(inside, inside) )
+        {
+            __m128i index =
+                _mm_and_si128(_mm_add_epi32(_mm_mullo_epi32(sy, stride_vec), sx), inside);
+            __m128i texels = _mm_setr_epi32(
+                (int)src[_mm_cvtsi128_si32(index)],
+                (int)src[_mm_extract_epi32(index, 1)],
+                (int)src[_mm_extract_epi32(index, 2)],
+                (int)src[_mm_extract_epi32(index, 3)]);
+            __m128i write = _mm_andnot_si128(_mm_cmpeq_epi32(texels, zero), inside);
+            __m128i dst_pixels = _mm_loadu_si128((const __m128i*)(dst + x));
+            _mm_storeu_si128((__m128i*)(dst + x), _mm_blendv_epi8(dst_pixels, texels, write));
+        }
+        u_vec = _mm_add_epi32(u_vec, du4);
+        v_vec = _mm_add_epi32(v_vec, dv4);
+    }
+
+    u += du * x;
+    v += dv * x;
+    for( ; x < count; x++ )
+    {
+        int sx = u >> 16;
+        int sy = v >> 16;
+        if( (unsigned)sx < (unsigned)src_w && (unsigned)sy < (unsigned)src_h )
+        {
+            uint32_t texel = src[sy * src_stride + sx];
+            if( texel != 0 )
+                dst[x] = texel;
+        }
+        u += du;
+        v += dv;
+    }
+}
+
+void
+dash2d_fill_row_sse41(
+    uint32_t* RESTRICT dst,
+    int count,
+    uint32_t rgb)
+{
+    __m128i color = _mm_set1_epi32((int)rgb);
+    int x = 0;
+    for( ; x + 8 <= count; x += 8 )
+    {
+        _mm_storeu_si128((__m128i*)(dst + x), color);
+        _mm_storeu_si128((__m128i*)(dst + x + 4), color);
+    }
+    for( ; x + 4 <= count; x += 4 )
+        _mm_storeu_si128((__m128i*)(dst + x), color);
+    for( ; x < count; x++ )
+        dst[x] = rgb;
+}
+
+/* (src_scaled + d * inv_alpha) >> 8 on 16-bit channels, see dash2d_fill_row_alpha_scalar. */
+static inline __m128i
+dash2d__blend_u16_sse41(
+    __m128i src_scaled,
+    __m128i d16,
+    __m128i inv_alpha)
+{
+    return _mm_srli_epi16(_mm_add_epi16(src_scaled, _mm_mullo_epi16(d16, inv_alpha)), 8);
+}
+
+/* dash2d_fill_row_alpha_scalar; channels widen with pmovzxbw instead of unpacking against zero. */
+void
+dash2d_fill_row_alpha_sse41(
+    uint32_t* RESTRICT dst,
+    int count,
+    uint32_t rgb,
+    int alpha)
+{
+    const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+    __m128i inv_alpha = _mm_set1_epi16((short)(256 - alpha));
+    __m128i color_scaled =
+        _mm_mullo_epi16(_mm_cvtepu8_epi16(_mm_set1_epi32((int)rgb)), _mm_set1_epi16((short)alpha));
+
+    int x = 0;
+    for( ; x + 4 <= count; x += 4 )
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + x));
+        __m128i lo = dash2d__blend_u16_sse41(color_scaled, _mm_cvtepu8_epi16(d), inv_alpha);
+        __m128i d_hi = _mm_cvtepu8_epi16(_mm_srli_si128(d, 8));
+        __m128i hi = dash2d__blend_u16_sse41(color_scaled, d_hi, inv_alpha);
+        _mm_storeu_si128((__m128i*)(dst + x), _mm_and_si128(_mm_packus_epi16(lo, hi), rgb_mask));
+    }
+
+    for( ; x < count; x++ )
+        dst[x] = dash2d_blend_rgb(rgb, dst[x], alpha);
+}
+
+/* dash2d_blit_row_alpha_scalar; zero source lanes keep dst through blendv. */
+void
+dash2d_blit_row_alpha_sse41(
+    uint32_t* RESTRICT dst,
+    const uint32_t* RESTRICT src,
+    int count,
+    int alpha)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+    __m128i alpha16 = _mm_set1_epi16((short)alpha);
+    __m128i inv_alpha = _mm_set1_epi16((short)(256 - alpha));
+
+    int x = 0;
+    for( ; x + 4 <= count; x += 4 )
+    {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + x));
+        if( _mm_testz_si128(s, s) )
+            continue;
+        __m128i keep = _mm_cmpeq_epi32(s, zero);
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + x));
+        __m128i lo = dash2d__blend_u16_sse41(
+            _mm_mullo_epi16(_mm_cvtepu8_epi16(s), alpha16), _mm_cvtepu8_epi16(d), inv_alpha);
+        __m128i hi = dash2d__blend_u16_sse41(
+            _mm_mullo_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(s, 8)), alpha16),
+            _mm_cvtepu8_epi16(_mm_srli_si128(d, 8)),
+            inv_alpha);
+        __m128i blended = _mm_and_si128(_mm_packus_epi16(lo, hi), rgb_mask);
+        _mm_storeu_si128((__m128i*)(dst + x), _mm_blendv_epi8(blended, d, keep));
+    }
+
+    for( ; x < count; x++ )
+    {
+        if( src[x] != 0 )
+            dst[x] = dash2d_blend_rgb(src[x], dst[x], alpha);
+    }
+}
+
+/* dash2d_fill_tile4_scalar; each tile row is one blendv. */
+void
+dash2d_fill_tile4_sse41(
+    uint32_t* RESTRICT dst,
+    int stride,
+    int bits,
+    uint32_t fg,
+    uint32_t bg,
+    int write_bg)
+{
+    const __m128i lane_bits = _mm_setr_epi32(1, 2, 4, 8);
+    __m128i fg_vec = _mm_set1_epi32((int)fg);
+    __m128i bg_vec = _mm_set1_epi32((int)bg);
+    for( int row = 0; row < 4; row++ )
+    {
+        __m128i row_bits = _mm_set1_epi32((bits >> (row * 4)) & 0xF);
+        __m128i mask = _mm_cmpeq_epi32(_mm_and_si128(row_bits, lane_bits), lane_bits);
+        __m128i base = write_bg ? bg_vec : _mm_loadu_si128((const __m128i*)dst);
+        _mm_storeu_si128((__m128i*)dst, _mm_blendv_epi8(base, fg_vec, mask));
+        dst += stride;
+    }
+}
@@ -3,21 +3,81 @@
 
 #include <stdint.h>
 
+/* (s * alpha + d * (256 - alpha)) >> 8 per RGB channel; the top byte of the result is 0. */
+static inline uint32_t
+dash2d_blend_rgb(
+    uint32_t s,
+    uint32_t d,
+    int alpha)
+{
+    int inv = 256 - alpha;
+    int r = ((int)((s >> 16) & 0xFF) * alpha + (int)((d >> 16) & 0xFF) * inv) >> 8;
+    int g = ((int)((s >> 8) & 0xFF) * alpha + (int)((d >> 8) & 0xFF) * inv) >> 8;
+    int b = ((int)(s & 0xFF) * alpha + (int)(d & 0xFF) * inv) >> 8;
+    return (uint32_t)((r << 16) | (g << 8) | b);
+}
+
 #if ( defined(__ARM_NEON) || defined(__ARM_NEON__) ) && !defined(NEON_DISABLED)
 #include "dash2d_simd.neon.u.c"
+#define DASH2D_SIMD_ISA "neon"
 #define dash2d_blit_sprite_subrect_fast dash2d_blit_sprite_subrect_neon
+#ifdef DASH2D_NEON_ROW_KERNELS
+#define dash2d_fill_mask1_fast dash2d_fill_mask1_neon
+#define dash2d_blit_rotated_row_fast dash2d_blit_rotated_row_neon
+#define dash2d_fill_row_fast dash2d_fill_row_neon
+#define dash2d_fill_row_alpha_fast dash2d_fill_row_alpha_neon
+#define dash2d_blit_row_alpha_fast dash2d_blit_row_alpha_neon
+#define dash2d_fill_tile4_fast dash2d_fill_tile4_neon
+#else
+/* Unverified NEON row kernels are opt-in; see dash2d_simd.neon.u.c. */
+#include "dash2d_simd.scalar.u.c"
+#define dash2d_fill_mask1_fast dash2d_fill_mask1_scalar
+#define dash2d_blit_rotated_row_fast dash2d_blit_rotated_row_scalar
+#define dash2d_fill_row_fast dash2d_fill_row_scalar
+#define dash2d_fill_row_alpha_fast dash2d_fill_row_alpha_scalar
+#define dash2d_blit_row_alpha_fast dash2d_blit_row_alpha_scalar
+#define dash2d_fill_tile4_fast dash2d_fill_tile4_scalar
+#endif
 #elif defined(__AVX2__) && !defined(AVX2_DISABLED)
 #include "dash2d_simd.avx.u.c"
+#define DASH2D_SIMD_ISA "avx2"
 #define dash2d_blit_sprite_subrect_fast dash2d_blit_sprite_subrect_avx
+#define dash2d_fill_mask1_fast dash2d_fill_mask1_avx
+#define dash2d_blit_rotated_row_fast dash2d_blit_rotated_row_avx
+#define dash2d_fill_row_fast dash2d_fill_row_avx
+#define dash2d_fill_row_alpha_fast dash2d_fill_row_alpha_avx
+#define dash2d_blit_row_alpha_fast dash2d_blit_row_alpha_avx
+#define dash2d_fill_tile4_fast dash2d_fill_tile4_avx
 #elif defined(__SSE4_1__) && !defined(SSE2_DISABLED)
 #include "dash2d_simd.sse41.u.c"
+#define DASH2D_SIMD_ISA "sse4.1"
 #define dash2d_blit_sprite_subrect_fast dash2d_blit_sprite_subrect_sse41
+#define dash2d_fill_mask1_fast dash2d_fill_mask1_sse41
+#define dash2d_blit_rotated_row_fast dash2d_blit_rotated_row_sse41
+#define dash2d_fill_row_fast dash2d_fill_row_sse41
+#define dash2d_fill_row_alpha_fast dash2d_fill_row_alpha_sse41
+#define dash2d_blit_row_alpha_fast dash2d_blit_row_alpha_sse41
+#define dash2d_fill_tile4_fast dash2d_fill_tile4_sse41
 #elif defined(__SSE2__) && !defined(SSE2_DISABLED)
 #include "dash2d_simd.sse2.u.c"
+#define DASH2D_SIMD_ISA "sse2"
 #define dash2d_blit_sprite_subrect_fast dash2d_blit_sprite_subrect_sse2
+#define dash2d_fill_mask1_fast dash2d_fill_mask1_sse2
+#define dash2d_blit_rotated_row_fast dash2d_blit_rotated_row_sse2
+#define dash2d_fill_row_fast dash2d_fill_row_sse2
+#define dash2d_fill_row_alpha_fast dash2d_fill_row_alpha_sse2
+#define dash2d_blit_row_alpha_fast dash2d_blit_row_alpha_sse2
+#define dash2d_fill_tile4_fast dash2d_fill_tile4_sse2
 #else
 #include "dash2d_simd.scalar.u.c"
+#define DASH2D_SIMD_ISA "scalar"
 #define dash2d_blit_sprite_subrect_fast dash2d_blit_sprite_subrect_scalar
+#define dash2d_fill_mask1_fast dash2d_fill_mask1_scalar
+#define dash2d_blit_rotated_row_fast dash2d_blit_rotated_row_scalar
+#define dash2d_fill_row_fast dash2d_fill_row_scalar
+#define dash2d_fill_row_alpha_fast dash2d_fill_row_alpha_scalar
+#define dash2d_blit_row_alpha_fast dash2d_blit_row_alpha_scalar
+#define dash2d_fill_tile4_fast dash2d_fill_tile4_scalar
 #endif
 
 #endif
@@ -0,0 +1,236 @@
+/* Parity test for the dash2d_simd kernels: every *_fast kernel picked by dash2d_simd.u.c for this
+ * build must write exactly what its *_scalar reference writes, and nothing outside its span.
+ *
+ * Build once per instruction set from src/, e.g.
+ *   cc -O2 -I. -Igraphics -msse2 -mno-sse4.1 graphics/dash2d_simd_test.c -o dash2d_simd_test
+ *   cc -O2 -I. -Igraphics -msse4.1 graphics/dash2d_simd_test.c -o dash2d_simd_test
+ *   cc -O2 -I. -Igraphics -mavx2 graphics/dash2d_simd_test.c -o dash2d_simd_test
+ */
+#include "dash.h"
+
+#include "dash2d_simd.u.c"
+#include "dash2d_simd.scalar.u.c"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ROW_MAX 96
+#define GUARD 8
+#define SENTINEL 0xDEADBEEFu
+#define ITERATIONS 20000
+
+static uint32_t g_rng = 0x12345678u;
+
+static uint32_t
+rng_next(void)
+{
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 17;
+    g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+/* Sprite-like pixels: a quarter are transparent (0), the rest have random alpha bytes so kernels
+ * that clear the top byte are checked too. */
+static uint32_t
+rng_pixel(void)
+{
+    return (rng_next() & 3) == 0 ? 0 : rng_next() | 1;
+}
+
+static void
+fill_random(
+    uint32_t* buf,
+    int count)
+{
+    for( int i = 0; i < count; i++ )
+        buf[i] = rng_pixel();
+}
+
+static int
+check_equal(
+    const char* kernel,
+    const uint32_t* expected,
+    const uint32_t* actual,
+    int count,
+    int iteration)
+{
+    if( memcmp(expected, actual, (size_t)count * sizeof(uint32_t)) == 0 )
+        return 0;
+    for( int i = 0; i < count; i++ )
+    {
+        if( expected[i] != actual[i] )
+        {
+            printf(
+                "%s: mismatch at %d (iteration %d): expected %08x got %08x\n",
+                kernel,
+                i,
+                iteration,
+                expected[i],
+                actual[i]);
+            break;
+        }
+    }
+    return 1;
+}
+
+/* Destination rows are [GUARD, GUARD + count) of a sentinel-padded buffer; the start is offset by
+ * up to 3 pixels so unaligned heads are covered. */
+static int
+test_rows(void)
+{
+    uint32_t ref[GUARD + ROW_MAX + 3 + GUARD];
+    uint32_t out[GUARD + ROW_MAX + 3 + GUARD];
+    uint32_t src[ROW_MAX + 3];
+    uint8_t bits[(ROW_MAX + 16) / 8 + 1];
+    int total = GUARD + ROW_MAX + 3 + GUARD;
+    int failures = 0;
+
+    for( int it = 0; it < ITERATIONS; it++ )
+    {
+        int count = (int)(rng_next() % (ROW_MAX + 1));
+        int head = GUARD + (int)(rng_next() & 3);
+        uint32_t rgb = rng_next();
+        int alpha = (int)(rng_next() % 257);
+
+        fill_random(ref, total);
+        for( int i = 0; i < head; i++ )
+            ref[i] = SENTINEL;
+        for( int i = head + count; i < total; i++ )
+            ref[i] = SENTINEL;
+        fill_random(src, ROW_MAX + 3);
+        if( (it & 7) == 0 )
+            memset(src, 0, sizeof(src));
+
+        memcpy(out, ref, sizeof(ref));
+        dash2d_fill_row_scalar(ref + head, count, rgb);
+        dash2d_fill_row_fast(out + head, count, rgb);
+        failures += check_equal("fill_row", ref, out, total, it);
+
+        memcpy(out, ref, sizeof(ref));
+        dash2d_fill_row_alpha_scalar(ref + head, count, rgb, alpha);
+        dash2d_fill_row_alpha_fast(out + head, count, rgb, alpha);
+        failures += check_equal("fill_row_alpha", ref, out, total, it);
+
+        memcpy(out, ref, sizeof(ref));
+        dash2d_blit_row_alpha_scalar(ref + head, src, count, alpha);
+        dash2d_blit_row_alpha_fast(out + head, src, count, alpha);
+        failures += check_equal("blit_row_alpha", ref, out, total, it);
+
+        for( size_t i = 0; i < sizeof(bits); i++ )
+            bits[i] = (uint8_t)((it & 3) == 0 ? 0xFF : rng_next());
+        int bit_x = (int)(rng_next() & 15);
+        memcpy(out, ref, sizeof(ref));
+        dash2d_fill_mask1_scalar(ref + head, bits, bit_x, count, rgb);
+        dash2d_fill_mask1_fast(out + head, bits, bit_x, count, rgb);
+        failures += check_equal("fill_mask1", ref, out, total, it);
+
+        int src_w = 1 + (int)(rng_next() % 40);
+        int src_h = 1 + (int)(rng_next() % 40);
+        int u = (int)(rng_next() % ((src_w + 16) << 16)) - (8 << 16);
+        int v = (int)(rng_next() % ((src_h + 16) << 16)) - (8 << 16);
+        int du = (int)(rng_next() % 131072) - 65536;
+        int dv = (int)(rng_next() % 131072) - 65536;
+        static uint32_t texels[40 * 40];
+        fill_random(texels, src_w * src_h);
+        memcpy(out, ref, sizeof(ref));
+        dash2d_blit_rotated_row_scalar(
+            ref + head, texels, src_w, src_w, src_h, u, v, du, dv, count);
+        dash2d_blit_rotated_row_fast(out + head, texels, src_w, src_w, src_h, u, v, du, dv, count);
+        failures += check_equal("blit_rotated_row", ref, out, total, it);
+    }
+    return failures;
+}
+
+static int
+test_tile4(void)
+{
+    enum
+    {
+        STRIDE = 7,
+        ROWS = 6,
+    };
+    uint32_t ref[STRIDE * ROWS];
+    uint32_t out[STRIDE * ROWS];
+    int failures = 0;
+
+    for( int it = 0; it < ITERATIONS; it++ )
+    {
+        int bits = (int)(rng_next() & 0xFFFF);
+        uint32_t fg = rng_next();
+        uint32_t bg = rng_next();
+        int write_bg = (int)(rng_next() & 1);
+        int origin = STRIDE + 1 + (int)(rng_next() % 3);
+
+        fill_random(ref, STRIDE * ROWS);
+        memcpy(out, ref, sizeof(ref));
+        dash2d_fill_tile4_scalar(ref + origin, STRIDE, bits, fg, bg, write_bg);
+        dash2d_fill_tile4_fast(out + origin, STRIDE, bits, fg, bg, write_bg);
+        failures += check_equal("fill_tile4", ref, out, STRIDE * ROWS, it);
+    }
+    return failures;
+}
+
+static int
+test_sprite_subrect(void)
+{
+    enum
+    {
+        DST_W = 64,
+        DST_H = 48,
+    };
+    static uint32_t ref[DST_W * DST_H];
+    static uint32_t out[DST_W * DST_H];
+    static uint32_t pixels[40 * 40];
+    int failures = 0;
+
+    for( int it = 0; it < ITERATIONS / 10; it++ )
+    {
+        struct DashSprite sprite;
+        memset(&sprite, 0, sizeof(sprite));
+        sprite.width = 1 + (int)(rng_next() % 40);
+        sprite.height = 1 + (int)(rng_next() % 40);
+        sprite.crop_x = (int)(rng_next() % 5);
+        sprite.crop_y = (int)(rng_next() % 5);
+        sprite.pixels_argb = pixels;
+        fill_random(pixels, sprite.width * sprite.height);
+
+        struct DashViewPort view_port;
+        memset(&view_port, 0, sizeof(view_port));
+        view_port.stride = DST_W;
+        view_port.clip_left = (int)(rng_next() % 10);
+        view_port.clip_top = (int)(rng_next() % 10);
+        view_port.clip_right = DST_W - (int)(rng_next() % 10);
+        view_port.clip_bottom = DST_H - (int)(rng_next() % 10);
+
+        int src_x = (int)(rng_next() % sprite.width);
+        int src_y = (int)(rng_next() % sprite.height);
+        int src_w = 1 + (int)(rng_next() % (sprite.width - src_x));
+        int src_h = 1 + (int)(rng_next() % (sprite.height - src_y));
+        int x = (int)(rng_next() % (DST_W + 20)) - 20;
+        int y = (int)(rng_next() % (DST_H + 20)) - 20;
+
+        fill_random(ref, DST_W * DST_H);
+        memcpy(out, ref, sizeof(ref));
+        dash2d_blit_sprite_subrect_scalar(
+            NULL, &sprite, &view_port, x, y, src_x, src_y, src_w, src_h, (int*)ref);
+        dash2d_blit_sprite_subrect_fast(
+            NULL, &sprite, &view_port, x, y, src_x, src_y, src_w, src_h, (int*)out);
+        failures += check_equal("blit_sprite_subrect", ref, out, DST_W * DST_H, it);
+    }
+    return failures;
+}
+
+int
+main()
+{
+    int failures = 0;
+    failures += test_rows();
+    failures += test_tile4();
+    failures += test_sprite_subrect();
+    printf("dash2d_simd (%s): %d failures\n", DASH2D_SIMD_ISA, failures);
+    assert(failures == 0);
+    return failures != 0;
+}
@@ -18,7 +18,8 @@ static const faceint_t g_dashmodel_va_tex_n[1] = { 2 };
 
 /** VA terrain: all-zero face_texture_coords like legacy full terrain (terrain_decode_tile);
  * read-only in practice. */
-static faceint_t g_dashmodel_va_face_texture_coords_zero[4096];
+/* VA faces project to slots f*3+k (faceint_t), so this covers every VA face count. */
+static faceint_t g_dashmodel_va_face_texture_coords_zero[(INT16_MAX + 1) / 3];
 
 static void
 dashmodel__free_fast_arrays(struct DashModelGround* m)
@@ -388,15 +389,119 @@ dashmodel_free(struct DashModel* model)
         free(model);
         return;
     case DASHMODEL_TYPE_FULL:
-        dashmodel__free_full_arrays((struct DashModelFull*)(void*)model);
+    {
+        struct DashModelFull* m = (struct DashModelFull*)(void*)model;
+        if( m->extra_owners > 0 )
+        {
+            m->extra_owners--;
+            return;
+        }
+        if( m->instance_base )
+        {
+            free(m->vertices_x);
+            free(m->vertices_y);
+            free(m->vertices_z);
+            free(m->face_alphas);
+            dashmodel_free((struct DashModel*)(void*)m->instance_base);
+            free(model);
+            return;
+        }
+        dashmodel__free_full_arrays(m);
         free(model);
         return;
+    }
     default:
         assert(0);
         return;
     }
 }
 
+struct DashModel*
+dashmodel_share(struct DashModel* model)
+{
+    assert(model && dashmodel__type(model) == DASHMODEL_TYPE_FULL);
+    struct DashModelFull* m = (struct DashModelFull*)(void*)model;
+    assert(m->extra_owners < UINT16_MAX);
+    m->extra_owners++;
+    return model;
+}
+
+bool
+dashmodel_is_shared(const struct DashModel* model)
+{
+    if( !model || dashmodel__type(model) != DASHMODEL_TYPE_FULL )
+        return false;
+    return ((const struct DashModelFull*)(const void*)model)->extra_owners > 0;
+}
+
+static vertexint_t*
+dashmodel__dup_vertices(
+    const vertexint_t* src,
+    int count)
+{
+    vertexint_t* dst = (vertexint_t*)malloc(sizeof(vertexint_t) * (size_t)count);
+    if( dst )
+        memcpy(dst, src, sizeof(vertexint_t) * (size_t)count);
+    return dst;
+}
+
+struct DashModel*
+dashmodel_new_instance(struct DashModel* base)
+{
+    assert(base && dashmodel__type(base) == DASHMODEL_TYPE_FULL);
+    struct DashModelFull* b = (struct DashModelFull*)(void*)base;
+    assert(b->instance_base == NULL && "Instances cannot be nested");
+    /* The base's vertices are the rest pose; animated bases would hand out a posed mesh. */
+    assert(b->original_vertices_x == NULL);
+
+    struct DashModelFull* m = (struct DashModelFull*)malloc(sizeof(struct DashModelFull));
+    if( !m )
+        return NULL;
+    *m = *b;
+    m->extra_owners = 0;
+    m->instance_base = b;
+
+    int vc = b->vertex_count;
+    m->vertices_x = vc > 0 ? dashmodel__dup_vertices(b->vertices_x, vc) : NULL;
+    m->vertices_y = vc > 0 ? dashmodel__dup_vertices(b->vertices_y, vc) : NULL;
+    m->vertices_z = vc > 0 ? dashmodel__dup_vertices(b->vertices_z, vc) : NULL;
+    m->original_vertices_x = b->vertices_x;
+    m->original_vertices_y = b->vertices_y;
+    m->original_vertices_z = b->vertices_z;
+
+    m->face_alphas = NULL;
+    m->original_face_alphas = b->face_alphas;
+    if( b->face_alphas && b->face_count > 0 )
+    {
+        m->face_alphas = (alphaint_t*)malloc(sizeof(alphaint_t) * (size_t)b->face_count);
+        if( m->face_alphas )
+            memcpy(m->face_alphas, b->face_alphas, sizeof(alphaint_t) * (size_t)b->face_count);
+    }
+
+    if( (vc > 0 && (!m->vertices_x || !m->vertices_y || !m->vertices_z)) ||
+        (b->face_alphas && b->face_count > 0 && !m->face_alphas) )
+    {
+        free(m->vertices_x);
+        free(m->vertices_y);
+        free(m->vertices_z);
+        free(m->face_alphas);
+        free(m);
+        return NULL;
+    }
+
+    dashmodel_share(base);
+    return (struct DashModel*)m;
+}
+
+struct DashModel*
+dashmodel_instance_base(const struct DashModel* model)
+{
+    if( !model || dashmodel__type(model) != DASHMODEL_TYPE_FULL )
+        return NULL;
+    return (struct DashModel*)(void*)((const struct DashModelFull*)(const void*)model)
+        ->instance_base;
+}
+
 bool
 dashmodel_is_loaded(const struct DashModel* m)
 {
@@ -994,6 +1099,7 @@ dashmodel_face_infos_ensure_zero(struct DashModel* m)
     if( fc <= 0 )
         return dashmodel_face_infos(m);
     struct DashModelFull* u = dashmodel__as_full(m);
+    assert(u->instance_base == NULL && "Instance geometry is borrowed");
     if( !u->face_infos )
         u->face_infos = (int*)calloc((size_t)fc, sizeof(int));
     return u->face_infos;
@@ -1298,6 +1404,7 @@ static struct DashModelFull*
 dashmodel__writable_full(struct DashModel* m)
 {
     assert(dashmodel__is_full_layout(m));
+    assert(dashmodel__as_full(m)->instance_base == NULL && "Instance geometry is borrowed");
     return dashmodel__as_full(m);
 }
 
@@ -1964,6 +2071,15 @@ dashmodel_heap_bytes(const struct DashModel* model)
     int vc = m->vertex_count;
     int fc = m->face_count;
     int tfc = m->textured_face_count;
+    if( m->instance_base )
+    {
+        /* Borrowed arrays are counted once, on the base. */
+        if( vc > 0 )
+            total += 3 * (size_t)vc * sizeof(vertexint_t);
+        if( fc > 0 && m->face_alphas )
+            total += (size_t)fc * sizeof(alphaint_t);
+        return total;
+    }
     if( vc > 0 )
     {
         if( m->vertices_x )
@@ -60,6 +60,11 @@ struct DashModelVAGround
 struct DashModelFull
 {
     uint8_t flags;
+    /** Owners besides the first (see dashmodel_share); dashmodel_free drops one at a time. */
+    uint16_t extra_owners;
+    /** Set on dashmodel_new_instance models. Only vertices_* and face_alphas are owned; every
+     * other array is borrowed from the base, which this instance holds one reference to. */
+    struct DashModelFull* instance_base;
     int vertex_count;
     int face_count;
     vertexint_t* vertices_x;
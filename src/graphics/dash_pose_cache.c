@@ -0,0 +1,216 @@
+#include "dash_pose_cache.h"
+
+#include "dash_slot_lru.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+struct DashPoseKey
+{
+    uint64_t base;
+    int32_t anim_id;
+    int32_t frame_index;
+};
+
+struct DashPose
+{
+    /** Reference held for as long as the pose is cached; also keeps key.base from being reused. */
+    struct DashModel* base;
+    int vertex_count;
+    int face_count;
+    /** x, y then z, vertex_count each. */
+    vertexint_t* vertices;
+    alphaint_t* face_alphas;
+};
+
+struct DashPoseCache
+{
+    struct DashSlotLRU lru;
+    /** Indexed by LRU slot. */
+    struct DashPose* poses;
+    size_t bytes;
+
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+};
+
+static size_t
+dashposecache__pose_bytes(const struct DashPose* pose)
+{
+    size_t bytes = 3 * (size_t)pose->vertex_count * sizeof(vertexint_t);
+    if( pose->face_alphas )
+        bytes += (size_t)pose->face_count * sizeof(alphaint_t);
+    return bytes;
+}
+
+/** Frees the pose in slot; the slot itself stays with the LRU. */
+static void
+dashposecache__release(
+    struct DashPoseCache* cache,
+    int32_t slot)
+{
+    struct DashPose* pose = &cache->poses[slot];
+    cache->bytes -= dashposecache__pose_bytes(pose);
+    free(pose->vertices);
+    free(pose->face_alphas);
+    dashmodel_free(pose->base);
+    memset(pose, 0, sizeof(*pose));
+}
+
+static void
+dashposecache__release_all(struct DashPoseCache* cache)
+{
+    for( int32_t slot = cache->lru.head; slot != -1; slot = cache->lru.next[slot] )
+        dashposecache__release(cache, slot);
+}
+
+struct DashPoseCache*
+dashposecache_new(int capacity)
+{
+    if( capacity <= 0 )
+        capacity = DASH_POSE_CACHE_CAPACITY_DEFAULT;
+
+    struct DashPoseCache* cache = (struct DashPoseCache*)malloc(sizeof(struct DashPoseCache));
+    if( !cache )
+        return NULL;
+    memset(cache, 0, sizeof(struct DashPoseCache));
+
+    cache->poses = (struct DashPose*)calloc((size_t)capacity, sizeof(struct DashPose));
+    if( !cache->poses || !dashslotlru_init(&cache->lru, capacity, sizeof(struct DashPoseKey)) )
+    {
+        free(cache->poses);
+        free(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+void
+dashposecache_clear(struct DashPoseCache* cache)
+{
+    if( !cache )
+        return;
+    dashposecache__release_all(cache);
+    dashslotlru_clear(&cache->lru);
+}
+
+void
+dashposecache_free(struct DashPoseCache* cache)
+{
+    if( !cache )
+        return;
+    dashposecache__release_all(cache);
+    dashslotlru_fini(&cache->lru);
+    free(cache->poses);
+    free(cache);
+}
+
+static void
+dashposecache__store(
+    struct DashPoseCache* cache,
+    const struct DashPoseKey* key,
+    struct DashModel* base,
+    struct DashModel* model)
+{
+    int vc = dashmodel_vertex_count(model);
+    int fc = dashmodel_face_count(model);
+    const alphaint_t* alphas = dashmodel_face_alphas_const(model);
+
+    vertexint_t* vertices = (vertexint_t*)malloc(3 * (size_t)vc * sizeof(vertexint_t));
+    alphaint_t* face_alphas = NULL;
+    if( alphas && fc > 0 )
+        face_alphas = (alphaint_t*)malloc((size_t)fc * sizeof(alphaint_t));
+    if( !vertices || (alphas && fc > 0 && !face_alphas) )
+    {
+        free(vertices);
+        free(face_alphas);
+        return;
+    }
+
+    if( cache->lru.count >= cache->lru.capacity )
+    {
+        dashposecache__release(cache, cache->lru.tail);
+        dashslotlru_remove(&cache->lru, cache->lru.tail);
+        cache->evictions++;
+    }
+
+    int32_t slot = dashslotlru_insert(&cache->lru, key);
+    struct DashPose* pose = &cache->poses[slot];
+
+    memcpy(vertices, dashmodel_vertices_x_const(model), (size_t)vc * sizeof(vertexint_t));
+    memcpy(vertices + vc, dashmodel_vertices_y_const(model), (size_t)vc * sizeof(vertexint_t));
+    memcpy(vertices + 2 * vc, dashmodel_vertices_z_const(model), (size_t)vc * sizeof(vertexint_t));
+    if( face_alphas )
+        memcpy(face_alphas, alphas, (size_t)fc * sizeof(alphaint_t));
+
+    pose->base = dashmodel_share(base);
+    pose->vertex_count = vc;
+    pose->face_count = fc;
+    pose->vertices = vertices;
+    pose->face_alphas = face_alphas;
+    cache->bytes += dashposecache__pose_bytes(pose);
+}
+
+void
+dashposecache_animate(
+    struct DashPoseCache* cache,
+    struct DashModel* model,
+    int anim_id,
+    int frame_index,
+    struct DashFrame* frame,
+    struct DashFramemap* framemap)
+{
+    struct DashModel* base = cache && frame ? dashmodel_instance_base(model) : NULL;
+    if( !base )
+    {
+        dashmodel_animate(model, frame, framemap);
+        return;
+    }
+
+    struct DashPoseKey key;
+    memset(&key, 0, sizeof(key));
+    key.base = (uint64_t)(uintptr_t)base;
+    key.anim_id = anim_id;
+    key.frame_index = frame_index;
+
+    int32_t slot = dashslotlru_find(&cache->lru, &key);
+    if( slot != -1 )
+    {
+        struct DashPose* pose = &cache->poses[slot];
+        int vc = pose->vertex_count;
+        memcpy(dashmodel_vertices_x(model), pose->vertices, (size_t)vc * sizeof(vertexint_t));
+        memcpy(dashmodel_vertices_y(model), pose->vertices + vc, (size_t)vc * sizeof(vertexint_t));
+        memcpy(
+            dashmodel_vertices_z(model), pose->vertices + 2 * vc, (size_t)vc * sizeof(vertexint_t));
+        if( pose->face_alphas )
+            memcpy(
+                dashmodel_face_alphas(model),
+                pose->face_alphas,
+                (size_t)pose->face_count * sizeof(alphaint_t));
+
+        dashslotlru_touch(&cache->lru, slot);
+        cache->hits++;
+        return;
+    }
+
+    cache->misses++;
+    dashmodel_animate(model, frame, framemap);
+    dashposecache__store(cache, &key, base, model);
+}
+
+void
+dashposecache_stats(
+    const struct DashPoseCache* cache,
+    struct DashPoseCacheStats* out)
+{
+    memset(out, 0, sizeof(*out));
+    if( !cache )
+        return;
+    out->hits = cache->hits;
+    out->misses = cache->misses;
+    out->evictions = cache->evictions;
+    out->count = cache->lru.count;
+    out->capacity = cache->lru.capacity;
+    out->bytes = cache->bytes;
+}
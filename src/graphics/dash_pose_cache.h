@@ -0,0 +1,59 @@
+#ifndef DASH_POSE_CACHE_H
+#define DASH_POSE_CACHE_H
+
+#include "dash.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Bounded LRU of baked animation poses for the software renderer, keyed by
+ * (shared geometry, anim_id, frame index). The CPU counterpart of the pre-baked poses GPU
+ * backends receive through SCENE2_EVENT_ANIMATION_LOADED.
+ *
+ * Only instance models (dashmodel_new_instance) are cached: their base is the geometry shared by
+ * every entity wearing it, so one pose serves all of them. A hit copies the baked vertices (and
+ * face alphas) into the instance instead of resetting and re-applying the frame. Each cached pose
+ * holds a reference to its base until it is evicted.
+ */
+struct DashPoseCache;
+
+struct DashPoseCacheStats
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    int count;
+    int capacity;
+    size_t bytes;
+};
+
+#define DASH_POSE_CACHE_CAPACITY_DEFAULT 512
+
+struct DashPoseCache*
+dashposecache_new(int capacity);
+
+void
+dashposecache_free(struct DashPoseCache* cache);
+
+/** Drops every cached pose (and its base reference). Counters are kept. */
+void
+dashposecache_clear(struct DashPoseCache* cache);
+
+/** Same result as dashmodel_animate(model, frame, framemap); served from the cache when `model`
+ * is an instance and (anim_id, frame_index) was baked for its base before. */
+void
+dashposecache_animate(
+    struct DashPoseCache* cache,
+    struct DashModel* model,
+    int anim_id,
+    int frame_index,
+    struct DashFrame* frame,
+    struct DashFramemap* framemap);
+
+void
+dashposecache_stats(
+    const struct DashPoseCache* cache,
+    struct DashPoseCacheStats* out);
+
+#endif
@@ -0,0 +1,218 @@
+#include "dash_slot_lru.h"
+
+#include "dashmap.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Map entries are the key followed by an int32_t slot, padded so 8-byte keys stay aligned. */
+static size_t
+dashslotlru__slot_offset(size_t key_size)
+{
+    return (key_size + 3) & ~(size_t)3;
+}
+
+static struct DashMap*
+dashslotlru__map_new(const struct DashSlotLRU* lru)
+{
+    /* Twice the slot count keeps probe chains short. */
+    size_t slots = (size_t)lru->capacity * 2;
+    size_t buffer_size = dashmap_buffer_size_for(lru->entry_size, slots);
+    struct DashMapConfig config = {
+        .buffer = malloc(buffer_size),
+        .buffer_size = buffer_size,
+        .key_size = lru->key_size,
+        .entry_size = lru->entry_size,
+        .capacity = slots,
+    };
+    if( !config.buffer )
+        return NULL;
+    struct DashMap* map = dashmap_new(&config, 0);
+    if( !map )
+        free(config.buffer);
+    return map;
+}
+
+static void
+dashslotlru__map_free(struct DashMap* map)
+{
+    if( !map )
+        return;
+    free(dashmap_buffer_ptr(map));
+    dashmap_free(map);
+}
+
+static void
+dashslotlru__map_insert(
+    struct DashMap* map,
+    size_t key_size,
+    const void* key,
+    int32_t slot)
+{
+    uint8_t* entry = (uint8_t*)dashmap_search(map, key, DASHMAP_INSERT);
+    assert(entry);
+    memcpy(entry, key, key_size);
+    memcpy(entry + dashslotlru__slot_offset(key_size), &slot, sizeof(slot));
+}
+
+static void
+dashslotlru__unlink(
+    struct DashSlotLRU* lru,
+    int32_t slot)
+{
+    if( lru->prev[slot] != -1 )
+        lru->next[lru->prev[slot]] = lru->next[slot];
+    else
+        lru->head = lru->next[slot];
+    if( lru->next[slot] != -1 )
+        lru->prev[lru->next[slot]] = lru->prev[slot];
+    else
+        lru->tail = lru->prev[slot];
+    lru->prev[slot] = -1;
+    lru->next[slot] = -1;
+}
+
+static void
+dashslotlru__push_front(
+    struct DashSlotLRU* lru,
+    int32_t slot)
+{
+    lru->prev[slot] = -1;
+    lru->next[slot] = lru->head;
+    if( lru->head != -1 )
+        lru->prev[lru->head] = slot;
+    lru->head = slot;
+    if( lru->tail == -1 )
+        lru->tail = slot;
+}
+
+static void
+dashslotlru__free_list_reset(struct DashSlotLRU* lru)
+{
+    lru->head = -1;
+    lru->tail = -1;
+    lru->count = 0;
+    for( int i = 0; i < lru->capacity; i++ )
+    {
+        lru->prev[i] = -1;
+        lru->next[i] = i + 1 < lru->capacity ? i + 1 : -1;
+    }
+    lru->free_head = 0;
+}
+
+/** Rebuilds the map from the live slots, dropping the tombstones left by removals. */
+static void
+dashslotlru__rehash(struct DashSlotLRU* lru)
+{
+    struct DashMap* map = dashslotlru__map_new(lru);
+    if( !map )
+        return;
+    for( int32_t slot = lru->head; slot != -1; slot = lru->next[slot] )
+        dashslotlru__map_insert(map, lru->key_size, dashslotlru_key(lru, slot), slot);
+    dashslotlru__map_free(lru->map);
+    lru->map = map;
+    lru->removed_since_rehash = 0;
+}
+
+bool
+dashslotlru_init(
+    struct DashSlotLRU* lru,
+    int capacity,
+    size_t key_size)
+{
+    memset(lru, 0, sizeof(*lru));
+    lru->capacity = capacity;
+    lru->key_size = key_size;
+    lru->entry_size = (dashslotlru__slot_offset(key_size) + sizeof(int32_t) + 7) & ~(size_t)7;
+
+    lru->map = dashslotlru__map_new(lru);
+    lru->keys = (uint8_t*)calloc((size_t)capacity, key_size);
+    lru->prev = (int32_t*)malloc((size_t)capacity * sizeof(int32_t));
+    lru->next = (int32_t*)malloc((size_t)capacity * sizeof(int32_t));
+    if( !lru->map || !lru->keys || !lru->prev || !lru->next )
+    {
+        dashslotlru_fini(lru);
+        return false;
+    }
+
+    dashslotlru__free_list_reset(lru);
+    return true;
+}
+
+void
+dashslotlru_fini(struct DashSlotLRU* lru)
+{
+    dashslotlru__map_free(lru->map);
+    free(lru->keys);
+    free(lru->prev);
+    free(lru->next);
+    memset(lru, 0, sizeof(*lru));
+}
+
+int32_t
+dashslotlru_find(
+    struct DashSlotLRU* lru,
+    const void* key)
+{
+    const uint8_t* entry = (const uint8_t*)dashmap_search(lru->map, key, DASHMAP_FIND);
+    if( !entry )
+        return -1;
+    int32_t slot;
+    memcpy(&slot, entry + dashslotlru__slot_offset(lru->key_size), sizeof(slot));
+    return slot;
+}
+
+void
+dashslotlru_touch(
+    struct DashSlotLRU* lru,
+    int32_t slot)
+{
+    if( lru->head == slot )
+        return;
+    dashslotlru__unlink(lru, slot);
+    dashslotlru__push_front(lru, slot);
+}
+
+int32_t
+dashslotlru_insert(
+    struct DashSlotLRU* lru,
+    const void* key)
+{
+    int32_t slot = lru->free_head;
+    assert(slot != -1);
+    lru->free_head = lru->next[slot];
+
+    memcpy(lru->keys + (size_t)slot * lru->key_size, key, lru->key_size);
+    dashslotlru__push_front(lru, slot);
+    lru->count++;
+    dashslotlru__map_insert(lru->map, lru->key_size, key, slot);
+    return slot;
+}
+
+void
+dashslotlru_remove(
+    struct DashSlotLRU* lru,
+    int32_t slot)
+{
+    dashmap_search(lru->map, dashslotlru_key(lru, slot), DASHMAP_REMOVE);
+    dashslotlru__unlink(lru, slot);
+    memset(lru->keys + (size_t)slot * lru->key_size, 0, lru->key_size);
+    lru->next[slot] = lru->free_head;
+    lru->free_head = slot;
+    lru->count--;
+
+    if( ++lru->removed_since_rehash >= lru->capacity )
+        dashslotlru__rehash(lru);
+}
+
+void
+dashslotlru_clear(struct DashSlotLRU* lru)
+{
+    /* Removed one by one as well, so the map stays right if the rehash cannot allocate. */
+    for( int32_t slot = lru->head; slot != -1; slot = lru->next[slot] )
+        dashmap_search(lru->map, dashslotlru_key(lru, slot), DASHMAP_REMOVE);
+    dashslotlru__free_list_reset(lru);
+    memset(lru->keys, 0, (size_t)lru->capacity * lru->key_size);
+    dashslotlru__rehash(lru);
+}
@@ -0,0 +1,80 @@
+#ifndef DASH_SLOT_LRU_H
+#define DASH_SLOT_LRU_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Fixed-capacity LRU order over slots 0..capacity-1, with a DashMap from a fixed-size key to its
+ * slot. The caches built on it (poses, object icons, text layouts) keep their payloads in a
+ * parallel array indexed by slot and free a payload before removing its slot.
+ *
+ * Keys are compared bytewise, so callers memset them before filling the fields.
+ */
+struct DashSlotLRU
+{
+    struct DashMap* map;
+    /** Copy of each live slot's key; removals and rehashes look the map entry up by it. */
+    uint8_t* keys;
+    int32_t* prev;
+    int32_t* next;
+    size_t key_size;
+    size_t entry_size;
+    int capacity;
+    int count;
+    /** Most recently used first. */
+    int32_t head;
+    int32_t tail;
+    int32_t free_head;
+    /** Removals since the map was last rehashed; tombstones build up with churn. */
+    int removed_since_rehash;
+};
+
+bool
+dashslotlru_init(
+    struct DashSlotLRU* lru,
+    int capacity,
+    size_t key_size);
+
+/** Frees the map and links only; the caller frees the payloads of the live slots first. */
+void
+dashslotlru_fini(struct DashSlotLRU* lru);
+
+/** Slot holding key, or -1. Does not change the order; see dashslotlru_touch. */
+int32_t
+dashslotlru_find(
+    struct DashSlotLRU* lru,
+    const void* key);
+
+/** Marks slot as the most recently used. */
+void
+dashslotlru_touch(
+    struct DashSlotLRU* lru,
+    int32_t slot);
+
+/** Takes a free slot for key (which must not be present) as the most recently used. The caller
+ * removes the tail first when the LRU is full. */
+int32_t
+dashslotlru_insert(
+    struct DashSlotLRU* lru,
+    const void* key);
+
+void
+dashslotlru_remove(
+    struct DashSlotLRU* lru,
+    int32_t slot);
+
+/** Frees every slot at once; the caller frees the payloads of the live slots first. */
+void
+dashslotlru_clear(struct DashSlotLRU* lru);
+
+static inline const void*
+dashslotlru_key(
+    const struct DashSlotLRU* lru,
+    int32_t slot)
+{
+    return lru->keys + (size_t)slot * lru->key_size;
+}
+
+#endif
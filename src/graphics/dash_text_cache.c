@@ -0,0 +1,652 @@
+#include "dash_text_cache.h"
+
+#include "dash_slot_lru.h"
+#include "osrs/colors.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+enum DashTextDialect
+{
+    /* dashfont_draw_text_ex: a space right after a tag is swallowed. */
+    DASH_TEXT_DIALECT_EX,
+    /* dashfont_draw_text_clipped_taggable: tag colors are made opaque. */
+    DASH_TEXT_DIALECT_TAGGABLE,
+};
+
+struct DashTextKey
+{
+    uint64_t font;
+    uint64_t hash;
+    int32_t length;
+    int32_t dialect;
+};
+
+struct DashTextGlyph
+{
+    /** Mask top-left relative to the text origin, char_offset_x/y included. */
+    int32_t x;
+    int16_t y;
+    uint8_t c;
+    /** 0 until the first color tag; those glyphs take the caller's default color. */
+    uint8_t tagged;
+    int32_t color;
+};
+
+/** Consecutive glyphs sharing a color, merged into one 1-bit mask so a row of the run is a single
+ * dash2d_fill_mask span instead of one per glyph. */
+struct DashTextRun
+{
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+    int32_t tagged;
+    int32_t color;
+    uint8_t* bits;
+};
+
+struct DashTextLayout
+{
+    /** Copy of the text, compared on every hit. */
+    uint8_t* text;
+    /** Kept for shadowed draws, which interleave each glyph with its shadow. */
+    struct DashTextGlyph* glyphs;
+    int glyph_count;
+    struct DashTextRun* runs;
+    int run_count;
+    size_t bytes;
+    /** Advance summed over glyphs in the font; what dashfont_text_width_taggable reports. */
+    int width;
+    /** Ink bounds relative to the text origin, [min, max). Empty when glyph_count is 0. */
+    int min_x;
+    int min_y;
+    int max_x;
+    int max_y;
+};
+
+struct DashTextCache
+{
+    struct DashSlotLRU lru;
+    /** Indexed by LRU slot. */
+    struct DashTextLayout* layouts;
+    size_t bytes;
+
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+};
+
+static void
+dashtextcache__layout_free(struct DashTextLayout* layout)
+{
+    for( int i = 0; i < layout->run_count; i++ )
+        free(layout->runs[i].bits);
+    free(layout->runs);
+    free(layout->glyphs);
+    free(layout->text);
+}
+
+/** Frees the layout in slot; the slot itself stays with the LRU. */
+static void
+dashtextcache__release(
+    struct DashTextCache* cache,
+    int32_t slot)
+{
+    struct DashTextLayout* layout = &cache->layouts[slot];
+    cache->bytes -= layout->bytes;
+    dashtextcache__layout_free(layout);
+    memset(layout, 0, sizeof(*layout));
+}
+
+static void
+dashtextcache__remove(
+    struct DashTextCache* cache,
+    int32_t slot)
+{
+    dashtextcache__release(cache, slot);
+    dashslotlru_remove(&cache->lru, slot);
+}
+
+static void
+dashtextcache__release_all(struct DashTextCache* cache)
+{
+    for( int32_t slot = cache->lru.head; slot != -1; slot = cache->lru.next[slot] )
+        dashtextcache__release(cache, slot);
+}
+
+struct DashTextCache*
+dashtextcache_new(int capacity)
+{
+    if( capacity <= 0 )
+        capacity = DASH_TEXT_CACHE_CAPACITY_DEFAULT;
+
+    struct DashTextCache* cache = (struct DashTextCache*)malloc(sizeof(struct DashTextCache));
+    if( !cache )
+        return NULL;
+    memset(cache, 0, sizeof(struct DashTextCache));
+
+    cache->layouts =
+        (struct DashTextLayout*)calloc((size_t)capacity, sizeof(struct DashTextLayout));
+    if( !cache->layouts || !dashslotlru_init(&cache->lru, capacity, sizeof(struct DashTextKey)) )
+    {
+        free(cache->layouts);
+        free(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+void
+dashtextcache_clear(struct DashTextCache* cache)
+{
+    if( !cache )
+        return;
+    dashtextcache__release_all(cache);
+    dashslotlru_clear(&cache->lru);
+}
+
+void
+dashtextcache_free(struct DashTextCache* cache)
+{
+    if( !cache )
+        return;
+    dashtextcache__release_all(cache);
+    dashslotlru_fini(&cache->lru);
+    free(cache->layouts);
+    free(cache);
+}
+
+/* FNV-1a. */
+static uint64_t
+dashtextcache__hash(
+    const uint8_t* text,
+    int length)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for( int i = 0; i < length; i++ )
+    {
+        hash ^= text[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/** Walks text the way the dashfont_draw_* function for `dialect` does, recording each glyph that
+ * has ink. Returns false on allocation failure. */
+static bool
+dashtextcache__layout(
+    struct DashTextLayout* layout,
+    struct DashPixFont* pixfont,
+    const uint8_t* text,
+    int length,
+    int dialect)
+{
+    struct DashTextGlyph* glyphs = NULL;
+    if( length > 0 )
+    {
+        glyphs = (struct DashTextGlyph*)malloc((size_t)length * sizeof(struct DashTextGlyph));
+        if( !glyphs )
+            return false;
+    }
+
+    int count = 0;
+    int pen_x = 0;
+    int width = 0;
+    int tagged = 0;
+    int color = 0;
+    int min_x = INT32_MAX;
+    int min_y = INT32_MAX;
+    int max_x = INT32_MIN;
+    int max_y = INT32_MIN;
+    for( int i = 0; i < length; i++ )
+    {
+        if( text[i] == '@' && i + 5 <= length && text[i + 4] == '@' )
+        {
+            int new_color = dashfont_evaluate_color_tag((const char*)&text[i + 1]);
+            if( new_color >= 0 )
+            {
+                tagged = 1;
+                color = dialect == DASH_TEXT_DIALECT_TAGGABLE ? (int)(0xFF000000 | new_color)
+                                                              : new_color;
+            }
+
+            if( dialect == DASH_TEXT_DIALECT_EX && i + 6 <= length && text[i + 5] == ' ' )
+                i += 5;
+            else
+                i += 4;
+            continue;
+        }
+
+        int c = dashfont_charcode_to_glyph(text[i]);
+        if( c >= DASH_FONT_CHAR_COUNT )
+        {
+            /* The taggable functions advance 4 here but leave it out of the measured width. */
+            pen_x += dialect == DASH_TEXT_DIALECT_EX ? dashfont_char_advance(pixfont, c) : 4;
+            continue;
+        }
+
+        int w = pixfont->char_mask_width[c];
+        int h = pixfont->char_mask_height[c];
+        if( pixfont->char_bits[c] && w > 0 && h > 0 )
+        {
+            struct DashTextGlyph* glyph = &glyphs[count++];
+            glyph->x = pen_x + pixfont->char_offset_x[c];
+            glyph->y = (int16_t)pixfont->char_offset_y[c];
+            glyph->c = (uint8_t)c;
+            glyph->tagged = (uint8_t)tagged;
+            glyph->color = color;
+
+            if( glyph->x < min_x )
+                min_x = glyph->x;
+            if( glyph->y < min_y )
+                min_y = glyph->y;
+            if( glyph->x + w > max_x )
+                max_x = glyph->x + w;
+            if( glyph->y + h > max_y )
+                max_y = glyph->y + h;
+        }
+
+        int adv = dashfont_char_advance(pixfont, c);
+        pen_x += adv;
+        width += adv;
+    }
+
+    layout->glyphs = glyphs;
+    layout->glyph_count = count;
+    layout->width = width;
+    if( count == 0 )
+    {
+        min_x = min_y = 0;
+        max_x = max_y = 0;
+    }
+    layout->min_x = min_x;
+    layout->min_y = min_y;
+    layout->max_x = max_x;
+    layout->max_y = max_y;
+    return true;
+}
+
+/** Merges layout->glyphs into DashTextRuns. Later glyphs only overwrite earlier ones where the
+ * colors differ, and those land in later runs, so drawing the runs in order matches drawing the
+ * glyphs in order. Returns false on allocation failure. */
+static bool
+dashtextcache__build_runs(
+    struct DashTextLayout* layout,
+    struct DashPixFont* pixfont)
+{
+    if( layout->glyph_count == 0 )
+        return true;
+    layout->runs =
+        (struct DashTextRun*)calloc((size_t)layout->glyph_count, sizeof(struct DashTextRun));
+    if( !layout->runs )
+        return false;
+
+    int first = 0;
+    while( first < layout->glyph_count )
+    {
+        const struct DashTextGlyph* head = &layout->glyphs[first];
+        int last = first + 1;
+        while( last < layout->glyph_count && layout->glyphs[last].tagged == head->tagged &&
+               layout->glyphs[last].color == head->color )
+            last++;
+
+        int min_x = INT32_MAX;
+        int min_y = INT32_MAX;
+        int max_x = INT32_MIN;
+        int max_y = INT32_MIN;
+        for( int i = first; i < last; i++ )
+        {
+            const struct DashTextGlyph* glyph = &layout->glyphs[i];
+            int right = glyph->x + pixfont->char_mask_width[glyph->c];
+            int bottom = glyph->y + pixfont->char_mask_height[glyph->c];
+            min_x = glyph->x < min_x ? glyph->x : min_x;
+            min_y = glyph->y < min_y ? glyph->y : min_y;
+            max_x = right > max_x ? right : max_x;
+            max_y = bottom > max_y ? bottom : max_y;
+        }
+
+        struct DashTextRun* run = &layout->runs[layout->run_count++];
+        run->x = min_x;
+        run->y = min_y;
+        run->width = max_x - min_x;
+        run->height = max_y - min_y;
+        run->tagged = head->tagged;
+        run->color = head->color;
+
+        int run_stride = (run->width + 7) >> 3;
+        size_t run_size = (size_t)run_stride * run->height;
+        run->bits = (uint8_t*)calloc(run_size, 1);
+        if( !run->bits )
+            return false;
+        layout->bytes += run_size;
+
+        for( int i = first; i < last; i++ )
+        {
+            const struct DashTextGlyph* glyph = &layout->glyphs[i];
+            int w = pixfont->char_mask_width[glyph->c];
+            int h = pixfont->char_mask_height[glyph->c];
+            const uint8_t* src = pixfont->char_bits[glyph->c];
+            int src_stride = (w + 7) >> 3;
+            int dx = glyph->x - run->x;
+            int dy = glyph->y - run->y;
+            for( int row = 0; row < h; row++ )
+            {
+                uint8_t* dst = run->bits + (row + dy) * run_stride;
+                for( int col = 0; col < w; col++ )
+                {
+                    if( (src[row * src_stride + (col >> 3)] >> (col & 7)) & 1 )
+                        dst[(col + dx) >> 3] |= (uint8_t)(1 << ((col + dx) & 7));
+                }
+            }
+        }
+        first = last;
+    }
+    layout->bytes += (size_t)layout->run_count * sizeof(struct DashTextRun);
+    return true;
+}
+
+/** Returns the layout for text, building and caching it on a miss. NULL only when out of
+ * memory. */
+static struct DashTextLayout*
+dashtextcache__lookup(
+    struct DashTextCache* cache,
+    struct DashPixFont* pixfont,
+    const uint8_t* text,
+    int dialect)
+{
+    int length = (int)strlen((const char*)text);
+
+    struct DashTextKey key;
+    memset(&key, 0, sizeof(key));
+    key.font = (uint64_t)(uintptr_t)pixfont;
+    key.hash = dashtextcache__hash(text, length);
+    key.length = length;
+    key.dialect = dialect;
+
+    int32_t slot = dashslotlru_find(&cache->lru, &key);
+    if( slot != -1 )
+    {
+        if( memcmp(cache->layouts[slot].text, text, (size_t)length) == 0 )
+        {
+            dashslotlru_touch(&cache->lru, slot);
+            cache->hits++;
+            return &cache->layouts[slot];
+        }
+        /* Hash collision: the newer string takes the key. */
+        dashtextcache__remove(cache, slot);
+    }
+
+    cache->misses++;
+
+    struct DashTextLayout built;
+    memset(&built, 0, sizeof(built));
+    built.text = (uint8_t*)malloc((size_t)length + 1);
+    if( !built.text || !dashtextcache__layout(&built, pixfont, text, length, dialect) ||
+        !dashtextcache__build_runs(&built, pixfont) )
+    {
+        dashtextcache__layout_free(&built);
+        return NULL;
+    }
+    memcpy(built.text, text, (size_t)length + 1);
+    built.bytes += (size_t)length + (size_t)built.glyph_count * sizeof(struct DashTextGlyph);
+
+    if( cache->lru.count >= cache->lru.capacity )
+    {
+        dashtextcache__remove(cache, cache->lru.tail);
+        cache->evictions++;
+    }
+
+    slot = dashslotlru_insert(&cache->lru, &key);
+    struct DashTextLayout* layout = &cache->layouts[slot];
+    *layout = built;
+    cache->bytes += layout->bytes;
+    return layout;
+}
+
+static void
+dashtextcache__blit(
+    const struct DashTextLayout* layout,
+    struct DashPixFont* pixfont,
+    int x,
+    int y,
+    int default_color_rgb,
+    int* pixels,
+    int stride,
+    int clip_left,
+    int clip_top,
+    int clip_right,
+    int clip_bottom,
+    bool shadowed)
+{
+    /* The shadow is drawn one pixel down and right of each glyph. */
+    int spill = shadowed ? 1 : 0;
+    if( layout->glyph_count == 0 || x + layout->max_x + spill <= clip_left ||
+        x + layout->min_x >= clip_right || y + layout->max_y + spill <= clip_top ||
+        y + layout->min_y >= clip_bottom )
+        return;
+
+    if( !shadowed )
+    {
+        for( int i = 0; i < layout->run_count; i++ )
+        {
+            const struct DashTextRun* run = &layout->runs[i];
+            dash2d_fill_mask_clipped(
+                pixels,
+                stride,
+                x + run->x,
+                y + run->y,
+                run->width,
+                run->height,
+                run->bits,
+                run->tagged ? run->color : default_color_rgb,
+                clip_left,
+                clip_top,
+                clip_right,
+                clip_bottom);
+        }
+        return;
+    }
+
+    int shadow_color = (int)(0xFF000000 | BLACK);
+    for( int i = 0; i < layout->glyph_count; i++ )
+    {
+        const struct DashTextGlyph* glyph = &layout->glyphs[i];
+        int w = pixfont->char_mask_width[glyph->c];
+        int h = pixfont->char_mask_height[glyph->c];
+        const uint8_t* bits = pixfont->char_bits[glyph->c];
+        int gx = x + glyph->x;
+        int gy = y + glyph->y;
+        dash2d_fill_mask_clipped(
+            pixels,
+            stride,
+            gx + 1,
+            gy + 1,
+            w,
+            h,
+            bits,
+            shadow_color,
+            clip_left,
+            clip_top,
+            clip_right,
+            clip_bottom);
+        dash2d_fill_mask_clipped(
+            pixels,
+            stride,
+            gx,
+            gy,
+            w,
+            h,
+            bits,
+            glyph->tagged ? glyph->color : default_color_rgb,
+            clip_left,
+            clip_top,
+            clip_right,
+            clip_bottom);
+    }
+}
+
+void
+dashtextcache_draw_text_ex(
+    struct DashTextCache* cache,
+    struct DashPixFont* pixfont,
+    uint8_t* text,
+    int x,
+    int y,
+    int default_color_rgb,
+    int* pixels,
+    int stride)
+{
+    struct DashTextLayout* layout =
+        cache ? dashtextcache__lookup(cache, pixfont, text, DASH_TEXT_DIALECT_EX) : NULL;
+    if( !layout )
+    {
+        dashfont_draw_text_ex(pixfont, text, x, y, default_color_rgb, pixels, stride);
+        return;
+    }
+
+    for( int i = 0; i < layout->run_count; i++ )
+    {
+        const struct DashTextRun* run = &layout->runs[i];
+        dash2d_fill_mask(
+            pixels,
+            stride,
+            x + run->x,
+            y + run->y,
+            run->width,
+            run->height,
+            run->bits,
+            run->tagged ? run->color : default_color_rgb);
+    }
+}
+
+void
+dashtextcache_draw_text_ex_clipped(
+    struct DashTextCache* cache,
+    struct DashPixFont* pixfont,
+    uint8_t* text,
+    int x,
+    int y,
+    int default_color_rgb,
+    int* pixels,
+    int stride,
+    int clip_left,
+    int clip_top,
+    int clip_right,
+    int clip_bottom)
+{
+    if( clip_left >= clip_right || clip_top >= clip_bottom )
+        return;
+    struct DashTextLayout* layout =
+        cache ? dashtextcache__lookup(cache, pixfont, text, DASH_TEXT_DIALECT_EX) : NULL;
+    if( !layout )
+    {
+        dashfont_draw_text_ex_clipped(
+            pixfont,
+            text,
+            x,
+            y,
+            default_color_rgb,
+            pixels,
+            stride,
+            clip_left,
+            clip_top,
+            clip_right,
+            clip_bottom);
+        return;
+    }
+    dashtextcache__blit(
+        layout,
+        pixfont,
+        x,
+        y,
+        default_color_rgb,
+        pixels,
+        stride,
+        clip_left,
+        clip_top,
+        clip_right,
+        clip_bottom,
+        false);
+}
+
+void
+dashtextcache_draw_text_clipped_taggable(
+    struct DashTextCache* cache,
+    struct DashPixFont* pixfont,
+    uint8_t* text,
+    int x,
+    int y,
+    int default_color_rgb,
+    int* pixels,
+    int stride,
+    int clip_left,
+    int clip_top,
+    int clip_right,
+    int clip_bottom,
+    bool shadowed)
+{
+    if( clip_left >= clip_right || clip_top >= clip_bottom )
+        return;
+    struct DashTextLayout* layout =
+        cache ? dashtextcache__lookup(cache, pixfont, text, DASH_TEXT_DIALECT_TAGGABLE) : NULL;
+    if( !layout )
+    {
+        dashfont_draw_text_clipped_taggable(
+            pixfont,
+            text,
+            x,
+            y,
+            default_color_rgb,
+            pixels,
+            stride,
+            clip_left,
+            clip_top,
+            clip_right,
+            clip_bottom,
+            shadowed);
+        return;
+    }
+    dashtextcache__blit(
+        layout,
+        pixfont,
+        x,
+        y,
+        default_color_rgb,
+        pixels,
+        stride,
+        clip_left,
+        clip_top,
+        clip_right,
+        clip_bottom,
+        shadowed);
+}
+
+int
+dashtextcache_text_width_taggable(
+    struct DashTextCache* cache,
+    struct DashPixFont* pixfont,
+    uint8_t* text)
+{
+    struct DashTextLayout* layout =
+        cache ? dashtextcache__lookup(cache, pixfont, text, DASH_TEXT_DIALECT_TAGGABLE) : NULL;
+    if( !layout )
+        return dashfont_text_width_taggable(pixfont, text);
+    return layout->width;
+}
+
+void
+dashtextcache_stats(
+    const struct DashTextCache* cache,
+    struct DashTextCacheStats* out)
+{
+    memset(out, 0, sizeof(*out));
+    if( !cache )
+        return;
+    out->hits = cache->hits;
+    out->misses = cache->misses;
+    out->evictions = cache->evictions;
+    out->count = cache->lru.count;
+    out->capacity = cache->lru.capacity;
+    out->bytes = cache->bytes;
+}
@@ -0,0 +1,105 @@
+#ifndef DASH_TEXT_CACHE_H
+#define DASH_TEXT_CACHE_H
+
+#include "dash.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Bounded LRU of laid-out text lines, keyed by (font, text hash and length, tag dialect). Chat
+ * lines and interface labels are redrawn every frame with the same strings; a layout holds the
+ * glyphs with their pen positions and @col@ tag colors already resolved, merged into one 1-bit mask
+ * per color run, so a hit blits a few long mask rows with no tag parsing or advance walking.
+ *
+ * Layouts do not depend on the position, default color or clip rect: untagged glyphs take the
+ * caller's default color and clipping is applied at draw time. The cached text is compared on
+ * every hit, so a hash collision is a miss, never the wrong string.
+ *
+ * Layouts refer to their font by pointer; clear the cache before freeing a font that was drawn
+ * through it.
+ */
+struct DashTextCache;
+
+struct DashTextCacheStats
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    int count;
+    int capacity;
+    size_t bytes;
+};
+
+#define DASH_TEXT_CACHE_CAPACITY_DEFAULT 256
+
+struct DashTextCache*
+dashtextcache_new(int capacity);
+
+void
+dashtextcache_free(struct DashTextCache* cache);
+
+/** Drops every cached layout. Counters are kept. */
+void
+dashtextcache_clear(struct DashTextCache* cache);
+
+/** Same output as dashfont_draw_text_ex; falls back to it when cache is NULL. */
+void
+dashtextcache_draw_text_ex(
+    struct DashTextCache* cache,
+    struct DashPixFont* pixfont,
+    uint8_t* text,
+    int x,
+    int y,
+    int default_color_rgb,
+    int* pixels,
+    int stride);
+
+/** Same output as dashfont_draw_text_ex_clipped; falls back to it when cache is NULL. */
+void
+dashtextcache_draw_text_ex_clipped(
+    struct DashTextCache* cache,
+    struct DashPixFont* pixfont,
+    uint8_t* text,
+    int x,
+    int y,
+    int default_color_rgb,
+    int* pixels,
+    int stride,
+    int clip_left,
+    int clip_top,
+    int clip_right,
+    int clip_bottom);
+
+/** Same output as dashfont_draw_text_clipped_taggable; falls back to it when cache is NULL. */
+void
+dashtextcache_draw_text_clipped_taggable(
+    struct DashTextCache* cache,
+    struct DashPixFont* pixfont,
+    uint8_t* text,
+    int x,
+    int y,
+    int default_color_rgb,
+    int* pixels,
+    int stride,
+    int clip_left,
+    int clip_top,
+    int clip_right,
+    int clip_bottom,
+    bool shadowed);
+
+/** Same result as dashfont_text_width_taggable; shares the layout drawn by
+ * dashtextcache_draw_text_clipped_taggable. */
+int
+dashtextcache_text_width_taggable(
+    struct DashTextCache* cache,
+    struct DashPixFont* pixfont,
+    uint8_t* text);
+
+void
+dashtextcache_stats(
+    const struct DashTextCache* cache,
+    struct DashTextCacheStats* out);
+
+#endif
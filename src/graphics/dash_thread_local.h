@@ -0,0 +1,22 @@
+#ifndef DASH_THREAD_LOCAL_H
+#define DASH_THREAD_LOCAL_H
+
+#if defined(_MSC_VER)
+#define DASH_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define DASH_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define DASH_THREAD_LOCAL _Thread_local
+#else
+#define DASH_THREAD_LOCAL
+#endif
+
+/**
+ * Perspective-texture kernels derive the view origin row from `screen_height >> 1`. When a
+ * caller rasters a horizontal band of the viewport (band-relative y, band-sized screen_height),
+ * this holds `band_top + (band_height >> 1) - (viewport_height >> 1)` so the origin stays at the
+ * full viewport center. Zero for ordinary full-viewport rasterization.
+ */
+static DASH_THREAD_LOCAL int g_raster_origin_dy = 0;
+
+#endif
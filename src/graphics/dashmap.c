@@ -2,16 +2,15 @@
 /*
  * dashmap.c
  *
- * Single-buffer, open-addressing hash map with linear probing,
- * using a Postgres-style unified API:
+ * Single-buffer, open-addressing hash map using a Postgres-style unified API:
  *
- *      void *hmap_search(HMap *m, const void *key, HMapAction action);
+ *      void *dashmap_search(DashMap *m, const void *key, DashMapAction action);
  *
  * The returned pointer is to the *entire entry struct* (key + value),
  * just like Postgres's hash_search returns a pointer to the table entry.
  *
  * Layout assumptions (like Postgres):
- *  - You define a struct for your entries, e.g.:
+ *  - You define a struct for your entries, with the key first, e.g.:
  *
  *      typedef struct MyEntry {
  *          MyKey   key;
@@ -21,12 +20,11 @@
  *  - You tell the hash map:
  *      - entry_size   = sizeof(MyEntry)
  *      - key_size     = sizeof(MyKey)
- *      - key_offset   = offsetof(MyEntry, key)
  *
- *  - hmap_search() returns a pointer you can cast to (MyEntry *):
+ *  - dashmap_search() returns a pointer you can cast to (MyEntry *):
  *
  *      MyKey key = ...;
- *      MyEntry *e = hmap_search(&map, &key, HMAP_ENTER);
+ *      MyEntry *e = dashmap_search(map, &key, DASHMAP_INSERT);
  *      if (e) {
  *          e->val = some_value;
  *      }
@@ -34,52 +32,61 @@
  * The map:
  *  - Uses a single caller-provided buffer for all internal storage.
  *  - Does not allocate or free memory.
- *  - Uses linear probing with tombstones.
- *  - Ensures entries are aligned at least to alignof(max_align_t),
- *    so any normal struct can be safely stored and dereferenced.
+ *  - Keeps slot state in a separate control-byte array, one byte per slot, in front of the
+ *    entries (Swiss-table style):
+ *
+ *      [pad to 16] [ctrl bytes, rounded up to 16] [entry 0] [entry 1] ...
+ *
+ *    A full slot's control byte holds 7 bits of its hash; empty, deleted and the sentinel
+ *    bytes past capacity have the high bit set. Slots are probed 16 at a time: one SIMD
+ *    compare of a group's control bytes yields every candidate, so keys are only compared
+ *    on a 7-bit hash match and probing stops at the first group with an empty slot.
+ *  - Entries are packed entry_size apart from a 16-byte aligned base, so they keep the
+ *    alignment of the entry struct.
+ *  - With the default hash/eq, 4- and 8-byte keys are hashed and compared inline as integers;
+ *    other key sizes use FNV-1a and memcmp.
  */
 
-#include <stddef.h> /* size_t, offsetof, max_align_t */
+#include <stddef.h> /* size_t */
 #include <stdint.h> /* uint64_t, uintptr_t */
 #include <string.h> /* memcpy, memcmp */
 
-enum
-{
-    DASHMAP_SLOT_EMPTY = 0,
-    DASHMAP_SLOT_FULL = 1,
-    DASHMAP_SLOT_TOMB = 2
-};
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
 
-/*
- * Each slot in the backing buffer is:
- *
- *   [HMapSlotHeader] [padding to align entry] [entry bytes...]
- *
- * The stride between slots is padded so that:
- *   - Each slot base address is aligned to alignof(max_align_t), and
- *   - The entry region start is also aligned to alignof(max_align_t),
- * so any user-defined entry struct is safely aligned.
- */
-typedef struct HMapSlotHeader
+#define DASHMAP_GROUP_WIDTH 16
+
+#define DASHMAP_CTRL_EMPTY ((uint8_t)0x80)
+#define DASHMAP_CTRL_DELETED ((uint8_t)0xFE)
+/* Pads the last group past capacity; never free and never matches a hash. */
+#define DASHMAP_CTRL_SENTINEL ((uint8_t)0xFF)
+
+// clang-format off
+#include "dashmap_simd.u.c"
+// clang-format on
+
+enum DashMapKeyMode
 {
-    uint64_t hash;   /* 0 means “unused”; we never generate 0 hashes */
-    uint8_t state;   /* HMAP_SLOT_* */
-    uint8_t _pad[7]; /* pad to 16 bytes on typical LP64; safe elsewhere */
-} HMapSlotHeader;
+    DASHMAP_KEY_U32,
+    DASHMAP_KEY_U64,
+    DASHMAP_KEY_BYTES,
+    DASHMAP_KEY_CUSTOM
+};
 
 struct DashMap
 {
-    unsigned char* entries;   /* aligned base pointer to first slot */
-    uint8_t* original_buffer; /* pointer to key data */
-    size_t stride;            /* bytes between slots */
+    uint8_t* ctrl;            /* group_count * 16 control bytes, 16-byte aligned */
+    unsigned char* entries;   /* first entry, directly after the control bytes */
+    uint8_t* original_buffer; /* caller's buffer, returned by resize */
     size_t entry_size;        /* sizeof(user_entry) */
-    size_t entry_offset;      /* offset from slot base to entry bytes */
     size_t key_size;          /* bytes of key */
     size_t capacity;          /* number of slots */
-    size_t size;              /* number of FULL slots */
-
-    dashmap_hash_fn hash_fn;
-    dashmap_eq_fn eq_fn;
+    size_t group_count;       /* capacity rounded up to groups of 16 */
+    size_t size;              /* number of full slots */
+    int key_mode;             /* DASHMAP_KEY_* */
+    dashmap_hash_fn hash_fn;  /* as configured; NULL selects the builtin hash */
+    dashmap_eq_fn eq_fn;      /* as configured; NULL selects the builtin compare */
     dashmap_iterable_fn iterable_fn;
     void* arg; /* user data passed to hash/eq */
 };
@@ -89,16 +96,9 @@ struct DashMap
  *----------------------------------------------------------*/
 
 static inline size_t
-hmap_align_up_size(
-    size_t x,
-    size_t align)
+dashmap_ctrl_size(size_t capacity)
 {
-    if( align == 0 )
-        return x;
-    size_t rem = x % align;
-    if( rem == 0 )
-        return x;
-    return x + (align - rem);
+    return (capacity + (DASHMAP_GROUP_WIDTH - 1)) & ~(size_t)(DASHMAP_GROUP_WIDTH - 1);
 }
 
 static inline unsigned char*
@@ -111,43 +111,59 @@ hmap_align_up_ptr(
     return (unsigned char*)aligned;
 }
 
-static inline unsigned char*
-hmap_slot_base_at(
+static inline void*
+hmap_slot_entry_ptr(
     const struct DashMap* m,
     size_t idx)
 {
-    return m->entries + m->stride * idx;
+    return (void*)(m->entries + m->entry_size * idx);
 }
 
-static inline HMapSlotHeader*
-hmap_slot_header_at(
-    const struct DashMap* m,
-    size_t idx)
+static inline int
+dashmap_ctz(uint32_t x)
 {
-    return (HMapSlotHeader*)hmap_slot_base_at(m, idx);
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return (int)i;
+#else
+    return __builtin_ctz(x);
+#endif
 }
 
-static inline void*
-hmap_slot_entry_ptr(
-    const struct DashMap* m,
-    size_t idx)
+/*-----------------------------------------------------------
+ * Hashing
+ *----------------------------------------------------------*/
+
+/* murmur3 fmix64; spreads integer keys over both the group index and the 7-bit tag. */
+static inline uint64_t
+dashmap_mix64(uint64_t h)
 {
-    return (void*)(hmap_slot_base_at(m, idx) + m->entry_offset);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
 }
 
-/* key pointer inside an entry */
-static inline void*
-hmap_entry_key_ptr(
-    const struct DashMap* m,
-    void* entry)
+static inline uint32_t
+dashmap_load_u32(const void* p)
 {
-    return (unsigned char*)entry;
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
 }
 
-/*-----------------------------------------------------------
- * Simple default hash / eq for arbitrary byte keys (FNV-1a)
- *----------------------------------------------------------*/
+static inline uint64_t
+dashmap_load_u64(const void* p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
 
+/* Default hash for arbitrary byte keys (FNV-1a) */
 static uint64_t
 dashmap_hash_bytes(
     const void* key,
@@ -162,38 +178,79 @@ dashmap_hash_bytes(
         h ^= (uint64_t)p[i];
         h *= 1099511628211ULL; /* FNV prime */
     }
-    if( h == 0 )
-        h = 1; /* reserve 0 as sentinel */
     return h;
 }
 
-static int
-dashmap_eq_bytes(
-    const void* a,
-    const void* b,
-    size_t len,
-    void* arg)
+static inline uint64_t
+dashmap_hash_key(
+    const struct DashMap* m,
+    const void* key)
 {
-    (void)arg;
-    return memcmp(a, b, len) == 0;
+    switch( m->key_mode )
+    {
+    case DASHMAP_KEY_U32:
+        return dashmap_mix64(dashmap_load_u32(key));
+    case DASHMAP_KEY_U64:
+        return dashmap_mix64(dashmap_load_u64(key));
+    case DASHMAP_KEY_BYTES:
+        return dashmap_mix64(dashmap_hash_bytes(key, m->key_size, NULL));
+    default:
+        /* User hashes may be weak in the high bits used for the group index. */
+        return dashmap_mix64(m->hash_fn(key, m->key_size, m->arg));
+    }
+}
+
+static inline int
+dashmap_key_eq(
+    const struct DashMap* m,
+    const void* entry_key,
+    const void* key)
+{
+    switch( m->key_mode )
+    {
+    case DASHMAP_KEY_U32:
+        return dashmap_load_u32(entry_key) == dashmap_load_u32(key);
+    case DASHMAP_KEY_U64:
+        return dashmap_load_u64(entry_key) == dashmap_load_u64(key);
+    case DASHMAP_KEY_BYTES:
+        return memcmp(entry_key, key, m->key_size) == 0;
+    default:
+        if( m->eq_fn )
+            return m->eq_fn(entry_key, key, m->key_size, m->arg);
+        return memcmp(entry_key, key, m->key_size) == 0;
+    }
+}
+
+static inline int
+dashmap_key_mode_for(
+    size_t key_size,
+    dashmap_hash_fn hash_fn,
+    dashmap_eq_fn eq_fn)
+{
+    if( hash_fn || eq_fn )
+        return DASHMAP_KEY_CUSTOM;
+    if( key_size == sizeof(uint32_t) )
+        return DASHMAP_KEY_U32;
+    if( key_size == sizeof(uint64_t) )
+        return DASHMAP_KEY_U64;
+    return DASHMAP_KEY_BYTES;
 }
 
 /*
- * Initialize an HMap in-place, using a single caller-provided buffer.
+ * Initialize a DashMap in-place, using a single caller-provided buffer.
  *
- *  m           : pointer to HMap struct to initialize
- *  buffer      : backing storage for all slots
+ *  m           : pointer to DashMap struct to initialize
+ *  buffer      : backing storage for control bytes and entries
  *  buffer_size : size of backing storage in bytes
  *  entry_size  : sizeof(user_entry)
- *  key_size    : number of bytes in the key (portion inside entry)
- *  key_offset  : offset inside the entry where the key resides (like offsetof)
- *  capacity    : number of slots (must be > 0)
- *  hash_fn     : user hash function (must not be NULL)
- *  eq_fn       : user equality function (must not be NULL)
+ *  key_size    : number of bytes in the key (at the start of the entry)
+ *  capacity    : number of slots; 0 fits as many as the buffer holds
+ *  hash_fn     : user hash function, or NULL for the builtin hash
+ *  eq_fn       : user equality function, or NULL for the builtin compare
  *  arg         : user data passed to hash_fn / eq_fn
  *
  * Returns:
- *   HMAP_OK, HMAP_NOMEM, HMAP_BADARG
+ *   DASHMAP_OK, DASHMAP_NOMEM, DASHMAP_BADARG
  */
 int
 dashmap_init(
@@ -213,66 +270,55 @@ dashmap_init(
         return DASHMAP_BADARG;
     }
 
-    if( hash_fn == NULL )
-        hash_fn = dashmap_hash_bytes;
-    if( eq_fn == NULL )
-        eq_fn = dashmap_eq_bytes;
-
     if( key_size > entry_size )
         return DASHMAP_BADARG;
 
     memset(m, 0, sizeof(*m));
     memset(buffer, 0, buffer_size);
 
-    const size_t align = 16;
-
     unsigned char* base = (unsigned char*)buffer;
-    unsigned char* aligned = hmap_align_up_ptr(base, align);
+    unsigned char* aligned = hmap_align_up_ptr(base, DASHMAP_GROUP_WIDTH);
 
     if( aligned > base + buffer_size )
         return DASHMAP_NOMEM;
 
     size_t remaining = (size_t)((base + buffer_size) - aligned);
 
-    size_t header_size = sizeof(HMapSlotHeader);
-    size_t entry_offset = hmap_align_up_size(header_size, align);
-    size_t raw_stride = entry_offset + entry_size;
-    size_t stride = hmap_align_up_size(raw_stride, align);
-
-    /* NEW LOGIC: auto capacity */
     size_t actual_capacity = capacity;
-
     if( actual_capacity == 0 )
     {
-        actual_capacity = remaining / stride;
+        /* One control byte per slot, plus up to a group of padding. */
+        actual_capacity = remaining / (entry_size + 1);
+        while( actual_capacity > 0 &&
+               dashmap_ctrl_size(actual_capacity) + actual_capacity * entry_size > remaining )
+            actual_capacity--;
         if( actual_capacity == 0 )
             return DASHMAP_NOMEM;
     }
 
-    size_t needed = actual_capacity * stride;
-    if( needed > remaining )
+    size_t ctrl_size = dashmap_ctrl_size(actual_capacity);
+    if( ctrl_size + actual_capacity * entry_size > remaining )
         return DASHMAP_NOMEM;
 
-    m->entries = aligned;
+    m->ctrl = aligned;
+    m->entries = aligned + ctrl_size;
     m->original_buffer = buffer;
-    m->stride = stride;
     m->entry_size = entry_size;
-    m->entry_offset = entry_offset;
     m->key_size = key_size;
     m->capacity = actual_capacity;
+    m->group_count = ctrl_size / DASHMAP_GROUP_WIDTH;
     m->size = 0;
+    m->key_mode = dashmap_key_mode_for(key_size, hash_fn, eq_fn);
     m->hash_fn = hash_fn;
     m->eq_fn = eq_fn;
     m->iterable_fn = iterable_fn;
     m->arg = arg;
 
-    /* Initialize headers */
-    for( size_t i = 0; i < actual_capacity; i++ )
-    {
-        HMapSlotHeader* h = hmap_slot_header_at(m, i);
-        h->state = DASHMAP_SLOT_EMPTY;
-        h->hash = 0;
-    }
+    if( m->key_mode == DASHMAP_KEY_CUSTOM && !m->hash_fn )
+        m->hash_fn = dashmap_hash_bytes;
+
+    memset(m->ctrl, DASHMAP_CTRL_EMPTY, actual_capacity);
+    memset(m->ctrl + actual_capacity, DASHMAP_CTRL_SENTINEL, ctrl_size - actual_capacity);
 
     return DASHMAP_OK;
 }
@@ -322,29 +368,34 @@ dashmap_free(struct DashMap* m)
 /*
  * Core unified operation (Postgres-like):
  *
- *  void *hmap_search(HMap *m, const void *key, HMapAction action);
+ *  void *dashmap_search(DashMap *m, const void *key, DashMapAction action);
  *
  *  key    : pointer to key bytes (not to the whole entry)
- *  action : HMAP_FIND / HMAP_ENTER / HMAP_REMOVE
+ *  action : DASHMAP_FIND / DASHMAP_INSERT / DASHMAP_REMOVE
  *
  * Returns:
  *  - pointer to entry (user struct) on success
  *  - NULL on:
- *      - HMAP_FIND: key not found
- *      - HMAP_ENTER: table full and no slot available
- *      - HMAP_REMOVE: key not found
+ *      - DASHMAP_FIND: key not found
+ *      - DASHMAP_INSERT: table full and no slot available
+ *      - DASHMAP_REMOVE: key not found
  *
  * Notes:
- *  - For HMAP_ENTER, if the key already exists, you just get the existing
+ *  - For DASHMAP_INSERT, if the key already exists, you just get the existing
  *    entry pointer (no new insert).
- *  - For HMAP_ENTER, if the key does not exist and there is a free slot,
- *    a new entry is created; the key bytes are copied into the entry's key
- *    field (key_offset), and the rest of the entry is left uninitialized;
+ *  - For DASHMAP_INSERT, if the key does not exist and there is a free slot,
+ *    a new entry is created; the key bytes are copied into the start of the
+ *    entry, and the rest of the entry is left as it was;
  *    the pointer returned is to the full entry (you fill in the value).
- *  - For HMAP_REMOVE, if the key exists, the slot is marked as a tombstone,
- *    but the returned pointer points to the entry bytes that were there.
+ *  - For DASHMAP_REMOVE, if the key exists, the slot is freed, but the
+ *    returned pointer points to the entry bytes that were there.
  *    As with Postgres, this pointer is only valid until the next
  *    insertion/clear/destroy affecting that slot.
+ *
+ * Probing visits whole groups of 16 slots, starting at a group picked by the
+ * high hash bits and wrapping linearly. A group that still has an EMPTY slot
+ * ends the probe: no key was ever pushed past it. Removal therefore only
+ * writes EMPTY when its group already has one, and DELETED otherwise.
  */
 void*
 dashmap_search(
@@ -352,108 +403,68 @@ dashmap_search(
     const void* key,
     enum DashMapAction action)
 {
-    if( !m || !m->entries || !key )
+    if( !m || !m->ctrl || !key )
         return NULL;
 
     if( m->capacity == 0 )
         return NULL;
 
-    uint64_t hash = m->hash_fn(key, m->key_size, m->arg);
-    if( hash == 0 )
-        hash = 1; /* reserve hash=0 as sentinel */
+    uint64_t hash = dashmap_hash_key(m, key);
+    uint8_t h2 = (uint8_t)(hash & 0x7F);
+    size_t group = (size_t)(((hash >> 32) * (uint64_t)m->group_count) >> 32);
+    size_t insert_slot = SIZE_MAX;
 
-    size_t idx = hash % m->capacity;
-    size_t start = idx;
-    int64_t tomb_i = -1;
-
-    for( ;; )
+    for( size_t probe = 0; probe < m->group_count; probe++ )
     {
-        HMapSlotHeader* h = hmap_slot_header_at(m, idx);
-
-        if( h->state == DASHMAP_SLOT_EMPTY )
-        {
-            /* ---------- NOT FOUND ---------- */
-
-            if( action == DASHMAP_FIND || action == DASHMAP_REMOVE )
-            {
-                return NULL;
-            }
-
-            /* DASHMAP_ENTER: insert into first tombstone or this empty slot */
-            if( tomb_i >= 0 )
-                idx = (size_t)tomb_i;
-
-            HMapSlotHeader* hh = hmap_slot_header_at(m, idx);
-            hh->state = DASHMAP_SLOT_FULL;
-            hh->hash = hash;
+        const uint8_t* ctrl = m->ctrl + group * DASHMAP_GROUP_WIDTH;
 
-            void* entry = hmap_slot_entry_ptr(m, idx);
-            void* ekey = hmap_entry_key_ptr(m, entry);
-
-            memcpy(ekey, key, m->key_size);
-            m->size++;
-
-            return entry;
-        }
-        else if( h->state == DASHMAP_SLOT_TOMB )
+        uint32_t match = dashmap_group_match(ctrl, h2);
+        while( match )
         {
-            /* remember the first tombstone for possible reuse on ENTER */
-            if( tomb_i < 0 )
-                tomb_i = (uint32_t)idx;
-        }
-        else if( h->state == DASHMAP_SLOT_FULL && h->hash == hash )
-        {
-            /* Possible match */
-            void* entry = hmap_slot_entry_ptr(m, idx);
-            void* ekey = hmap_entry_key_ptr(m, entry);
-
-            if( m->eq_fn(ekey, key, m->key_size, m->arg) )
+            size_t slot = group * DASHMAP_GROUP_WIDTH + (size_t)dashmap_ctz(match);
+            void* entry = hmap_slot_entry_ptr(m, slot);
+            if( dashmap_key_eq(m, entry, key) )
             {
                 if( action == DASHMAP_REMOVE )
                 {
-                    h->state = DASHMAP_SLOT_TOMB;
-                    h->hash = 0;
-                    if( m->size > 0 )
-                        m->size--;
-                    return entry; /* return old entry */
+                    m->ctrl[slot] = dashmap_group_match_empty(ctrl) ? DASHMAP_CTRL_EMPTY
+                                                                    : DASHMAP_CTRL_DELETED;
+                    m->size--;
                 }
 
-                /* FIND or ENTER (existing) */
+                /* FIND, INSERT (existing) or the removed entry */
                 return entry;
             }
+            match &= match - 1;
         }
 
-        /* move to next slot (linear probing with wrap) */
-        idx++;
-        if( idx == m->capacity )
-            idx = 0;
+        uint32_t empty = dashmap_group_match_empty(ctrl);
+        if( action == DASHMAP_INSERT && insert_slot == SIZE_MAX )
+        {
+            /* remember the first free slot; the key may still be further along */
+            uint32_t free_slots = empty ? empty : dashmap_group_match_free(ctrl);
+            if( free_slots )
+                insert_slot = group * DASHMAP_GROUP_WIDTH + (size_t)dashmap_ctz(free_slots);
+        }
 
-        if( idx == start )
-            break; /* full cycle */
-    }
+        if( empty )
+            break;
 
-    /* Full cycle: either table is full or key not found.
-     *
-     * For FIND/REMOVE, we've already exhausted possibilities -> NULL.
-     * For ENTER, we may still be able to reuse a tombstone.
-     */
-    if( action == DASHMAP_INSERT && tomb_i >= 0 )
-    {
-        size_t t = (size_t)tomb_i;
-        HMapSlotHeader* hh = hmap_slot_header_at(m, t);
-        hh->state = DASHMAP_SLOT_FULL;
-        hh->hash = hash;
+        group++;
+        if( group == m->group_count )
+            group = 0;
+    }
 
-        void* entry = hmap_slot_entry_ptr(m, t);
-        void* ekey = hmap_entry_key_ptr((void*)m, entry);
+    if( action != DASHMAP_INSERT || insert_slot == SIZE_MAX )
+        return NULL;
 
-        memcpy(ekey, key, m->key_size);
-        m->size++;
+    m->ctrl[insert_slot] = h2;
 
-        return entry;
-    }
+    void* entry = hmap_slot_entry_ptr(m, insert_slot);
+    memcpy(entry, key, m->key_size);
+    m->size++;
 
-    return NULL;
+    return entry;
 }
 
 /*
@@ -468,13 +479,13 @@ dashmap_search(
  *
  * Notes:
  *    - All entries are rehashed and reinserted.
- *    - The map metadata (stride, entry_offset, etc.) is recomputed.
+ *    - The map layout (control bytes, groups) is recomputed.
  *    - On failure, *m and *old_buffer_out remain unchanged.
  *
  * Returns:
- *    HMAP_OK
- *    HMAP_NOMEM
- *    HMAP_BADARG
+ *    DASHMAP_OK
+ *    DASHMAP_NOMEM
+ *    DASHMAP_BADARG
  */
 int
 dashmap_resize(
@@ -512,25 +523,22 @@ dashmap_resize(
     /* Reinsert all full entries */
     for( size_t i = 0; i < oldcap; i++ )
     {
-        HMapSlotHeader* h = (HMapSlotHeader*)(old.entries + old.stride * i);
+        if( old.ctrl[i] & DASHMAP_CTRL_EMPTY )
+            continue;
 
-        if( h->state == DASHMAP_SLOT_FULL )
-        {
-            void* old_entry = (void*)(old.entries + old.entry_offset + old.stride * i);
-            void* old_key = (unsigned char*)old_entry;
+        void* old_entry = (void*)(old.entries + old.entry_size * i);
 
-            /* Insert into new table */
-            void* dst = dashmap_search(&newmap, old_key, DASHMAP_INSERT);
-            if( !dst )
-            {
-                /* Failure: restore original map */
-                *m = old;
-                return DASHMAP_NOMEM;
-            }
-
-            /* Copy entire entry struct */
-            memcpy(dst, old_entry, old.entry_size);
+        /* Insert into new table */
+        void* dst = dashmap_search(&newmap, old_entry, DASHMAP_INSERT);
+        if( !dst )
+        {
+            /* Failure: restore original map */
+            *m = old;
+            return DASHMAP_NOMEM;
         }
+
+        /* Copy entire entry struct */
+        memcpy(dst, old_entry, old.entry_size);
     }
 
     /* Success — publish new map */
@@ -580,15 +588,14 @@ dashmap_iter_free(struct DashMapIter* it)
 void*
 dashmap_iter_next(struct DashMapIter* it)
 {
-    if( !it || !it->m || !it->m->entries )
+    if( !it || !it->m || !it->m->ctrl )
         return NULL;
 
     while( it->idx < it->m->capacity )
     {
         size_t cur = it->idx;
         it->idx++;
-        HMapSlotHeader* h = hmap_slot_header_at(it->m, cur);
-        if( h->state == DASHMAP_SLOT_FULL )
+        if( !(it->m->ctrl[cur] & DASHMAP_CTRL_EMPTY) )
         {
             void* entry = hmap_slot_entry_ptr(it->m, cur);
             if( !it->m->iterable_fn || it->m->iterable_fn(entry, it->m->arg) != 0 )
@@ -619,9 +626,5 @@ dashmap_buffer_size_for(
     size_t entry_size,
     size_t count)
 {
-    const size_t align = 16;
-    size_t header_size = sizeof(HMapSlotHeader);
-    size_t entry_offset = hmap_align_up_size(header_size, align);
-    size_t stride = hmap_align_up_size(entry_offset + entry_size, align);
-    return count * stride + (align - 1);
-}
\ No newline at end of file
+    return dashmap_ctrl_size(count) + count * entry_size + (DASHMAP_GROUP_WIDTH - 1);
+}
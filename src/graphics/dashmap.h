@@ -16,7 +16,8 @@
  *   - key_size is the size of the key bytes
  *   - arg is user-supplied context
  *
- * Must never return 0; if so, the table will map it to 1.
+ * The result is re-mixed before use, so any value (including 0) is fine.
+ * With no hash/eq callbacks, 4- and 8-byte keys are hashed and compared inline.
  */
 typedef uint64_t (*dashmap_hash_fn)(
     const void* key,
@@ -107,8 +108,8 @@ dashmap_entry_size(struct DashMap* h);
 
 /**
  * Compute the minimum buffer size (bytes) needed to hold `count` slots
- * of entries that are `entry_size` bytes each, accounting for internal
- * header and alignment overhead.
+ * of entries that are `entry_size` bytes each, accounting for the
+ * per-slot control byte and alignment overhead.
  */
 size_t
 dashmap_buffer_size_for(
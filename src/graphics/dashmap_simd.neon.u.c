@@ -0,0 +1,37 @@
+#include <arm_neon.h>
+#include <stdint.h>
+
+/* NEON has no movemask; weight each lane by its bit and sum the two halves. */
+static inline uint32_t
+dashmap_neon_movemask(uint8x16_t eq)
+{
+    static const uint8_t weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128,
+                                         1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t bits = vandq_u8(eq, vld1q_u8(weights));
+    uint32_t lo = vaddv_u8(vget_low_u8(bits));
+    uint32_t hi = vaddv_u8(vget_high_u8(bits));
+    return lo | (hi << 8);
+}
+
+static inline uint32_t
+dashmap_group_match_neon(
+    const uint8_t* ctrl,
+    uint8_t h2)
+{
+    return dashmap_neon_movemask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(h2)));
+}
+
+static inline uint32_t
+dashmap_group_match_empty_neon(const uint8_t* ctrl)
+{
+    return dashmap_neon_movemask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(DASHMAP_CTRL_EMPTY)));
+}
+
+static inline uint32_t
+dashmap_group_match_free_neon(const uint8_t* ctrl)
+{
+    uint8x16_t group = vld1q_u8(ctrl);
+    uint8x16_t empty = vceqq_u8(group, vdupq_n_u8(DASHMAP_CTRL_EMPTY));
+    uint8x16_t deleted = vceqq_u8(group, vdupq_n_u8(DASHMAP_CTRL_DELETED));
+    return dashmap_neon_movemask(vorrq_u8(empty, deleted));
+}
@@ -0,0 +1,27 @@
+#include <stdint.h>
+
+static inline uint32_t
+dashmap_group_match_scalar(
+    const uint8_t* ctrl,
+    uint8_t h2)
+{
+    uint32_t mask = 0;
+    for( int i = 0; i < DASHMAP_GROUP_WIDTH; i++ )
+        mask |= (uint32_t)(ctrl[i] == h2) << i;
+    return mask;
+}
+
+static inline uint32_t
+dashmap_group_match_empty_scalar(const uint8_t* ctrl)
+{
+    return dashmap_group_match_scalar(ctrl, DASHMAP_CTRL_EMPTY);
+}
+
+static inline uint32_t
+dashmap_group_match_free_scalar(const uint8_t* ctrl)
+{
+    uint32_t mask = 0;
+    for( int i = 0; i < DASHMAP_GROUP_WIDTH; i++ )
+        mask |= (uint32_t)(ctrl[i] == DASHMAP_CTRL_EMPTY || ctrl[i] == DASHMAP_CTRL_DELETED) << i;
+    return mask;
+}
@@ -0,0 +1,28 @@
+#include <emmintrin.h>
+#include <stdint.h>
+
+static inline uint32_t
+dashmap_group_match_sse2(
+    const uint8_t* ctrl,
+    uint8_t h2)
+{
+    __m128i group = _mm_load_si128((const __m128i*)ctrl);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+}
+
+static inline uint32_t
+dashmap_group_match_empty_sse2(const uint8_t* ctrl)
+{
+    __m128i group = _mm_load_si128((const __m128i*)ctrl);
+    __m128i empty = _mm_set1_epi8((char)DASHMAP_CTRL_EMPTY);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, empty));
+}
+
+static inline uint32_t
+dashmap_group_match_free_sse2(const uint8_t* ctrl)
+{
+    __m128i group = _mm_load_si128((const __m128i*)ctrl);
+    __m128i empty = _mm_cmpeq_epi8(group, _mm_set1_epi8((char)DASHMAP_CTRL_EMPTY));
+    __m128i deleted = _mm_cmpeq_epi8(group, _mm_set1_epi8((char)DASHMAP_CTRL_DELETED));
+    return (uint32_t)_mm_movemask_epi8(_mm_or_si128(empty, deleted));
+}
@@ -0,0 +1,27 @@
+#ifndef DASHMAP_SIMD_U_C
+#define DASHMAP_SIMD_U_C
+
+#include <stdint.h>
+
+/* Control-byte group matching for dashmap.c. Each returns a bitmask with bit i set when byte i of
+ * the 16-byte group matches. */
+
+#if ( defined(__ARM_NEON) || defined(__ARM_NEON__) ) && defined(__aarch64__) &&                  \
+    !defined(NEON_DISABLED)
+#include "dashmap_simd.neon.u.c"
+#define dashmap_group_match dashmap_group_match_neon
+#define dashmap_group_match_empty dashmap_group_match_empty_neon
+#define dashmap_group_match_free dashmap_group_match_free_neon
+#elif defined(__SSE2__) && !defined(SSE2_DISABLED)
+#include "dashmap_simd.sse2.u.c"
+#define dashmap_group_match dashmap_group_match_sse2
+#define dashmap_group_match_empty dashmap_group_match_empty_sse2
+#define dashmap_group_match_free dashmap_group_match_free_sse2
+#else
+#include "dashmap_simd.scalar.u.c"
+#define dashmap_group_match dashmap_group_match_scalar
+#define dashmap_group_match_empty dashmap_group_match_empty_scalar
+#define dashmap_group_match_free dashmap_group_match_free_scalar
+#endif
+
+#endif
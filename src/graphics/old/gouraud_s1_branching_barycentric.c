@@ -190,14 +190,14 @@ raster_gouraud_bary_branching_s1_ordered(
 
     int offset = y0 * stride;
 
-    if( y1 >= screen_height )
+    if( y1 > screen_height )
     {
-        y1 = screen_height - 1;
-        y2 = screen_height - 1;
+        y1 = screen_height;
+        y2 = screen_height;
     }
-    else if( y2 >= screen_height )
+    else if( y2 > screen_height )
     {
-        y2 = screen_height - 1;
+        y2 = screen_height;
     }
 
     if( (y0 == y1 && step_edge_x_AC_ish16 <= step_edge_x_BC_ish16) ||
@@ -1,16 +1,18 @@
 #ifndef RENDER_CLIP_U_C
 #define RENDER_CLIP_U_C
 
+#include "../dash_thread_local.h"
 #include "../shared_tables.h"
 
 // clang-format off
 #include "../projection.u.c"
 // clang-format on
 
-static int g_clip_x[10] = { 0 };
-static int g_clip_y[10] = { 0 };
+/* Thread-local: near-clip scratch is written by whichever thread rasters the face. */
+static DASH_THREAD_LOCAL int g_clip_x[10] = { 0 };
+static DASH_THREAD_LOCAL int g_clip_y[10] = { 0 };
 
-static int g_clip_color[10] = { 0 };
+static DASH_THREAD_LOCAL int g_clip_color[10] = { 0 };
 static const int g_reciprocol_shift = 16;
 
 static inline int
@@ -1254,12 +1254,75 @@ raster_texture_flat(
     int orthographic_z2,
     int shade,
     int* RESTRICT texels,
+    const uint8_t* RESTRICT texel_indices,
+    const int* RESTRICT palette,
     int texture_size,
     int texture_opaque,
     int near_plane_z,
     int offset_x,
     int offset_y)
 {
+    if( texel_indices )
+    {
+        if( texture_opaque )
+        {
+            raster_texshadeflat_persp_texopaque_branching_lerp8_pal8(
+                pixel_buffer,
+                stride,
+                screen_width,
+                screen_height,
+                camera_fov,
+                screen_x0,
+                screen_x1,
+                screen_x2,
+                screen_y0,
+                screen_y1,
+                screen_y2,
+                orthographic_x0,
+                orthographic_x1,
+                orthographic_x2,
+                orthographic_y0,
+                orthographic_y1,
+                orthographic_y2,
+                orthographic_z0,
+                orthographic_z1,
+                orthographic_z2,
+                shade,
+                texel_indices,
+                palette,
+                texture_size);
+        }
+        else
+        {
+            raster_texshadeflat_persp_textrans_branching_lerp8_pal8(
+                pixel_buffer,
+                stride,
+                screen_width,
+                screen_height,
+                camera_fov,
+                screen_x0,
+                screen_x1,
+                screen_x2,
+                screen_y0,
+                screen_y1,
+                screen_y2,
+                orthographic_x0,
+                orthographic_x1,
+                orthographic_x2,
+                orthographic_y0,
+                orthographic_y1,
+                orthographic_y2,
+                orthographic_z0,
+                orthographic_z1,
+                orthographic_z2,
+                shade,
+                texel_indices,
+                palette,
+                texture_size);
+        }
+        return;
+    }
+
     if( texture_opaque )
     {
         raster_texshadeflat_persp_texopaque_branching_lerp8(
@@ -1990,6 +2053,8 @@ raster_face_texture_flat_near_clip(
     int* RESTRICT orthographic_vertices_z,
     hsl16_t* RESTRICT colors,
     int* RESTRICT texels,
+    const uint8_t* RESTRICT texel_indices,
+    const int* RESTRICT palette,
     int texture_size,
     int texture_opaque,
     int near_plane_z,
@@ -2230,6 +2295,8 @@ raster_face_texture_flat_near_clip(
             orthographic_z2,
             color,
             texels,
+            texel_indices,
+            palette,
             texture_size,
             texture_opaque,
             near_plane_z,
@@ -2316,6 +2383,8 @@ raster_face_texture_flat_near_clip(
             orthographic_z2,
             color,
             texels,
+            texel_indices,
+            palette,
             texture_size,
             texture_opaque,
             near_plane_z,
@@ -2345,6 +2414,8 @@ raster_face_texture_flat(
     int* RESTRICT orthographic_vertices_z,
     hsl16_t* RESTRICT colors,
     int* RESTRICT texels,
+    const uint8_t* RESTRICT texel_indices,
+    const int* RESTRICT palette,
     int texture_size,
     int texture_opaque,
     int near_plane_z,
@@ -2380,6 +2451,8 @@ raster_face_texture_flat(
             orthographic_vertices_z,
             colors,
             texels,
+            texel_indices,
+            palette,
             texture_size,
             texture_opaque,
             near_plane_z,
@@ -2471,6 +2544,8 @@ raster_face_texture_flat(
             orthographic_z2,
             shade,
             texels,
+            texel_indices,
+            palette,
             texture_size,
             texture_opaque,
             near_plane_z,
@@ -37,6 +37,10 @@
 #include "../raster/texture/texshadeflat.persp.textrans.ordered.lerp8.scanline.u.c"
 #include "../raster/texture/texshadeflat.persp.texopaque.branching.lerp8.u.c"
 #include "../raster/texture/texshadeflat.persp.textrans.branching.lerp8.u.c"
+#include "../raster/texture/texshadeflat.persp.texopaque.ordered.lerp8.pal8.scanline.u.c"
+#include "../raster/texture/texshadeflat.persp.textrans.ordered.lerp8.pal8.scanline.u.c"
+#include "../raster/texture/texshadeflat.persp.texopaque.branching.lerp8.pal8.u.c"
+#include "../raster/texture/texshadeflat.persp.textrans.branching.lerp8.pal8.u.c"
 #include "../raster/texture/texshadeblend.persp.textrans.sort.lerp8.u.c"
 #include "../raster/texture/texshadeblend.persp.texopaque.sort.lerp8.u.c"
 #include "../raster/texture/texshadeflat.persp.textrans.sort.lerp8.u.c"
@@ -0,0 +1,102 @@
+#ifndef TEX_PAL8_SPAN_AVX_U_C
+#define TEX_PAL8_SPAN_AVX_U_C
+
+#include "graphics/dash_restrict.h"
+#include "graphics/shade.h"
+
+#include <assert.h>
+#include <immintrin.h>
+#include <stdint.h>
+
+/* AVX2 lerp8 spans for palettized textures. Names prefixed so this TU can coexist with
+ * tex.span.*. */
+
+static inline __m256i
+pal8_shade_blend8_avx2(
+    __m256i texel,
+    int shade)
+{
+    __m256i texel_lo = _mm256_unpacklo_epi8(texel, _mm256_setzero_si256());
+    __m256i texel_hi = _mm256_unpackhi_epi8(texel, _mm256_setzero_si256());
+    __m256i shade_16 = _mm256_set1_epi16(shade);
+    texel_lo = _mm256_mullo_epi16(texel_lo, shade_16);
+    texel_hi = _mm256_mullo_epi16(texel_hi, shade_16);
+    texel_lo = _mm256_srli_epi16(texel_lo, 8);
+    texel_hi = _mm256_srli_epi16(texel_hi, 8);
+    return _mm256_packus_epi16(texel_lo, texel_hi);
+}
+
+/* All 8 lerp steps at once, then two hardware gathers: 32-bit loads at byte offsets into the
+ * index array (masked to the low byte), then the palette. The index array carries 3 bytes of
+ * padding so the load at the last texel stays in bounds. */
+static inline __m256i
+pal8_gather8_avx2(
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift)
+{
+    assert(texture_shift == 7 || texture_shift == 6);
+    int mask = texture_shift == 7 ? 0x3f80 : 0x0fc0;
+
+    __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i u = _mm256_add_epi32(
+        _mm256_set1_epi32(u_scan), _mm256_mullo_epi32(lane, _mm256_set1_epi32(step_u)));
+    __m256i v = _mm256_add_epi32(
+        _mm256_set1_epi32(v_scan), _mm256_mullo_epi32(lane, _mm256_set1_epi32(step_v)));
+    __m256i idx = _mm256_add_epi32(
+        _mm256_sra_epi32(u, _mm_cvtsi32_si128(texture_shift)),
+        _mm256_and_si256(v, _mm256_set1_epi32(mask)));
+
+    __m256i bytes = _mm256_i32gather_epi32((const int*)texel_indices, idx, 1);
+    bytes = _mm256_and_si256(bytes, _mm256_set1_epi32(0xff));
+    return _mm256_i32gather_epi32((const int*)palette, bytes, 4);
+}
+
+static inline void
+raster_linear_transparent_texshadeflat_lerp8_pal8(
+    uint32_t* RESTRICT pixel_buffer,
+    int offset,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift,
+    int shade)
+{
+    __m256i t = pal8_gather8_avx2(
+        texel_indices, palette, u_scan, v_scan, step_u, step_v, texture_shift);
+    __m256i r = pal8_shade_blend8_avx2(t, shade);
+
+    // Keep the existing pixel where the texel is 0 (transparent).
+    __m256i existing = _mm256_loadu_si256((__m256i*)&pixel_buffer[offset]);
+    __m256i mask = _mm256_cmpeq_epi32(t, _mm256_setzero_si256());
+    r = _mm256_blendv_epi8(r, existing, mask);
+
+    _mm256_storeu_si256((__m256i*)&pixel_buffer[offset], r);
+}
+
+static inline void
+raster_linear_opaque_texshadeflat_lerp8_pal8(
+    uint32_t* RESTRICT pixel_buffer,
+    int offset,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift,
+    int shade)
+{
+    __m256i t = pal8_gather8_avx2(
+        texel_indices, palette, u_scan, v_scan, step_u, step_v, texture_shift);
+    _mm256_storeu_si256((__m256i*)&pixel_buffer[offset], pal8_shade_blend8_avx2(t, shade));
+}
+
+#endif /* TEX_PAL8_SPAN_AVX_U_C */
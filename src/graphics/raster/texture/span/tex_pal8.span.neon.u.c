@@ -0,0 +1,104 @@
+#ifndef TEX_PAL8_SPAN_NEON_U_C
+#define TEX_PAL8_SPAN_NEON_U_C
+
+#include "graphics/dash_restrict.h"
+#include "graphics/shade.h"
+
+#include <arm_neon.h>
+#include <assert.h>
+#include <stdint.h>
+
+/* NEON lerp8 spans for palettized textures. Names prefixed so this TU can coexist with
+ * tex.span.*. */
+
+static inline uint32x4_t
+pal8_shade_blend4_neon(
+    uint32x4_t texel,
+    int shade)
+{
+    uint8x16_t texel_u8 = vreinterpretq_u8_u32(texel);
+    uint16x8_t lo = vmovl_u8(vget_low_u8(texel_u8));
+    uint16x8_t hi = vmovl_u8(vget_high_u8(texel_u8));
+    lo = vshrq_n_u16(vmulq_n_u16(lo, shade), 8);
+    hi = vshrq_n_u16(vmulq_n_u16(hi, shade), 8);
+    return vreinterpretq_u32_u8(vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)));
+}
+
+/* Resolves 8 texels through the palette. The indices are 1 byte each, so the 8 lookups touch a
+ * quarter of the cache lines the int32 layout would. */
+static inline void
+pal8_gather_lerp8(
+    uint32_t* RESTRICT out,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift)
+{
+    assert(texture_shift == 7 || texture_shift == 6);
+    int mask = texture_shift == 7 ? 0x3f80 : 0x0fc0;
+    for( int i = 0; i < 8; i++ )
+    {
+        int u = u_scan >> texture_shift;
+        int v = v_scan & mask;
+        out[i] = palette[texel_indices[u + v]];
+        u_scan += step_u;
+        v_scan += step_v;
+    }
+}
+
+static inline void
+raster_linear_transparent_texshadeflat_lerp8_pal8(
+    uint32_t* RESTRICT pixel_buffer,
+    int offset,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift,
+    int shade)
+{
+    uint32_t texels[8];
+    pal8_gather_lerp8(
+        texels, texel_indices, palette, u_scan, v_scan, step_u, step_v, texture_shift);
+
+    uint32x4_t t0 = vld1q_u32(&texels[0]);
+    uint32x4_t t1 = vld1q_u32(&texels[4]);
+    uint32x4_t r0 = pal8_shade_blend4_neon(t0, shade);
+    uint32x4_t r1 = pal8_shade_blend4_neon(t1, shade);
+
+    // Keep the existing pixel where the texel is 0 (transparent).
+    uint32x4_t zero = vdupq_n_u32(0);
+    r0 = vbslq_u32(vceqq_u32(t0, zero), vld1q_u32(&pixel_buffer[offset]), r0);
+    r1 = vbslq_u32(vceqq_u32(t1, zero), vld1q_u32(&pixel_buffer[offset + 4]), r1);
+
+    vst1q_u32(&pixel_buffer[offset], r0);
+    vst1q_u32(&pixel_buffer[offset + 4], r1);
+}
+
+static inline void
+raster_linear_opaque_texshadeflat_lerp8_pal8(
+    uint32_t* RESTRICT pixel_buffer,
+    int offset,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift,
+    int shade)
+{
+    uint32_t texels[8];
+    pal8_gather_lerp8(
+        texels, texel_indices, palette, u_scan, v_scan, step_u, step_v, texture_shift);
+
+    vst1q_u32(&pixel_buffer[offset], pal8_shade_blend4_neon(vld1q_u32(&texels[0]), shade));
+    vst1q_u32(&pixel_buffer[offset + 4], pal8_shade_blend4_neon(vld1q_u32(&texels[4]), shade));
+}
+
+#endif /* TEX_PAL8_SPAN_NEON_U_C */
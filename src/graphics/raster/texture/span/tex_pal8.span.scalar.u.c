@@ -0,0 +1,68 @@
+#ifndef TEX_PAL8_SPAN_SCALAR_U_C
+#define TEX_PAL8_SPAN_SCALAR_U_C
+
+#include "graphics/dash_restrict.h"
+#include "graphics/shade.h"
+
+#include <assert.h>
+#include <stdint.h>
+
+static inline void
+raster_linear_transparent_texshadeflat_lerp8_pal8(
+    uint32_t* RESTRICT pixel_buffer,
+    int offset,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift,
+    int shade)
+{
+    assert(texture_shift == 7 || texture_shift == 6);
+    int mask = texture_shift == 7 ? 0x3f80 : 0x0fc0;
+    for( int i = 0; i < 8; i++ )
+    {
+        int u = u_scan >> texture_shift;
+        int v = v_scan & mask;
+        uint32_t texel = palette[texel_indices[u + v]];
+        if( texel != 0 )
+            pixel_buffer[offset] = shade_blend(texel, shade);
+
+        u_scan += step_u;
+        v_scan += step_v;
+
+        offset += 1;
+    }
+}
+
+static inline void
+raster_linear_opaque_texshadeflat_lerp8_pal8(
+    uint32_t* RESTRICT pixel_buffer,
+    int offset,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift,
+    int shade)
+{
+    assert(texture_shift == 7 || texture_shift == 6);
+    int mask = texture_shift == 7 ? 0x3f80 : 0x0fc0;
+    for( int i = 0; i < 8; i++ )
+    {
+        int u = u_scan >> texture_shift;
+        int v = v_scan & mask;
+        pixel_buffer[offset] = shade_blend(palette[texel_indices[u + v]], shade);
+
+        u_scan += step_u;
+        v_scan += step_v;
+
+        offset += 1;
+    }
+}
+
+#endif /* TEX_PAL8_SPAN_SCALAR_U_C */
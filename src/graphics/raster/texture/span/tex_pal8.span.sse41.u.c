@@ -0,0 +1,112 @@
+#ifndef TEX_PAL8_SPAN_SSE41_U_C
+#define TEX_PAL8_SPAN_SSE41_U_C
+
+#include "graphics/dash_restrict.h"
+#include "graphics/shade.h"
+
+#include <assert.h>
+#include <smmintrin.h>
+#include <stdint.h>
+
+/* SSE4.1 lerp8 spans for palettized textures. Names prefixed so this TU can coexist
+ * with tex.span.*. */
+
+static inline __m128i
+pal8_shade_blend4_sse(
+    __m128i texel,
+    int shade)
+{
+    __m128i texel_lo = _mm_unpacklo_epi8(texel, _mm_setzero_si128());
+    __m128i texel_hi = _mm_unpackhi_epi8(texel, _mm_setzero_si128());
+    __m128i shade_16 = _mm_set1_epi16(shade);
+    texel_lo = _mm_mullo_epi16(texel_lo, shade_16);
+    texel_hi = _mm_mullo_epi16(texel_hi, shade_16);
+    texel_lo = _mm_srli_epi16(texel_lo, 8);
+    texel_hi = _mm_srli_epi16(texel_hi, 8);
+    return _mm_packus_epi16(texel_lo, texel_hi);
+}
+
+/* Resolves 8 texels through the palette. The indices are 1 byte each, so the 8 lookups touch a
+ * quarter of the cache lines the int32 layout would. */
+static inline void
+pal8_gather_lerp8(
+    int* RESTRICT out,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift)
+{
+    assert(texture_shift == 7 || texture_shift == 6);
+    int mask = texture_shift == 7 ? 0x3f80 : 0x0fc0;
+    for( int i = 0; i < 8; i++ )
+    {
+        int u = u_scan >> texture_shift;
+        int v = v_scan & mask;
+        out[i] = (int)palette[texel_indices[u + v]];
+        u_scan += step_u;
+        v_scan += step_v;
+    }
+}
+
+static inline void
+raster_linear_transparent_texshadeflat_lerp8_pal8(
+    uint32_t* RESTRICT pixel_buffer,
+    int offset,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift,
+    int shade)
+{
+    int texels[8];
+    pal8_gather_lerp8(
+        texels, texel_indices, palette, u_scan, v_scan, step_u, step_v, texture_shift);
+
+    __m128i t0 = _mm_loadu_si128((const __m128i*)&texels[0]);
+    __m128i t1 = _mm_loadu_si128((const __m128i*)&texels[4]);
+    __m128i r0 = pal8_shade_blend4_sse(t0, shade);
+    __m128i r1 = pal8_shade_blend4_sse(t1, shade);
+
+    // Keep the existing pixel where the texel is 0 (transparent).
+    __m128i zero = _mm_setzero_si128();
+    __m128i existing0 = _mm_loadu_si128((__m128i*)&pixel_buffer[offset]);
+    __m128i existing1 = _mm_loadu_si128((__m128i*)&pixel_buffer[offset + 4]);
+    __m128i mask0 = _mm_cmpeq_epi32(t0, zero);
+    __m128i mask1 = _mm_cmpeq_epi32(t1, zero);
+    r0 = _mm_blendv_epi8(r0, existing0, mask0);
+    r1 = _mm_blendv_epi8(r1, existing1, mask1);
+
+    _mm_storeu_si128((__m128i*)&pixel_buffer[offset], r0);
+    _mm_storeu_si128((__m128i*)&pixel_buffer[offset + 4], r1);
+}
+
+static inline void
+raster_linear_opaque_texshadeflat_lerp8_pal8(
+    uint32_t* RESTRICT pixel_buffer,
+    int offset,
+    const uint8_t* RESTRICT texel_indices,
+    const uint32_t* RESTRICT palette,
+    int u_scan,
+    int v_scan,
+    int step_u,
+    int step_v,
+    int texture_shift,
+    int shade)
+{
+    int texels[8];
+    pal8_gather_lerp8(
+        texels, texel_indices, palette, u_scan, v_scan, step_u, step_v, texture_shift);
+
+    __m128i t0 = _mm_loadu_si128((const __m128i*)&texels[0]);
+    __m128i t1 = _mm_loadu_si128((const __m128i*)&texels[4]);
+    _mm_storeu_si128((__m128i*)&pixel_buffer[offset], pal8_shade_blend4_sse(t0, shade));
+    _mm_storeu_si128((__m128i*)&pixel_buffer[offset + 4], pal8_shade_blend4_sse(t1, shade));
+}
+
+#endif /* TEX_PAL8_SPAN_SSE41_U_C */
@@ -0,0 +1,27 @@
+#ifndef TEX_PAL8_SPAN_U_C
+#define TEX_PAL8_SPAN_U_C
+
+#include "graphics/clamp.h"
+#include "graphics/dash_restrict.h"
+
+#include <stdint.h>
+
+// clang-format off
+#include "graphics/shade.h"
+// clang-format on
+
+/* lerp8 spans over palettized textures: 8-bit texel indices (DashTexture.palette_indices) looked
+ * up through a 256-entry palette. Same results as the texshadeflat lerp8 spans in tex.span.*. */
+#if ( defined(__ARM_NEON) || defined(__ARM_NEON__) ) && !defined(NEON_DISABLED)
+#include "tex_pal8.span.neon.u.c"
+#elif defined(__AVX2__) && !defined(AVX2_DISABLED)
+#include "tex_pal8.span.avx.u.c"
+#elif defined(__SSE4_1__) && !defined(SSE2_DISABLED)
+#include "tex_pal8.span.sse41.u.c"
+#elif defined(__SSE2__) && !defined(SSE2_DISABLED)
+#include "tex_pal8.span.sse2.u.c"
+#else
+#include "tex_pal8.span.scalar.u.c"
+#endif
+
+#endif /* TEX_PAL8_SPAN_U_C */
@@ -2,6 +2,7 @@
 #define TEXSHADEBLEND_AFFINE_TEXTRANS_BRANCHING_LERP8_V3_U_C
 
 #include "graphics/dash_restrict.h"
+#include "graphics/dash_thread_local.h"
 #include "span/tex.span_peer_decl.h"
 
 static inline void
@@ -116,7 +117,7 @@ raster_texshadeblend_affine_textrans_branching_lerp8_v3_ordered(
     bv = project_scale_unit(vUOPlane_normal_zhat, camera_fov);
     cw = project_scale_unit(vUVPlane_normal_zhat, camera_fov);
 
-    int dy = y0 - (screen_height >> 1);
+    int dy = y0 - (screen_height >> 1) + g_raster_origin_dy;
     au += vOVPlane_normal_yhat * (dy);
     bv += vUOPlane_normal_yhat * (dy);
     cw += vUVPlane_normal_yhat * (dy);
@@ -2,6 +2,7 @@
 #define TEXSHADEFLAT_PERSP_TEXOPAQUE_BRANCHING_LERP8_U_C
 
 #include "graphics/dash_restrict.h"
+#include "graphics/dash_thread_local.h"
 
 #include <stdint.h>
 
@@ -116,7 +117,7 @@ raster_texshadeflat_persp_texopaque_branching_lerp8_ordered(
     bv = project_scale_unit(vUOPlane_normal_zhat, camera_fov);
     cw = project_scale_unit(vUVPlane_normal_zhat, camera_fov);
 
-    int dy = y0 - (screen_height >> 1);
+    int dy = y0 - (screen_height >> 1) + g_raster_origin_dy;
     au += vOVPlane_normal_yhat * (dy);
     bv += vUOPlane_normal_yhat * (dy);
     cw += vUVPlane_normal_yhat * (dy);
@@ -1,6 +1,7 @@
 #include "buildcachedat.h"
 
 #include "graphics/dash.h"
+#include "platforms/common/platform_thread.h"
 
 #include <stdbool.h>
 
@@ -137,6 +138,17 @@ struct NpcModelEntry
     struct CacheModel* model;
 };
 
+struct AppearanceModelKey
+{
+    uint16_t slots[12];
+};
+
+struct AppearanceModelEntry
+{
+    struct AppearanceModelKey key; // Key must be first field and fixed size for DashMap
+    struct CacheModel* model;
+};
+
 struct ComponentEntry
 {
     int id;
@@ -149,6 +161,27 @@ struct ComponentSpriteRefEntry
     int uiscene_element_id;
 };
 
+struct PrefetchKey
+{
+    int kind;
+    /** (mapx << 16) | mapz for the map kinds, as for decode jobs; the model id for models. */
+    int id;
+};
+
+struct PrefetchEntry
+{
+    struct PrefetchKey key; // Key must be first field and fixed size for DashMap
+    void* data;
+    int64_t bytes;
+    uint32_t last_use;
+};
+
+struct PrefetchOrder
+{
+    struct PrefetchKey key;
+    uint32_t last_use;
+};
+
 static struct DashMap*
 buildcachedat_create_hmap(
     size_t key_size,
@@ -303,6 +336,8 @@ buildcachedat_init_owning_maps(struct BuildCacheDat* buildcachedat)
     buildcachedat->npc_hmap = buildcachedat_create_hmap(sizeof(int), sizeof(struct NpcEntry), cap);
     buildcachedat->npc_models_hmap =
         buildcachedat_create_hmap(sizeof(int), sizeof(struct NpcModelEntry), cap);
+    buildcachedat->appearance_models_hmap = buildcachedat_create_hmap(
+        sizeof(struct AppearanceModelKey), sizeof(struct AppearanceModelEntry), cap);
     if( !buildcachedat->component_hmap )
         buildcachedat->component_hmap =
             buildcachedat_create_hmap(sizeof(int), sizeof(struct ComponentEntry), cap);
@@ -323,12 +358,26 @@ buildcachedat_init_maps_and_eventbuffer(struct BuildCacheDat* buildcachedat)
     buildcachedat->eventbuffer_count = 0;
 }
 
+static void
+buildcachedat_obj_changed(
+    struct BuildCacheDat* buildcachedat,
+    int obj_id)
+{
+    if( buildcachedat->obj_changed_fn_nullable )
+        buildcachedat->obj_changed_fn_nullable(buildcachedat->obj_changed_arg_nullable, obj_id);
+}
+
 struct BuildCacheDat*
 buildcachedat_new(void)
 {
     struct BuildCacheDat* buildcachedat = malloc(sizeof(struct BuildCacheDat));
     memset(buildcachedat, 0, sizeof(struct BuildCacheDat));
     buildcachedat_init_maps_and_eventbuffer(buildcachedat);
+    buildcachedat->prefetch_hmap = buildcachedat_create_hmap(
+        sizeof(struct PrefetchKey),
+        sizeof(struct PrefetchEntry),
+        BUILDCACHEDAT_HMAP_INITIAL_CAPACITY);
+    buildcachedat->prefetch_budget_bytes = BUILDCACHEDAT_PREFETCH_BUDGET_DEFAULT;
     return buildcachedat;
 }
 
@@ -417,6 +466,11 @@ free_npc_model_entry(void* e)
     model_free(((struct NpcModelEntry*)e)->model);
 }
 static void
+free_appearance_model_entry(void* e)
+{
+    model_free(((struct AppearanceModelEntry*)e)->model);
+}
+static void
 free_component_entry(void* e)
 {
     cache_dat_config_component_free(((struct ComponentEntry*)e)->component);
@@ -440,6 +494,273 @@ free_container_entry(void* e)
     }
 }
 
+static void
+prefetch_data_free(
+    int kind,
+    void* data)
+{
+    switch( kind )
+    {
+    case BUILDCACHEDAT_PREFETCH_MAP_TERRAIN:
+        map_terrain_free((struct CacheMapTerrain*)data);
+        break;
+    case BUILDCACHEDAT_PREFETCH_MAP_SCENERY:
+        map_locs_free((struct CacheMapLocs*)data);
+        break;
+    case BUILDCACHEDAT_PREFETCH_MODEL:
+        model_free((struct CacheModel*)data);
+        break;
+    }
+}
+
+static void
+free_prefetch_entry(void* e)
+{
+    struct PrefetchEntry* entry = (struct PrefetchEntry*)e;
+    prefetch_data_free(entry->key.kind, entry->data);
+}
+
+/** Approximate heap footprint; only used to weigh entries against the budget. */
+static int64_t
+prefetch_data_bytes(
+    int kind,
+    void* data)
+{
+    switch( kind )
+    {
+    case BUILDCACHEDAT_PREFETCH_MAP_TERRAIN:
+        return (int64_t)sizeof(struct CacheMapTerrain);
+    case BUILDCACHEDAT_PREFETCH_MAP_SCENERY:
+    {
+        struct CacheMapLocs* locs = (struct CacheMapLocs*)data;
+        return (int64_t)sizeof(struct CacheMapLocs) +
+               (int64_t)locs->locs_count * (int64_t)sizeof(struct CacheMapLoc);
+    }
+    case BUILDCACHEDAT_PREFETCH_MODEL:
+    {
+        struct CacheModel* model = (struct CacheModel*)data;
+        return (int64_t)sizeof(struct CacheModel) + (int64_t)model->vertex_count * 14 +
+               (int64_t)model->face_count * 24 + (int64_t)model->textured_face_count * 6;
+    }
+    }
+    return 0;
+}
+
+/** The order item still describes the stored entry: it was neither taken nor used again. */
+static struct PrefetchEntry*
+prefetch_order_entry(
+    struct BuildCacheDat* buildcachedat,
+    const struct PrefetchOrder* item)
+{
+    struct PrefetchEntry* entry = (struct PrefetchEntry*)dashmap_search(
+        buildcachedat->prefetch_hmap, &item->key, DASHMAP_FIND);
+    return entry && entry->last_use == item->last_use ? entry : NULL;
+}
+
+/** Appends (key, last_use) to the use-order ring. When the ring is full the live items are copied
+ *  oldest first into a new ring without the stale ones, which is twice as large if at least half
+ *  of them are live. */
+static bool
+prefetch_order_push(
+    struct BuildCacheDat* buildcachedat,
+    struct PrefetchKey key,
+    uint32_t last_use)
+{
+    if( buildcachedat->prefetch_order_count == buildcachedat->prefetch_order_capacity )
+    {
+        int capacity = buildcachedat->prefetch_order_capacity;
+        int head = buildcachedat->prefetch_order_head;
+        int live = 0;
+        for( int i = 0; i < buildcachedat->prefetch_order_count; i++ )
+        {
+            if( prefetch_order_entry(
+                    buildcachedat, &buildcachedat->prefetch_order[(head + i) % capacity]) )
+                live++;
+        }
+
+        int new_capacity = capacity;
+        if( live * 2 >= capacity )
+            new_capacity = capacity ? capacity * 2 : 256;
+        struct PrefetchOrder* order =
+            (struct PrefetchOrder*)malloc((size_t)new_capacity * sizeof(struct PrefetchOrder));
+        if( !order )
+            return false;
+
+        live = 0;
+        for( int i = 0; i < buildcachedat->prefetch_order_count; i++ )
+        {
+            struct PrefetchOrder* item = &buildcachedat->prefetch_order[(head + i) % capacity];
+            if( prefetch_order_entry(buildcachedat, item) )
+                order[live++] = *item;
+        }
+
+        free(buildcachedat->prefetch_order);
+        buildcachedat->prefetch_order = order;
+        buildcachedat->prefetch_order_capacity = new_capacity;
+        buildcachedat->prefetch_order_head = 0;
+        buildcachedat->prefetch_order_count = live;
+    }
+
+    int tail = (buildcachedat->prefetch_order_head + buildcachedat->prefetch_order_count) %
+               buildcachedat->prefetch_order_capacity;
+    buildcachedat->prefetch_order[tail].key = key;
+    buildcachedat->prefetch_order[tail].last_use = last_use;
+    buildcachedat->prefetch_order_count++;
+    return true;
+}
+
+static void
+prefetch_evict_to(
+    struct BuildCacheDat* buildcachedat,
+    int64_t budget_bytes)
+{
+    while( buildcachedat->prefetch_bytes > budget_bytes )
+    {
+        if( buildcachedat->prefetch_order_count == 0 )
+        {
+            buildcachedat->prefetch_bytes = 0;
+            return;
+        }
+
+        struct PrefetchOrder item =
+            buildcachedat->prefetch_order[buildcachedat->prefetch_order_head];
+        buildcachedat->prefetch_order_head =
+            (buildcachedat->prefetch_order_head + 1) % buildcachedat->prefetch_order_capacity;
+        buildcachedat->prefetch_order_count--;
+        if( !prefetch_order_entry(buildcachedat, &item) )
+            continue;
+
+        struct PrefetchEntry* entry = (struct PrefetchEntry*)dashmap_search(
+            buildcachedat->prefetch_hmap, &item.key, DASHMAP_REMOVE);
+        buildcachedat->prefetch_bytes -= entry->bytes;
+        buildcachedat->prefetch_evictions++;
+        prefetch_data_free(entry->key.kind, entry->data);
+    }
+}
+
+static void
+prefetch_store(
+    struct BuildCacheDat* buildcachedat,
+    int kind,
+    int id,
+    void* data)
+{
+    struct PrefetchKey key = { .kind = kind, .id = id };
+    int64_t bytes = prefetch_data_bytes(kind, data);
+    if( bytes > buildcachedat->prefetch_budget_bytes )
+    {
+        prefetch_data_free(kind, data);
+        return;
+    }
+
+    struct PrefetchEntry* entry =
+        (struct PrefetchEntry*)dashmap_search(buildcachedat->prefetch_hmap, &key, DASHMAP_FIND);
+    if( entry )
+    {
+        prefetch_data_free(kind, data);
+        /* Without a new ring item the old one stays valid, so keep the old stamp. */
+        if( prefetch_order_push(buildcachedat, key, buildcachedat->prefetch_clock + 1) )
+            entry->last_use = ++buildcachedat->prefetch_clock;
+        return;
+    }
+
+    prefetch_evict_to(buildcachedat, buildcachedat->prefetch_budget_bytes - bytes);
+    if( !prefetch_order_push(buildcachedat, key, buildcachedat->prefetch_clock + 1) )
+    {
+        /* An entry the ring cannot reach would never be evicted. */
+        prefetch_data_free(kind, data);
+        return;
+    }
+
+    entry =
+        (struct PrefetchEntry*)dashmap_search(buildcachedat->prefetch_hmap, &key, DASHMAP_INSERT);
+    assert(entry && "Prefetch entry must be inserted into hmap");
+    entry->key = key;
+    entry->data = data;
+    entry->bytes = bytes;
+    entry->last_use = ++buildcachedat->prefetch_clock;
+    buildcachedat->prefetch_bytes += bytes;
+    buildcachedat_maybe_grow_hmap(buildcachedat->prefetch_hmap);
+}
+
+static void*
+prefetch_take(
+    struct BuildCacheDat* buildcachedat,
+    int kind,
+    int id)
+{
+    struct PrefetchKey key = { .kind = kind, .id = id };
+    if( !buildcachedat->prefetch_hmap || dashmap_count(buildcachedat->prefetch_hmap) == 0 )
+        return NULL;
+
+    struct PrefetchEntry* entry =
+        (struct PrefetchEntry*)dashmap_search(buildcachedat->prefetch_hmap, &key, DASHMAP_REMOVE);
+    if( !entry )
+        return NULL;
+    buildcachedat->prefetch_bytes -= entry->bytes;
+    buildcachedat->prefetch_hits++;
+    return entry->data;
+}
+
+static void*
+prefetch_peek(
+    struct BuildCacheDat* buildcachedat,
+    int kind,
+    int id)
+{
+    struct PrefetchKey key = { .kind = kind, .id = id };
+    struct PrefetchEntry* entry =
+        (struct PrefetchEntry*)dashmap_search(buildcachedat->prefetch_hmap, &key, DASHMAP_FIND);
+    return entry ? entry->data : NULL;
+}
+
+/** Move the live terrain, scenery and models into the prefetch store, nulling the live entries
+ *  so the following clear does not free them. */
+static void
+prefetch_retire_live(struct BuildCacheDat* buildcachedat)
+{
+    struct DashMapIter* iter;
+
+    iter = dashmap_iter_new(buildcachedat->map_terrains_hmap);
+    struct MapTerrainEntry* terrain_entry;
+    while( (terrain_entry = (struct MapTerrainEntry*)dashmap_iter_next(iter)) )
+    {
+        if( terrain_entry->map_terrain )
+            prefetch_store(
+                buildcachedat,
+                BUILDCACHEDAT_PREFETCH_MAP_TERRAIN,
+                (terrain_entry->mapx << 16) | terrain_entry->mapz,
+                terrain_entry->map_terrain);
+        terrain_entry->map_terrain = NULL;
+    }
+    dashmap_iter_free(iter);
+
+    iter = dashmap_iter_new(buildcachedat->scenery_hmap);
+    struct SceneryEntry* scenery_entry;
+    while( (scenery_entry = (struct SceneryEntry*)dashmap_iter_next(iter)) )
+    {
+        if( scenery_entry->locs )
+            prefetch_store(
+                buildcachedat,
+                BUILDCACHEDAT_PREFETCH_MAP_SCENERY,
+                (scenery_entry->mapx << 16) | scenery_entry->mapz,
+                scenery_entry->locs);
+        scenery_entry->locs = NULL;
+    }
+    dashmap_iter_free(iter);
+
+    iter = dashmap_iter_new(buildcachedat->models_hmap);
+    struct ModelEntry* model_entry;
+    while( (model_entry = (struct ModelEntry*)dashmap_iter_next(iter)) )
+    {
+        if( model_entry->model )
+            prefetch_store(
+                buildcachedat, BUILDCACHEDAT_PREFETCH_MODEL, model_entry->id, model_entry->model);
+        model_entry->model = NULL;
+    }
+    dashmap_iter_free(iter);
+}
+
 void
 buildcachedat_free(struct BuildCacheDat* buildcachedat)
 {
@@ -466,15 +787,20 @@ buildcachedat_free(struct BuildCacheDat* buildcachedat)
     dashmap_free_entries(buildcachedat->map_terrains_hmap, free_map_terrain_entry);
     dashmap_free_entries(buildcachedat->npc_hmap, free_npc_entry);
     dashmap_free_entries(buildcachedat->npc_models_hmap, free_npc_model_entry);
+    dashmap_free_entries(buildcachedat->appearance_models_hmap, free_appearance_model_entry);
     dashmap_free_entries(buildcachedat->component_hmap, free_component_entry);
     dashmap_free_entries(buildcachedat->component_sprites_reftable, NULL);
     dashmap_free_entries(buildcachedat->containers_hmap, free_container_entry);
+    dashmap_free_entries(buildcachedat->prefetch_hmap, free_prefetch_entry);
+    free(buildcachedat->prefetch_order);
 
     filelist_dat_free(buildcachedat->cfg_config_jagfile);
     filelist_dat_free(buildcachedat->cfg_versionlist_jagfile);
     filelist_dat_free(buildcachedat->cfg_media_jagfile);
 
     free(buildcachedat->eventbuffer);
+    if( buildcachedat->decode_pool )
+        platform_worker_pool_free(buildcachedat->decode_pool);
     free(buildcachedat);
 }
 
@@ -512,6 +838,8 @@ buildcachedat_clear_internal(struct BuildCacheDat* buildcachedat)
     buildcachedat->npc_hmap = NULL;
     dashmap_free_entries(buildcachedat->npc_models_hmap, free_npc_model_entry);
     buildcachedat->npc_models_hmap = NULL;
+    dashmap_free_entries(buildcachedat->appearance_models_hmap, free_appearance_model_entry);
+    buildcachedat->appearance_models_hmap = NULL;
     /* component_hmap: components still needed at runtime; do not free entries or map */
     dashmap_free_entries(buildcachedat->containers_hmap, free_container_entry);
     buildcachedat->containers_hmap = NULL;
@@ -541,7 +869,80 @@ buildcachedat_clear_internal(struct BuildCacheDat* buildcachedat)
 void
 buildcachedat_clear(struct BuildCacheDat* buildcachedat)
 {
+    if( !buildcachedat )
+        return;
+    prefetch_retire_live(buildcachedat);
     buildcachedat_clear_internal(buildcachedat);
+    buildcachedat_obj_changed(buildcachedat, -1);
+}
+
+static bool
+prefetch_is_live(
+    struct BuildCacheDat* buildcachedat,
+    int kind,
+    int id)
+{
+    int mapxz = MAPREGIONXZ((id >> 16) & 0xFFFF, id & 0xFFFF);
+    switch( kind )
+    {
+    case BUILDCACHEDAT_PREFETCH_MAP_TERRAIN:
+        return dashmap_search(buildcachedat->map_terrains_hmap, &mapxz, DASHMAP_FIND) != NULL;
+    case BUILDCACHEDAT_PREFETCH_MAP_SCENERY:
+        return dashmap_search(buildcachedat->scenery_hmap, &mapxz, DASHMAP_FIND) != NULL;
+    case BUILDCACHEDAT_PREFETCH_MODEL:
+        return dashmap_search(buildcachedat->models_hmap, &id, DASHMAP_FIND) != NULL;
+    }
+    return false;
+}
+
+void
+buildcachedat_prefetch_add(
+    struct BuildCacheDat* buildcachedat,
+    enum BuildCacheDatPrefetchKind kind,
+    int id,
+    void* data)
+{
+    if( !data )
+        return;
+    if( prefetch_is_live(buildcachedat, kind, id) )
+    {
+        prefetch_data_free(kind, data);
+        return;
+    }
+    prefetch_store(buildcachedat, kind, id, data);
+}
+
+bool
+buildcachedat_prefetch_has(
+    struct BuildCacheDat* buildcachedat,
+    enum BuildCacheDatPrefetchKind kind,
+    int id)
+{
+    return prefetch_peek(buildcachedat, kind, id) || prefetch_is_live(buildcachedat, kind, id);
+}
+
+struct CacheMapLocs*
+buildcachedat_prefetch_peek_scenery(
+    struct BuildCacheDat* buildcachedat,
+    int mapx,
+    int mapz)
+{
+    int mapxz = MAPREGIONXZ(mapx, mapz);
+    struct SceneryEntry* scenery_entry =
+        (struct SceneryEntry*)dashmap_search(buildcachedat->scenery_hmap, &mapxz, DASHMAP_FIND);
+    if( scenery_entry )
+        return scenery_entry->locs;
+    return (struct CacheMapLocs*)prefetch_peek(
+        buildcachedat, BUILDCACHEDAT_PREFETCH_MAP_SCENERY, (mapx << 16) | mapz);
+}
+
+void
+buildcachedat_prefetch_set_budget(
+    struct BuildCacheDat* buildcachedat,
+    int64_t budget_bytes)
+{
+    buildcachedat->prefetch_budget_bytes = budget_bytes < 0 ? 0 : budget_bytes;
+    prefetch_evict_to(buildcachedat, buildcachedat->prefetch_budget_bytes);
 }
 
 void
@@ -701,6 +1102,7 @@ buildcachedat_objects_clear(struct BuildCacheDat* buildcachedat)
         dashmap_free_entries(buildcachedat->obj_hmap, free_obj_entry);
     buildcachedat->obj_hmap =
         buildcachedat_create_hmap(sizeof(int), sizeof(struct ObjEntry), 64);
+    buildcachedat_obj_changed(buildcachedat, -1);
 }
 
 void
@@ -1127,7 +1529,13 @@ buildcachedat_get_scenery(
     struct SceneryEntry* scenery_entry =
         (struct SceneryEntry*)dashmap_search(buildcachedat->scenery_hmap, &mapxz, DASHMAP_FIND);
     if( !scenery_entry )
-        return NULL;
+    {
+        struct CacheMapLocs* locs = (struct CacheMapLocs*)prefetch_take(
+            buildcachedat, BUILDCACHEDAT_PREFETCH_MAP_SCENERY, (mapx << 16) | mapz);
+        if( locs )
+            buildcachedat_add_scenery(buildcachedat, mapx, mapz, locs);
+        return locs;
+    }
     return scenery_entry->locs;
 }
 
@@ -1168,7 +1576,13 @@ buildcachedat_get_model(
     struct ModelEntry* model_entry =
         (struct ModelEntry*)dashmap_search(buildcachedat->models_hmap, &model_id, DASHMAP_FIND);
     if( !model_entry )
-        return NULL;
+    {
+        struct CacheModel* model = (struct CacheModel*)prefetch_take(
+            buildcachedat, BUILDCACHEDAT_PREFETCH_MODEL, model_id);
+        if( model )
+            buildcachedat_add_model(buildcachedat, model_id, model);
+        return model;
+    }
     return model_entry->model;
 }
 
@@ -1224,6 +1638,50 @@ buildcachedat_get_obj_model(
     return obj_entry->model;
 }
 
+void
+buildcachedat_add_appearance_model(
+    struct BuildCacheDat* buildcachedat,
+    const uint16_t* appearance,
+    struct CacheModel* model)
+{
+    if( dashmap_count(buildcachedat->appearance_models_hmap) >=
+        BUILDCACHEDAT_APPEARANCE_MODELS_MAX )
+    {
+        dashmap_free_entries(buildcachedat->appearance_models_hmap, free_appearance_model_entry);
+        buildcachedat->appearance_models_hmap = buildcachedat_create_hmap(
+            sizeof(struct AppearanceModelKey),
+            sizeof(struct AppearanceModelEntry),
+            BUILDCACHEDAT_HMAP_INITIAL_CAPACITY);
+    }
+
+    struct AppearanceModelKey key;
+    memcpy(key.slots, appearance, sizeof(key.slots));
+    struct AppearanceModelEntry* existing = (struct AppearanceModelEntry*)dashmap_search(
+        buildcachedat->appearance_models_hmap, &key, DASHMAP_FIND);
+    if( existing && existing->model != model )
+        model_free(existing->model);
+
+    struct AppearanceModelEntry* entry = (struct AppearanceModelEntry*)dashmap_search(
+        buildcachedat->appearance_models_hmap, &key, DASHMAP_INSERT);
+    assert(entry && "Appearance model must be inserted into hmap");
+    entry->model = model;
+    buildcachedat_maybe_grow_hmap(buildcachedat->appearance_models_hmap);
+}
+
+struct CacheModel*
+buildcachedat_get_appearance_model(
+    struct BuildCacheDat* buildcachedat,
+    const uint16_t* appearance)
+{
+    struct AppearanceModelKey key;
+    memcpy(key.slots, appearance, sizeof(key.slots));
+    struct AppearanceModelEntry* entry = (struct AppearanceModelEntry*)dashmap_search(
+        buildcachedat->appearance_models_hmap, &key, DASHMAP_FIND);
+    if( !entry )
+        return NULL;
+    return entry->model;
+}
+
 void
 buildcachedat_add_npc(
     struct BuildCacheDat* buildcachedat,
@@ -1468,7 +1926,10 @@ buildcachedat_add_obj(
     struct ObjEntry* existing =
         (struct ObjEntry*)dashmap_search(buildcachedat->obj_hmap, &obj_id, DASHMAP_FIND);
     if( existing && existing->obj )
+    {
         cache_dat_config_obj_free(existing->obj);
+        buildcachedat_obj_changed(buildcachedat, obj_id);
+    }
 
     struct ObjEntry* obj_entry =
         (struct ObjEntry*)dashmap_search(buildcachedat->obj_hmap, &obj_id, DASHMAP_INSERT);
@@ -1533,7 +1994,13 @@ buildcachedat_get_map_terrain(
     struct MapTerrainEntry* map_terrain_entry = (struct MapTerrainEntry*)dashmap_search(
         buildcachedat->map_terrains_hmap, &mapxz, DASHMAP_FIND);
     if( !map_terrain_entry )
-        return NULL;
+    {
+        struct CacheMapTerrain* map_terrain = (struct CacheMapTerrain*)prefetch_take(
+            buildcachedat, BUILDCACHEDAT_PREFETCH_MAP_TERRAIN, (mapx << 16) | mapz);
+        if( map_terrain )
+            buildcachedat_add_map_terrain(buildcachedat, mapx, mapz, map_terrain);
+        return map_terrain;
+    }
     return map_terrain_entry->map_terrain;
 }
 
@@ -25,6 +25,8 @@
 #include "osrs/rscache/tables_dat/pix8.h"
 #include "osrs/rscache/tables_dat/pixfont.h"
 
+struct PlatformWorkerPool;
+
 enum BuildCacheDatEventType
 {
     BUILDCACHEDAT_EVENT_NONE = 0,
@@ -37,6 +39,19 @@ struct BuildCacheDatEvent
     int texture_id;
 };
 
+/** Matches BuildCacheDatLoaderDecodeKind so decode jobs can be merged straight into the store. */
+enum BuildCacheDatPrefetchKind
+{
+    BUILDCACHEDAT_PREFETCH_MAP_TERRAIN = 1,
+    BUILDCACHEDAT_PREFETCH_MAP_SCENERY = 2,
+    BUILDCACHEDAT_PREFETCH_MODEL = 3,
+};
+
+#define BUILDCACHEDAT_PREFETCH_BUDGET_DEFAULT (32 * 1024 * 1024)
+
+/** Distinct merged player appearances kept warm; the cache is flushed when it fills up. */
+#define BUILDCACHEDAT_APPEARANCE_MODELS_MAX 512
+
 struct BuildCacheDat
 {
     struct FileListDat* cfg_config_jagfile;
@@ -61,6 +76,8 @@ struct BuildCacheDat
     struct DashMap* idk_models_hmap;
     struct DashMap* obj_models_hmap;
     struct DashMap* npc_models_hmap;
+    /** Merged IDK/OBJ body model per 12-slot player appearance (uint16_t[12] key). */
+    struct DashMap* appearance_models_hmap;
 
     struct DashMap* config_loc_hmap;
     /** Reftable: animframe id -> animbaseframes blob + frame index (no CacheAnimframe* stored). */
@@ -79,6 +96,32 @@ struct BuildCacheDat
     int eventbuffer_head;
     int eventbuffer_tail;
     int eventbuffer_count;
+
+    /** Created on first buildcachedat_loader_decode_archives; survives buildcachedat_clear. */
+    struct PlatformWorkerPool* decode_pool;
+
+    /** Called with the obj id when buildcachedat_add_obj replaces an obj config, and with -1
+     *  when every obj config is dropped (buildcachedat_objects_clear, buildcachedat_clear), so
+     *  caches of what was rendered from them can drop it. */
+    void (*obj_changed_fn_nullable)(void* arg, int obj_id);
+    void* obj_changed_arg_nullable;
+
+    /** Prefetch store: decoded map terrain, map scenery and models that are not (yet) in the
+     *  live hmaps. Filled by buildcachedat_prefetch_add and by buildcachedat_clear, which retires
+     *  the live entries here instead of freeing them. The get functions promote entries back.
+     *  Survives buildcachedat_clear; evicted least recently used past prefetch_budget_bytes. */
+    struct DashMap* prefetch_hmap;
+    /** Ring of (key, last_use) in use order, oldest at prefetch_order_head. Stale items (taken
+     *  or re-used since) are skipped when they reach the head. */
+    struct PrefetchOrder* prefetch_order;
+    int prefetch_order_capacity;
+    int prefetch_order_head;
+    int prefetch_order_count;
+    int64_t prefetch_bytes;
+    int64_t prefetch_budget_bytes;
+    uint32_t prefetch_clock;
+    int prefetch_hits;
+    int prefetch_evictions;
 };
 
 struct BuildCacheDat*
@@ -324,6 +367,36 @@ buildcachedat_eventbuffer_pop(
 void
 buildcachedat_eventbuffer_clear(struct BuildCacheDat* buildcachedat);
 
+/** Take ownership of a decoded map terrain, map scenery or model and keep it in the prefetch
+ *  store. Ignored (and freed) if the item is already live or stored. */
+void
+buildcachedat_prefetch_add(
+    struct BuildCacheDat* buildcachedat,
+    enum BuildCacheDatPrefetchKind kind,
+    int id,
+    void* data);
+
+/** True if the item is live or in the prefetch store. Does not promote. For the map kinds the
+ *  id is (mapx << 16) | mapz, as for decode jobs. */
+bool
+buildcachedat_prefetch_has(
+    struct BuildCacheDat* buildcachedat,
+    enum BuildCacheDatPrefetchKind kind,
+    int id);
+
+/** Scenery for a map square, live or prefetched, without promoting it. */
+struct CacheMapLocs*
+buildcachedat_prefetch_peek_scenery(
+    struct BuildCacheDat* buildcachedat,
+    int mapx,
+    int mapz);
+
+/** Evicts down to the new budget immediately. */
+void
+buildcachedat_prefetch_set_budget(
+    struct BuildCacheDat* buildcachedat,
+    int64_t budget_bytes);
+
 void
 buildcachedat_add_scenery(
     struct BuildCacheDat* buildcachedat,
@@ -376,6 +449,18 @@ buildcachedat_get_obj_model(
     struct BuildCacheDat* buildcachedat,
     int obj_id);
 
+/** Takes ownership of `model`; `appearance` is the 12-slot array from the appearance block. */
+void
+buildcachedat_add_appearance_model(
+    struct BuildCacheDat* buildcachedat,
+    const uint16_t* appearance,
+    struct CacheModel* model);
+
+struct CacheModel*
+buildcachedat_get_appearance_model(
+    struct BuildCacheDat* buildcachedat,
+    const uint16_t* appearance);
+
 void
 buildcachedat_add_npc(
     struct BuildCacheDat* buildcachedat,
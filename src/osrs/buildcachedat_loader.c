@@ -2,11 +2,14 @@
 
 #include "datastruct/vec.h"
 #include "graphics/dash.h"
+#include "graphics/dashmap.h"
 #include "osrs/dash_utils.h"
 #include "osrs/minimap.h"
 #include "osrs/painters.h"
 #include "osrs/revconfig/uiscene.h"
 #include "osrs/rscache/archive.h"
+#include "osrs/rscache/archive_decompress.h"
+#include "osrs/rscache/cache_dat.h"
 #include "osrs/rscache/filelist.h"
 #include "osrs/rscache/rsbuf.h"
 #include "osrs/rscache/tables/config_floortype.h"
@@ -27,6 +30,7 @@
 #include "osrs/texture.h"
 #include "osrs/varp_varbit_manager.h"
 #include "osrs/world.h"
+#include "platforms/common/platform_thread.h"
 
 #include <assert.h>
 
@@ -273,11 +277,10 @@ buildcachedat_loader_init_scenery_configs_from_config_jagfile(struct BuildCacheD
     filelist_dat_indexed_free(filelist_indexed);
 }
 
-void
-buildcachedat_loader_scenery_config_load_mapchunk_from_config_jagfile(
+static void
+scenery_config_load_locs(
     struct BuildCacheDat* buildcachedat,
-    int mapx,
-    int mapz)
+    struct CacheMapLocs* locs)
 {
     struct FileListDat* config_jagfile = buildcachedat_config_jagfile(buildcachedat);
     assert(config_jagfile != NULL && "Config jagfile must be loaded");
@@ -294,13 +297,6 @@ buildcachedat_loader_scenery_config_load_mapchunk_from_config_jagfile(
         config_jagfile->files[data_file_idx],
         config_jagfile->file_sizes[data_file_idx]);
 
-    struct CacheMapLocs* locs = buildcachedat_get_scenery(buildcachedat, mapx, mapz);
-    if( !locs )
-    {
-        filelist_dat_indexed_free(filelist_indexed);
-        return;
-    }
-
     for( int i = 0; i < locs->locs_count; i++ )
     {
         struct CacheMapLoc* loc = &locs->locs[i];
@@ -329,16 +325,25 @@ buildcachedat_loader_scenery_config_load_mapchunk_from_config_jagfile(
     filelist_dat_indexed_free(filelist_indexed);
 }
 
-int
-buildcachedat_loader_scenery_config_get_model_ids_mapchunk(
+void
+buildcachedat_loader_scenery_config_load_mapchunk_from_config_jagfile(
     struct BuildCacheDat* buildcachedat,
     int mapx,
-    int mapz,
+    int mapz)
+{
+    struct CacheMapLocs* locs = buildcachedat_get_scenery(buildcachedat, mapx, mapz);
+    if( !locs )
+        return;
+    scenery_config_load_locs(buildcachedat, locs);
+}
+
+static int
+scenery_config_get_model_ids_locs(
+    struct BuildCacheDat* buildcachedat,
+    struct CacheMapLocs* locs,
     int** model_ids_out)
 {
     *model_ids_out = NULL;
-    struct CacheMapLocs* locs = buildcachedat_get_scenery(buildcachedat, mapx, mapz);
-    assert(locs != NULL && "Scenery chunk must be loaded");
 
     struct Vec* model_ids = vec_new(sizeof(int), 32);
     for( int i = 0; i < locs->locs_count; i++ )
@@ -377,6 +382,33 @@ buildcachedat_loader_scenery_config_get_model_ids_mapchunk(
     return count;
 }
 
+int
+buildcachedat_loader_scenery_config_get_model_ids_mapchunk(
+    struct BuildCacheDat* buildcachedat,
+    int mapx,
+    int mapz,
+    int** model_ids_out)
+{
+    struct CacheMapLocs* locs = buildcachedat_get_scenery(buildcachedat, mapx, mapz);
+    assert(locs != NULL && "Scenery chunk must be loaded");
+    return scenery_config_get_model_ids_locs(buildcachedat, locs, model_ids_out);
+}
+
+int
+buildcachedat_loader_prefetch_scenery_model_ids(
+    struct BuildCacheDat* buildcachedat,
+    int mapx,
+    int mapz,
+    int** model_ids_out)
+{
+    *model_ids_out = NULL;
+    struct CacheMapLocs* locs = buildcachedat_prefetch_peek_scenery(buildcachedat, mapx, mapz);
+    if( !locs || !buildcachedat_config_jagfile(buildcachedat) )
+        return 0;
+    scenery_config_load_locs(buildcachedat, locs);
+    return scenery_config_get_model_ids_locs(buildcachedat, locs, model_ids_out);
+}
+
 int
 buildcachedat_loader_scenery_config_get_animbaseframes_ids_mapchunk(
     struct BuildCacheDat* buildcachedat,
@@ -615,6 +647,185 @@ buildcachedat_loader_model_cache_add(
     buildcachedat_add_model(buildcachedat, model_id, model);
 }
 
+struct DecodeArchivesOrder
+{
+    int data_size;
+    int job;
+};
+
+struct DecodeArchivesCtx
+{
+    struct BuildCacheDatLoaderDecodeJob* jobs;
+    /* Largest archive first, so the pool's dynamic hand-out balances. NULL runs jobs in request
+     * order. */
+    struct DecodeArchivesOrder* order;
+    uint8_t* scratch;
+};
+
+static void
+decode_archive_job(
+    void* userdata,
+    int job,
+    int worker)
+{
+    struct DecodeArchivesCtx* ctx = (struct DecodeArchivesCtx*)userdata;
+    struct BuildCacheDatLoaderDecodeJob* decode_job =
+        &ctx->jobs[ctx->order ? ctx->order[job].job : job];
+    struct CacheDatArchive* archive = decode_job->archive;
+    uint8_t* scratch = ctx->scratch + (size_t)worker * ARCHIVE_DAT_DECOMPRESS_SCRATCH_SIZE;
+
+    decode_job->_decoded = NULL;
+    if( !archive )
+        return;
+
+    if( !cache_dat_archive_decompress(archive, scratch, ARCHIVE_DAT_DECOMPRESS_SCRATCH_SIZE) )
+    {
+        printf("Failed to decompress archive %d\n", archive->archive_id);
+        return;
+    }
+
+    int map_x = (decode_job->id >> 16) & 0xFFFF;
+    int map_z = decode_job->id & 0xFFFF;
+    switch( decode_job->kind )
+    {
+    case BUILDCACHEDAT_LOADER_DECODE_MAP_TERRAIN:
+        decode_job->_decoded = map_terrain_new_from_decode_flags(
+            archive->data, archive->data_size, map_x, map_z, MAP_TERRAIN_DECODE_U8);
+        break;
+    case BUILDCACHEDAT_LOADER_DECODE_MAP_SCENERY:
+        decode_job->_decoded = map_locs_new_from_decode(archive->data, archive->data_size);
+        break;
+    case BUILDCACHEDAT_LOADER_DECODE_MODEL:
+        decode_job->_decoded =
+            model_new_decode((const unsigned char*)archive->data, archive->data_size);
+        break;
+    }
+}
+
+static int
+decode_order_cmp(
+    const void* a,
+    const void* b)
+{
+    const struct DecodeArchivesOrder* x = (const struct DecodeArchivesOrder*)a;
+    const struct DecodeArchivesOrder* y = (const struct DecodeArchivesOrder*)b;
+    if( x->data_size != y->data_size )
+        return x->data_size > y->data_size ? -1 : 1;
+    return x->job - y->job;
+}
+
+static void
+decode_archives_run(
+    struct BuildCacheDat* buildcachedat,
+    struct BuildCacheDatLoaderDecodeJob* jobs,
+    int job_count,
+    bool prefetch)
+{
+    if( job_count <= 0 )
+        return;
+
+    if( !buildcachedat->decode_pool )
+        buildcachedat->decode_pool = platform_worker_pool_new(platform_cpu_count());
+    struct PlatformWorkerPool* pool = buildcachedat->decode_pool;
+    int thread_count = platform_worker_pool_thread_count(pool);
+
+    struct DecodeArchivesCtx ctx = { 0 };
+    ctx.jobs = jobs;
+    ctx.order = malloc((size_t)job_count * sizeof(struct DecodeArchivesOrder));
+    ctx.scratch = malloc((size_t)thread_count * ARCHIVE_DAT_DECOMPRESS_SCRATCH_SIZE);
+    if( !ctx.scratch && thread_count > 1 )
+    {
+        /* Not enough for one scratch per worker: decode serially on this thread. */
+        pool = NULL;
+        ctx.scratch = malloc(ARCHIVE_DAT_DECOMPRESS_SCRATCH_SIZE);
+    }
+    if( ctx.order )
+    {
+        for( int i = 0; i < job_count; i++ )
+        {
+            ctx.order[i].data_size = jobs[i].archive ? jobs[i].archive->data_size : 0;
+            ctx.order[i].job = i;
+        }
+        qsort(ctx.order, (size_t)job_count, sizeof(struct DecodeArchivesOrder), decode_order_cmp);
+    }
+
+    if( ctx.scratch )
+    {
+        platform_worker_pool_run(pool, job_count, decode_archive_job, &ctx);
+    }
+    else
+    {
+        printf("Failed to allocate decompress scratch; dropping %d archives\n", job_count);
+        for( int i = 0; i < job_count; i++ )
+            jobs[i]._decoded = NULL;
+    }
+
+    free(ctx.scratch);
+    free(ctx.order);
+
+    /* Merge serially in request order so hmap insertion order never depends on scheduling. */
+    for( int i = 0; i < job_count; i++ )
+    {
+        struct BuildCacheDatLoaderDecodeJob* job = &jobs[i];
+        int map_x = (job->id >> 16) & 0xFFFF;
+        int map_z = job->id & 0xFFFF;
+
+        if( job->_decoded && job->kind == BUILDCACHEDAT_LOADER_DECODE_MAP_SCENERY )
+        {
+            struct CacheMapLocs* locs = (struct CacheMapLocs*)job->_decoded;
+            locs->_chunk_mapx = map_x;
+            locs->_chunk_mapz = map_z;
+        }
+
+        if( job->_decoded && prefetch )
+        {
+            buildcachedat_prefetch_add(
+                buildcachedat, (enum BuildCacheDatPrefetchKind)job->kind, job->id, job->_decoded);
+        }
+        else if( job->_decoded )
+        {
+            switch( job->kind )
+            {
+            case BUILDCACHEDAT_LOADER_DECODE_MAP_TERRAIN:
+                buildcachedat_add_map_terrain(
+                    buildcachedat, map_x, map_z, (struct CacheMapTerrain*)job->_decoded);
+                break;
+            case BUILDCACHEDAT_LOADER_DECODE_MAP_SCENERY:
+                buildcachedat_add_scenery(
+                    buildcachedat, map_x, map_z, (struct CacheMapLocs*)job->_decoded);
+                break;
+            case BUILDCACHEDAT_LOADER_DECODE_MODEL:
+                buildcachedat_add_model(
+                    buildcachedat, job->id, (struct CacheModel*)job->_decoded);
+                break;
+            }
+        }
+        job->_decoded = NULL;
+
+        if( job->archive )
+            cache_dat_archive_free(job->archive);
+        job->archive = NULL;
+    }
+}
+
+void
+buildcachedat_loader_decode_archives(
+    struct BuildCacheDat* buildcachedat,
+    struct BuildCacheDatLoaderDecodeJob* jobs,
+    int job_count)
+{
+    decode_archives_run(buildcachedat, jobs, job_count, false);
+}
+
+void
+buildcachedat_loader_prefetch_archives(
+    struct BuildCacheDat* buildcachedat,
+    struct BuildCacheDatLoaderDecodeJob* jobs,
+    int job_count)
+{
+    decode_archives_run(buildcachedat, jobs, job_count, true);
+}
+
 void
 buildcachedat_loader_cache_textures(
     struct BuildCacheDat* buildcachedat,
@@ -1035,6 +1246,10 @@ buildcachedat_loader_cache_title(
 void
 buildcachedat_loader_idkits_init_from_config_jagfile(struct BuildCacheDat* buildcachedat)
 {
+    /* Packet scripts call this every time; decode once per config load. */
+    if( dashmap_count(buildcachedat->idk_hmap) > 0 && dashmap_count(buildcachedat->npc_hmap) > 0 )
+        return;
+
     struct FileListDat* filelist = buildcachedat_config_jagfile(buildcachedat);
 
     int data_file_idx = filelist_dat_find_file_by_name(filelist, "idk.dat");
@@ -1080,6 +1295,9 @@ buildcachedat_loader_idkits_init_from_config_jagfile(struct BuildCacheDat* build
 void
 buildcachedat_loader_objects_init_from_config_jagfile(struct BuildCacheDat* buildcachedat)
 {
+    if( dashmap_count(buildcachedat->obj_hmap) > 0 )
+        return;
+
     struct FileListDat* filelist = buildcachedat_config_jagfile(buildcachedat);
 
     int data_file_idx = filelist_dat_find_file_by_name(filelist, "obj.dat");
@@ -1216,18 +1434,56 @@ buildcachedat_loader_finalize_scene_centerzone(
     int zonez,
     int size)
 {
-    if( game->world )
-        world_free(game->world);
+    assert(!game->world_rebuild && "finalize_scene_centerzone: rebuild already in progress");
 
-    game->world = world_new(buildcachedat, game->scene2);
+    struct World* world = world_new(buildcachedat, game->scene2);
+
+    /* game->world keeps rendering until the swap. Batch ids continue from it so the renderer
+     * can drop its merged geometry afterwards, and the cullmap outlives zone rebuilds. */
+    if( game->world )
+    {
+        world->rebuild_batch_id_counter = game->world->rebuild_batch_id_counter;
+        world->cullmap = game->world->cullmap;
+        world->cullmap_near_clip_z = game->world->cullmap_near_clip_z;
+        world->cullmap_screen_width = game->world->cullmap_screen_width;
+        world->cullmap_screen_height = game->world->cullmap_screen_height;
+        game->world->cullmap = NULL;
+    }
 
     buildcachedat_clear_jagfiles(buildcachedat);
 
-    world_buildcachedat_rebuild_centerzone(game->world, zonex, zonez, size);
+    game->world_rebuild = world_rebuild_new(world, zonex, zonez, size);
+
+    buildcachedat_loader_step_scene_centerzone(buildcachedat, game);
+}
+
+bool
+buildcachedat_loader_step_scene_centerzone(
+    struct BuildCacheDat* buildcachedat,
+    struct GGame* game)
+{
+    if( !game->world_rebuild )
+        return true;
+
+    if( !world_rebuild_step(game->world_rebuild, game->rebuild_budget_ms) )
+        return false;
+
+    struct World* world = world_rebuild_take(game->world_rebuild);
+    game->world_rebuild = NULL;
+
+    if( game->world )
+    {
+        if( game->world->rebuild_prev_batch_id != 0 )
+            scene2_batch_clear(game->scene2, game->world->rebuild_prev_batch_id);
+        world_free(game->world);
+    }
+    game->world = world;
 
     LibToriRS_WorldMinimapStaticRebuild(game);
 
     buildcachedat_clear(buildcachedat);
+
+    return true;
 }
 
 void
@@ -93,6 +93,44 @@ buildcachedat_loader_model_cache_add(
     int data_size,
     void* data);
 
+struct CacheDatArchive;
+
+enum BuildCacheDatLoaderDecodeKind
+{
+    BUILDCACHEDAT_LOADER_DECODE_MAP_TERRAIN = 1,
+    BUILDCACHEDAT_LOADER_DECODE_MAP_SCENERY = 2,
+    BUILDCACHEDAT_LOADER_DECODE_MODEL = 3,
+};
+
+struct BuildCacheDatLoaderDecodeJob
+{
+    enum BuildCacheDatLoaderDecodeKind kind;
+    /** (mapx << 16) | mapz for the map kinds, the model id for models. */
+    int id;
+    /** Freed by buildcachedat_loader_decode_archives. May still be compressed
+     *  (cache_dat_archive_new_load_compressed); NULL jobs are skipped. */
+    struct CacheDatArchive* archive;
+
+    void* _decoded;
+};
+
+/** Decompress and decode every job's archive on the BuildCacheDat decode pool, then add the
+ *  results to the terrain/scenery/model hmaps on the calling thread in job order. The hmaps end
+ *  up exactly as if the matching *_cache_add functions had been called one job at a time. */
+void
+buildcachedat_loader_decode_archives(
+    struct BuildCacheDat* buildcachedat,
+    struct BuildCacheDatLoaderDecodeJob* jobs,
+    int job_count);
+
+/** Same decode as buildcachedat_loader_decode_archives, but the results go to the prefetch store
+ *  (buildcachedat_prefetch_add) instead of the live hmaps. */
+void
+buildcachedat_loader_prefetch_archives(
+    struct BuildCacheDat* buildcachedat,
+    struct BuildCacheDatLoaderDecodeJob* jobs,
+    int job_count);
+
 struct Scene2;
 struct UIScene;
 
@@ -159,6 +197,8 @@ buildcachedat_loader_finalize_scene(
     int map_ne_x,
     int map_ne_z);
 
+/** Starts an incremental rebuild into a new World; the current game->world stays visible.
+ *  The first slice runs immediately, the rest from buildcachedat_loader_step_scene_centerzone. */
 void
 buildcachedat_loader_finalize_scene_centerzone(
     struct BuildCacheDat* buildcachedat,
@@ -167,6 +207,14 @@ buildcachedat_loader_finalize_scene_centerzone(
     int zonez,
     int size);
 
+/** Advances game->world_rebuild by up to game->rebuild_budget_ms. When it finishes, swaps the
+ *  new world in, frees the old one and clears the buildcache. Returns true when no rebuild is
+ *  left in progress. */
+bool
+buildcachedat_loader_step_scene_centerzone(
+    struct BuildCacheDat* buildcachedat,
+    struct GGame* game);
+
 /** Set up a fresh World for the chunked (slow-path) rebuild.
  *  Frees any existing world and creates a new one.  Jagfile lifecycle is
  *  left entirely to the caller: the config jagfile must remain valid through
@@ -192,6 +240,16 @@ buildcachedat_loader_scenery_config_get_model_ids_mapchunk(
     int mapz,
     int** model_ids_out);
 
+/** Unique model ids for a live or prefetched scenery square, without promoting the square.
+ *  Decodes missing loc configs from the config jagfile; returns 0 if either is not loaded.
+ *  Caller must free(*model_ids_out). */
+int
+buildcachedat_loader_prefetch_scenery_model_ids(
+    struct BuildCacheDat* buildcachedat,
+    int mapx,
+    int mapz,
+    int** model_ids_out);
+
 int
 buildcachedat_loader_scenery_config_get_animbaseframes_ids_mapchunk(
     struct BuildCacheDat* buildcachedat,
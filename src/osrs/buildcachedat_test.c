@@ -0,0 +1,121 @@
+#include "buildcachedat.h"
+
+#include "graphics/dashmap.h"
+#include "osrs/rscache/tables/maps.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Every terrain weighs the same against the budget, so budgets are given in terrains. */
+#define TERRAIN_BYTES ((int64_t)sizeof(struct CacheMapTerrain))
+
+static void
+add_terrain(
+    struct BuildCacheDat* buildcachedat,
+    int id)
+{
+    struct CacheMapTerrain* terrain = calloc(1, sizeof(struct CacheMapTerrain));
+    assert(terrain != NULL);
+    buildcachedat_prefetch_add(buildcachedat, BUILDCACHEDAT_PREFETCH_MAP_TERRAIN, id, terrain);
+}
+
+static int
+count_stored(
+    struct BuildCacheDat* buildcachedat,
+    int first_id,
+    int last_id)
+{
+    int n = 0;
+    for( int id = first_id; id <= last_id; id++ )
+        n += buildcachedat_prefetch_has(buildcachedat, BUILDCACHEDAT_PREFETCH_MAP_TERRAIN, id);
+    return n;
+}
+
+/* Every stored entry must still be reachable from the ring: dropping the budget to zero evicts
+ * each one once, and the byte count drains with them. */
+static void
+check_evicts_all(struct BuildCacheDat* buildcachedat)
+{
+    int stored = (int)dashmap_count(buildcachedat->prefetch_hmap);
+    int evictions = buildcachedat->prefetch_evictions;
+    assert(buildcachedat->prefetch_bytes == stored * TERRAIN_BYTES);
+
+    buildcachedat_prefetch_set_budget(buildcachedat, 0);
+    assert(dashmap_count(buildcachedat->prefetch_hmap) == 0);
+    assert(buildcachedat->prefetch_evictions - evictions == stored);
+    assert(buildcachedat->prefetch_bytes == 0);
+}
+
+static void
+test_order_ring_wraps(void)
+{
+    printf("TEST: prefetch order ring wraps and grows\n");
+
+    struct BuildCacheDat* buildcachedat = buildcachedat_new();
+    buildcachedat_prefetch_set_budget(buildcachedat, 1024 * TERRAIN_BYTES);
+
+    /* Fill the ring, evict from the front, then fill it again so it wraps. */
+    int next_id = 0;
+    while( buildcachedat->prefetch_order_capacity == 0 ||
+           buildcachedat->prefetch_order_count < buildcachedat->prefetch_order_capacity )
+        add_terrain(buildcachedat, next_id++);
+    int capacity = buildcachedat->prefetch_order_capacity;
+
+    buildcachedat_prefetch_set_budget(buildcachedat, (capacity - capacity / 4) * TERRAIN_BYTES);
+    assert(buildcachedat->prefetch_order_head == capacity / 4);
+    buildcachedat_prefetch_set_budget(buildcachedat, 1024 * TERRAIN_BYTES);
+    while( buildcachedat->prefetch_order_count < capacity )
+        add_terrain(buildcachedat, next_id++);
+
+    /* A full, wrapped ring of live items: this push grows it. */
+    add_terrain(buildcachedat, next_id++);
+    assert(buildcachedat->prefetch_order_capacity == capacity * 2);
+    assert(count_stored(buildcachedat, capacity / 4, next_id - 1) == next_id - capacity / 4);
+    assert(count_stored(buildcachedat, 0, capacity / 4 - 1) == 0);
+
+    check_evicts_all(buildcachedat);
+    buildcachedat_free(buildcachedat);
+    printf("  OK\n");
+}
+
+static void
+test_order_ring_drops_stale(void)
+{
+    printf("TEST: prefetch order ring drops stale items without growing\n");
+
+    struct BuildCacheDat* buildcachedat = buildcachedat_new();
+    buildcachedat_prefetch_set_budget(buildcachedat, 16 * TERRAIN_BYTES);
+
+    /* Re-adding a stored entry leaves its old ring item stale. Keep 16 entries and touch them
+     * until the ring has wrapped and been compacted several times without growing. */
+    for( int id = 0; id < 16; id++ )
+        add_terrain(buildcachedat, id);
+    int capacity = buildcachedat->prefetch_order_capacity;
+    for( int i = 0; i < capacity * 4; i++ )
+    {
+        add_terrain(buildcachedat, (i * 7) % 16);
+        if( i % 5 == 0 )
+            add_terrain(buildcachedat, 16 + i);
+    }
+    assert(buildcachedat->prefetch_order_capacity == capacity);
+    assert(dashmap_count(buildcachedat->prefetch_hmap) == 16);
+
+    check_evicts_all(buildcachedat);
+    buildcachedat_free(buildcachedat);
+    printf("  OK\n");
+}
+
+// compile from src/ with -I. -Iosrs and link the sources of test/datserver/Makefile (without
+// datserver.c and the browser2 files), graphics/dash_model.c, graphics/dash_bench.c,
+// platforms/common/platform_thread.c and platforms/common/platform_memory.c.
+int
+main(void)
+{
+    test_order_ring_wraps();
+    test_order_ring_drops_stale();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -195,7 +195,6 @@ dashpixfont_new_from_cache_dat_pixfont_move(struct CacheDatPixfont* pixfont)
     memset(dashpixfont, 0, sizeof(struct DashPixFont));
     dashpixfont->charcode_set = pixfont->charcode_set;
 
-    memcpy(dashpixfont->char_mask, pixfont->char_mask, sizeof(int*) * DASH_FONT_CHAR_COUNT);
 
     memcpy(
         dashpixfont->char_mask_width, pixfont->char_mask_width, sizeof(int) * DASH_FONT_CHAR_COUNT);
@@ -219,6 +218,14 @@ dashpixfont_new_from_cache_dat_pixfont_move(struct CacheDatPixfont* pixfont)
         }
     }
 
+    // The decoder's int masks (4 bytes per pixel) are only needed to pack the glyph bits.
+    for( int i = 0; i < DASH_FONT_CHAR_COUNT; i++ )
+    {
+        dashpixfont->char_bits[i] = dashfont_pack_mask(
+            pixfont->char_mask[i], pixfont->char_mask_width[i], pixfont->char_mask_height[i]);
+        free(pixfont->char_mask[i]);
+    }
+
     dashpixfont->atlas = dashfont_build_atlas(dashpixfont);
 
     // Moved out of.
@@ -12,6 +12,7 @@
 #include "osrs/buildcachedat.h"
 #include "osrs/clientscript_vm.h"
 #include "osrs/ginput.h"
+#include "osrs/packet_queue.h"
 #include "osrs/packetbuffer.h"
 #include "osrs/packets/revpacket_lc245_2.h"
 #include "osrs/painters.h"
@@ -43,12 +44,11 @@ struct RevConfigBuffer;
 
 #define ACTIVE_PLAYER_SLOT 2047
 
-struct RevPacket_LC245_2_Item
-{
-    struct RevPacket_LC245_2 packet;
+/** Default cap on center-zone rebuild work per GameStep (see GGame::rebuild_budget_ms). */
+#ifndef GAME_REBUILD_BUDGET_MS_DEFAULT
+#define GAME_REBUILD_BUDGET_MS_DEFAULT 6
+#endif
 
-    struct RevPacket_LC245_2_Item* next_nullable;
-};
 enum GameNetState
 {
     GAME_NET_STATE_DISCONNECTED,
@@ -169,13 +169,40 @@ struct GGame
     uint64_t next_tick_ms;
     uint64_t next_camera_save_ms;
 
-    struct RevPacket_LC245_2_Item* packets_lc245_2;
+    /** Parsed incoming packets, drained by gameproto_process. */
+    struct PacketQueue packets_lc245_2;
 
     struct World* world;
+    /** Center-zone rebuild in progress; `world` keeps rendering until it is swapped in. Packets
+     * and Lua scripts queued behind the rebuild are held until then. */
+    struct WorldRebuild* world_rebuild;
+    /** Milliseconds of rebuild work per GameStep; <= 0 finishes a rebuild in one step. */
+    int rebuild_budget_ms;
+    /** Neighbor-zone prefetch: last local player tile, sticky walk direction per axis (-1/0/1)
+     * and the last zone a SCRIPT_PREFETCH_ZONE was queued for (-1 when none). */
+    int prefetch_tile_x;
+    int prefetch_tile_z;
+    int prefetch_dir_x;
+    int prefetch_dir_z;
+    int prefetch_zone_x;
+    int prefetch_zone_z;
     struct WorldPickSet pickset;
     struct WorldOptionSet option_set;
 
     struct DashGraphics* sys_dash;
+    /* Projected vertices for this frame's MODEL_DRAW commands; reset in LibToriRS_FrameBegin. */
+    struct DashProjectionArena* sys_projection_arena;
+    /* Occlusion coverage for the world pass, filled from terrain and walls before any model is
+     * projected. sys_occluder_projections[i] is the prepass record for painter command i. */
+    struct DashCoverage* sys_coverage;
+    struct DashProjectedModel** sys_occluder_projections;
+    int sys_occluder_projections_capacity;
+    /* Baked player/NPC animation poses, shared by entities that use the same base model. */
+    struct DashPoseCache* sys_pose_cache;
+    /* Rendered inventory icons; see obj_icon_cache.h. */
+    struct ObjIconCache* sys_obj_icon_cache;
+    /* Laid-out text lines for the software renderers' FONT_DRAW commands. */
+    struct DashTextCache* sys_text_cache;
     struct PaintersBuffer* sys_painter_buffer;
 
     struct DashPosition* position;
@@ -145,6 +145,8 @@ struct PlayerAppearanceSlots
 {
     int slots[12];
     int colors[5];
+    /** Hash of the last applied appearance block; 0 until one is applied. */
+    uint64_t block_hash;
 };
 
 struct PlayerEntity
@@ -191,6 +191,31 @@ gameproto_exec_npc_info(
 
 static struct PktPlayerInfoReader player_info_reader = { 0 };
 
+/* FNV-1a over the raw appearance block; 0 is reserved for "no appearance applied". */
+static uint64_t
+appearance_block_hash(
+    const uint8_t* block,
+    int len)
+{
+    uint64_t h = 1469598103934665603ULL;
+    for( int i = 0; i < len; i++ )
+    {
+        h ^= block[i];
+        h *= 1099511628211ULL;
+    }
+    return h ? h : 1;
+}
+
+static bool
+player_has_model(
+    struct GGame* game,
+    struct PlayerEntity* player)
+{
+    struct Scene2Element* element =
+        scene2_element_at(game->world->scene2, player->scene_element2.element_id);
+    return element && scene2_element_dash_model(element) != NULL;
+}
+
 void
 add_player_info(
     struct GGame* game,
@@ -296,10 +321,17 @@ add_player_info(
         {
             if( player_id < 0 )
                 break;
+            /* The server resends unchanged blocks; only rebuild the model when it differs. */
+            uint64_t block_hash =
+                appearance_block_hash(op->_appearance.appearance, op->_appearance.len);
+            if( player->appearance.block_hash == block_hash && player_has_model(game, player) )
+                break;
+
             struct PlayerAppearance appearance;
             player_appearance_decode(&appearance, op->_appearance.appearance, op->_appearance.len);
 
             world_player_entity_set_appearance(game->world, player_id, &appearance);
+            player->appearance.block_hash = block_hash;
         }
         break;
         case PKT_PLAYER_INFO_OP_FACE_ENTITY:
@@ -537,6 +569,153 @@ gameproto_exec_rebuild_normal_world(
     }
 }
 
+/*
+ * Native fast path for PLAYER_INFO / NPC_INFO. pkt_player_info.lua and pkt_npc_info.lua exist to
+ * fetch model archives before exec; once every model they would request is already decoded, the
+ * packet can run straight from gameproto_process. These mirror the ids those scripts queue.
+ */
+static bool
+model_loaded(
+    struct BuildCacheDat* buildcachedat,
+    int model_id)
+{
+    return model_id <= 0 || buildcachedat_get_model(buildcachedat, model_id) != NULL;
+}
+
+static bool
+idk_models_loaded(
+    struct BuildCacheDat* buildcachedat,
+    int idk_id,
+    bool need_body)
+{
+    struct CacheDatConfigIdk* idk = buildcachedat_get_idk(buildcachedat, idk_id);
+    if( !idk )
+        return false;
+
+    if( need_body && !buildcachedat_get_idk_model(buildcachedat, idk_id) )
+    {
+        for( int i = 0; i < idk->models_count; i++ )
+            if( !model_loaded(buildcachedat, idk->models[i]) )
+                return false;
+    }
+    for( int i = 0; i < 10; i++ )
+        if( !model_loaded(buildcachedat, idk->heads[i]) )
+            return false;
+    return true;
+}
+
+static bool
+obj_models_loaded(
+    struct BuildCacheDat* buildcachedat,
+    int obj_id,
+    bool need_body)
+{
+    struct CacheDatConfigObj* obj = buildcachedat_get_obj(buildcachedat, obj_id);
+    if( !obj )
+        return false;
+
+    if( need_body && !buildcachedat_get_obj_model(buildcachedat, obj_id) )
+    {
+        if( !model_loaded(buildcachedat, obj->manwear) ||
+            !model_loaded(buildcachedat, obj->manwear2) ||
+            !model_loaded(buildcachedat, obj->manwear3) )
+            return false;
+    }
+    return model_loaded(buildcachedat, obj->model) && model_loaded(buildcachedat, obj->manhead) &&
+           model_loaded(buildcachedat, obj->manhead2) &&
+           model_loaded(buildcachedat, obj->womanhead) &&
+           model_loaded(buildcachedat, obj->womanhead2);
+}
+
+static struct PktPlayerInfoReader player_info_ready_reader = { 0 };
+static struct PktNpcInfoReader npc_info_ready_reader = { 0 };
+
+bool
+gameproto_player_info_models_ready(
+    struct GGame* game,
+    void* data,
+    int length)
+{
+    if( !game->world || !game->buildcachedat )
+        return false;
+
+    struct BuildCacheDat* buildcachedat = game->buildcachedat;
+    struct PktPlayerInfoOp ops[2048];
+    struct PktPlayerInfo pkt = { .data = data, .length = length };
+
+    player_info_ready_reader.extended_count = 0;
+    player_info_ready_reader.current_op = 0;
+    player_info_ready_reader.max_ops = 2048;
+    int count = pkt_player_info_reader_read(&player_info_ready_reader, &pkt, ops, 2048);
+
+    for( int i = 0; i < count; i++ )
+    {
+        if( ops[i].kind != PKT_PLAYER_INFO_OP_APPEARANCE )
+            continue;
+
+        struct PlayerAppearance appearance;
+        player_appearance_decode(
+            &appearance, ops[i]._appearance.appearance, ops[i]._appearance.len);
+
+        /* A warm merged body only leaves the chat-head models to check. */
+        bool need_body = !buildcachedat_get_appearance_model(buildcachedat, appearance.appearance);
+
+        struct AppearanceOp op;
+        for( int slot = 0; slot < 12; slot++ )
+        {
+            appearances_decode(&op, appearance.appearance, slot);
+            if( op.kind == APPEARANCE_KIND_IDK &&
+                !idk_models_loaded(buildcachedat, op.id, need_body) )
+                return false;
+            if( op.kind == APPEARANCE_KIND_OBJ &&
+                !obj_models_loaded(buildcachedat, op.id, need_body) )
+                return false;
+        }
+    }
+    return true;
+}
+
+bool
+gameproto_npc_info_models_ready(
+    struct GGame* game,
+    void* data,
+    int length)
+{
+    if( !game->world || !game->buildcachedat )
+        return false;
+
+    struct BuildCacheDat* buildcachedat = game->buildcachedat;
+    struct PktNpcInfoOp ops[2048];
+    struct PktNpcInfo pkt = { .data = data, .length = length };
+
+    npc_info_ready_reader.extended_count = 0;
+    npc_info_ready_reader.current_op = 0;
+    npc_info_ready_reader.max_ops = 2048;
+    int count = pkt_npc_info_reader_read(&npc_info_ready_reader, &pkt, ops, 2048);
+
+    for( int i = 0; i < count; i++ )
+    {
+        if( ops[i].kind != PKT_NPC_INFO_OPBITS_NPCTYPE )
+            continue;
+
+        int npc_type = ops[i]._bitvalue;
+        struct CacheDatConfigNpc* npc = buildcachedat_get_npc(buildcachedat, npc_type);
+        if( !npc )
+            return false;
+
+        if( !buildcachedat_get_npc_model(buildcachedat, npc_type) )
+        {
+            for( int m = 0; m < npc->models_count; m++ )
+                if( !model_loaded(buildcachedat, npc->models[m]) )
+                    return false;
+        }
+        for( int h = 0; h < npc->heads_count; h++ )
+            if( !model_loaded(buildcachedat, npc->heads[h]) )
+                return false;
+    }
+    return true;
+}
+
 void
 gameproto_exec_player_info_raw(
     struct GGame* game,
@@ -5,6 +5,8 @@
 #include "packets/revpacket_lc245_2.h"
 #include "world.h"
 
+#include <stdbool.h>
+
 void
 gameproto_exec_lc245_2(
     struct GGame* game,
@@ -26,6 +28,20 @@ gameproto_exec_rebuild_normal(
     struct GGame* game,
     struct RevPacket_LC245_2* packet);
 
+/** True when every model pkt_player_info.lua would fetch for this packet is already decoded. */
+bool
+gameproto_player_info_models_ready(
+    struct GGame* game,
+    void* data,
+    int length);
+
+/** True when every model pkt_npc_info.lua would fetch for this packet is already decoded. */
+bool
+gameproto_npc_info_models_ready(
+    struct GGame* game,
+    void* data,
+    int length);
+
 void
 gameproto_exec_player_info_raw(
     struct GGame* game,
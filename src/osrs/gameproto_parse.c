@@ -36,19 +36,15 @@ gameproto_parse_lc245_2(
     case PKTIN_LC245_2_NPC_INFO:
     {
         printf("PKTIN_LC245_2_NPC_INFO\n");
-        uint8_t* commandstream = malloc(data_size);
-        memcpy(commandstream, data, data_size);
         packet->_npc_info.length = data_size;
-        packet->_npc_info.data = commandstream;
+        packet->_npc_info.data = data;
         return 1;
     }
     case PKTIN_LC245_2_PLAYER_INFO:
     {
         printf("PKTIN_LC245_2_PLAYER_INFO\n");
-        uint8_t* commandstream = malloc(data_size);
-        memcpy(commandstream, data, data_size);
         packet->_player_info.length = data_size;
-        packet->_player_info.data = commandstream;
+        packet->_player_info.data = data;
         return 1;
     }
     case PKTIN_LC245_2_UPDATE_INV_FULL:
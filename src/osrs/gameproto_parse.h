@@ -5,6 +5,12 @@
 #include "gameproto_revisions.h"
 #include "packets/revpacket_lc245_2.h"
 
+#include <stdbool.h>
+
+/**
+ * PLAYER_INFO and NPC_INFO keep `data` itself as their payload instead of copying it; the caller
+ * must hand ownership of `data` to the packet (see gameproto_lc245_2_takes_payload).
+ */
 int
 gameproto_parse_lc245_2(
     int packet_type,
@@ -12,6 +18,13 @@ gameproto_parse_lc245_2(
     int data_size,
     struct RevPacket_LC245_2* packet);
 
+/** True when a parsed packet of this type owns the payload buffer passed to the parser. */
+static inline bool
+gameproto_lc245_2_takes_payload(int packet_type)
+{
+    return packet_type == PKTIN_LC245_2_PLAYER_INFO || packet_type == PKTIN_LC245_2_NPC_INFO;
+}
+
 /** Free heap fields inside `item->packet` (safe after exec; IF_SETTEXT pointer nulled by exec). */
 void
 gameproto_free_lc245_2_item(struct RevPacket_LC245_2_Item* item);
@@ -3,84 +3,118 @@
 #include "osrs/game.h"
 #include "osrs/gameproto_exec.h"
 #include "osrs/gameproto_parse.h"
+#include "osrs/packet_queue.h"
 #include "osrs/script_queue.h"
 
+#include <stdbool.h>
 #include <stdlib.h>
 
+/* Packets handled by a Lua script; the item stays alive until the script has run. */
+static bool
+packet_script_args(
+    struct RevPacket_LC245_2_Item* item,
+    struct ScriptArgs* args)
+{
+    switch( item->packet.packet_type )
+    {
+    case PKTIN_LC245_2_REBUILD_NORMAL:
+        *args = (struct ScriptArgs){
+            .tag = SCRIPT_PKT_REBUILD_NORMAL,
+            .u.rebuild_normal = { .zonex = item->packet._map_rebuild.zonex,
+                                 .zonez = item->packet._map_rebuild.zonez },
+        };
+        return true;
+    case PKTIN_LC245_2_PLAYER_INFO:
+        *args = (struct ScriptArgs){
+            .tag = SCRIPT_PKT_PLAYER_INFO,
+            .u.player_info = { .data = item->packet._player_info.data,
+                              .length = item->packet._player_info.length },
+        };
+        return true;
+    case PKTIN_LC245_2_NPC_INFO:
+        *args = (struct ScriptArgs){
+            .tag = SCRIPT_PKT_NPC_INFO,
+            .u.npc_info = { .data = item->packet._npc_info.data,
+                           .length = item->packet._npc_info.length },
+        };
+        return true;
+    case PKTIN_LC245_2_IF_SETTAB:
+        *args = (struct ScriptArgs){
+            .tag = SCRIPT_PKT_IF_SETTAB,
+            .u.lc245_packet = { .item = item },
+        };
+        return true;
+    case PKTIN_LC245_2_UPDATE_INV_FULL:
+        *args = (struct ScriptArgs){
+            .tag = SCRIPT_PKT_UPDATE_INV_FULL,
+            .u.lc245_packet = { .item = item },
+        };
+        return true;
+    default:
+        return false;
+    }
+}
+
+/* Info packets whose models are all decoded skip their Lua script and run here. */
+static bool
+packet_models_ready(
+    struct GGame* game,
+    struct RevPacket_LC245_2_Item* item)
+{
+    struct RevPacket_LC245_2* packet = &item->packet;
+    switch( packet->packet_type )
+    {
+    case PKTIN_LC245_2_PLAYER_INFO:
+        return gameproto_player_info_models_ready(
+            game, packet->_player_info.data, packet->_player_info.length);
+    case PKTIN_LC245_2_NPC_INFO:
+        return gameproto_npc_info_models_ready(
+            game, packet->_npc_info.data, packet->_npc_info.length);
+    default:
+        return false;
+    }
+}
+
 void
 gameproto_process(struct GGame* game)
 {
     struct ScriptArgs args;
-    if( game->packets_lc245_2 )
+    struct RevPacket_LC245_2_Item* item;
+    bool scripts_pending = false;
+
+    /* Packets after a REBUILD apply to the new world; leave them queued until it is swapped in. */
+    if( game->world_rebuild )
+        return;
+
+    /* Drain everything that arrived, in order. Scripts run after GameStep returns, so a packet
+     * executed here must not overtake one already handed to a script this step. */
+    while( (item = packet_queue_peek(&game->packets_lc245_2)) )
     {
-        struct RevPacket_LC245_2_Item* item = game->packets_lc245_2;
-        game->packets_lc245_2 = item->next_nullable;
+        int packet_type = item->packet.packet_type;
+        /* Behind a pending script an info packet keeps its script too, preserving order. */
+        bool native = !scripts_pending && packet_models_ready(game, item);
+        bool scripted = !native && packet_script_args(item, &args);
+        if( !scripted && scripts_pending )
+            break;
+
+        packet_queue_pop(&game->packets_lc245_2);
 
-        switch( item->packet.packet_type )
+        if( !scripted )
         {
-        case PKTIN_LC245_2_REBUILD_NORMAL:
-            args = (struct ScriptArgs){
-                .tag = SCRIPT_PKT_REBUILD_NORMAL,
-                .u.rebuild_normal = { .zonex = item->packet._map_rebuild.zonex,
-                                     .zonez = item->packet._map_rebuild.zonez },
-            };
-            {
-                struct ScriptQueueItem* qi = script_queue_push(&game->script_queue, &args);
-                if( qi )
-                    qi->lc245_2_packet_to_free = item;
-            }
-            break;
-        case PKTIN_LC245_2_PLAYER_INFO:
-            args = (struct ScriptArgs){
-                .tag = SCRIPT_PKT_PLAYER_INFO,
-                .u.player_info = { .data = item->packet._player_info.data,
-                                  .length = item->packet._player_info.length },
-            };
-            {
-                struct ScriptQueueItem* qi = script_queue_push(&game->script_queue, &args);
-                if( qi )
-                    qi->lc245_2_packet_to_free = item;
-            }
-            break;
-        case PKTIN_LC245_2_NPC_INFO:
-            args = (struct ScriptArgs){
-                .tag = SCRIPT_PKT_NPC_INFO,
-                .u.npc_info = { .data = item->packet._npc_info.data,
-                               .length = item->packet._npc_info.length },
-            };
-            {
-                struct ScriptQueueItem* qi = script_queue_push(&game->script_queue, &args);
-                if( qi )
-                    qi->lc245_2_packet_to_free = item;
-            }
-            break;
-        case PKTIN_LC245_2_IF_SETTAB:
-            args = (struct ScriptArgs){
-                .tag = SCRIPT_PKT_IF_SETTAB,
-                .u.lc245_packet = { .item = item },
-            };
-            {
-                struct ScriptQueueItem* qi = script_queue_push(&game->script_queue, &args);
-                if( qi )
-                    qi->lc245_2_packet_to_free = item;
-            }
-            break;
-        case PKTIN_LC245_2_UPDATE_INV_FULL:
-            args = (struct ScriptArgs){
-                .tag = SCRIPT_PKT_UPDATE_INV_FULL,
-                .u.lc245_packet = { .item = item },
-            };
-            {
-                struct ScriptQueueItem* qi = script_queue_push(&game->script_queue, &args);
-                if( qi )
-                    qi->lc245_2_packet_to_free = item;
-            }
-            break;
-        default:
             gameproto_exec_lc245_2(game, &item->packet);
-            gameproto_free_lc245_2_item(item);
-            free(item);
-            break;
+            packet_queue_release(item);
+            continue;
         }
+
+        struct ScriptQueueItem* qi = script_queue_push(&game->script_queue, &args);
+        if( qi )
+            qi->lc245_2_packet_to_free = item;
+        else
+            packet_queue_release(item);
+        scripts_pending = true;
+
+        /* The rebuild script starts world_rebuild; everything after it waits for the new world. */
+        if( packet_type == PKTIN_LC245_2_REBUILD_NORMAL )
+            break;
     }
 }
@@ -56,25 +56,30 @@ gioqb_cache_dat_texture_new_load(struct CacheDat* cache_dat)
     return NULL;
 }
 
-struct CacheDatArchive*
-gioqb_cache_dat_map_terrain_new_load(
+static struct CacheMapSquare*
+find_map_square(
     struct CacheDat* cache_dat,
     int chunk_x,
     int chunk_z)
 {
     int map_id = cache_map_square_id(chunk_x, chunk_z);
 
-    struct CacheMapSquare* map_square = NULL;
-
     for( int i = 0; i < cache_dat->map_squares->squares_count; i++ )
     {
         if( cache_dat->map_squares->squares[i].map_id == map_id )
-        {
-            map_square = &cache_dat->map_squares->squares[i];
-            break;
-        }
+            return &cache_dat->map_squares->squares[i];
     }
 
+    return NULL;
+}
+
+struct CacheDatArchive*
+gioqb_cache_dat_map_terrain_new_load(
+    struct CacheDat* cache_dat,
+    int chunk_x,
+    int chunk_z)
+{
+    struct CacheMapSquare* map_square = find_map_square(cache_dat, chunk_x, chunk_z);
     if( !map_square )
     {
         printf("Failed to load map terrain %d, %d\n", chunk_x, chunk_z);
@@ -84,6 +89,23 @@ gioqb_cache_dat_map_terrain_new_load(
     return cache_dat_archive_new_load(cache_dat, CACHE_DAT_MAPS, map_square->terrain_archive_id);
 }
 
+struct CacheDatArchive*
+gioqb_cache_dat_map_terrain_new_load_compressed(
+    struct CacheDat* cache_dat,
+    int chunk_x,
+    int chunk_z)
+{
+    struct CacheMapSquare* map_square = find_map_square(cache_dat, chunk_x, chunk_z);
+    if( !map_square )
+    {
+        printf("Failed to load map terrain %d, %d\n", chunk_x, chunk_z);
+        return NULL;
+    }
+
+    return cache_dat_archive_new_load_compressed(
+        cache_dat, CACHE_DAT_MAPS, map_square->terrain_archive_id);
+}
+
 struct CacheDatArchive* //
 gioqb_cache_dat_models_new_load(
     struct CacheDat* cache_dat,
@@ -110,26 +132,31 @@ gioqb_cache_dat_map_scenery_new_load(
     int chunk_x,
     int chunk_z)
 {
-    int map_id = cache_map_square_id(chunk_x, chunk_z);
-
-    struct CacheMapSquare* map_square = NULL;
-
-    for( int i = 0; i < cache_dat->map_squares->squares_count; i++ )
+    struct CacheMapSquare* map_square = find_map_square(cache_dat, chunk_x, chunk_z);
+    if( !map_square )
     {
-        if( cache_dat->map_squares->squares[i].map_id == map_id )
-        {
-            map_square = &cache_dat->map_squares->squares[i];
-            break;
-        }
+        printf("Failed to load map scenery %d, %d\n", chunk_x, chunk_z);
+        return NULL;
     }
 
+    return cache_dat_archive_new_load(cache_dat, CACHE_DAT_MAPS, map_square->loc_archive_id);
+}
+
+struct CacheDatArchive*
+gioqb_cache_dat_map_scenery_new_load_compressed(
+    struct CacheDat* cache_dat,
+    int chunk_x,
+    int chunk_z)
+{
+    struct CacheMapSquare* map_square = find_map_square(cache_dat, chunk_x, chunk_z);
     if( !map_square )
     {
         printf("Failed to load map scenery %d, %d\n", chunk_x, chunk_z);
         return NULL;
     }
 
-    return cache_dat_archive_new_load(cache_dat, CACHE_DAT_MAPS, map_square->loc_archive_id);
+    return cache_dat_archive_new_load_compressed(
+        cache_dat, CACHE_DAT_MAPS, map_square->loc_archive_id);
 }
 
 struct CacheDatArchive*
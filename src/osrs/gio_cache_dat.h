@@ -33,6 +33,19 @@ gioqb_cache_dat_map_terrain_new_load(
     int chunk_x,
     int chunk_y);
 
+/* As above, but the archive is left compressed for cache_dat_archive_decompress. */
+struct CacheDatArchive* //
+gioqb_cache_dat_map_scenery_new_load_compressed(
+    struct CacheDat* cache_dat,
+    int chunk_x,
+    int chunk_y);
+
+struct CacheDatArchive* //
+gioqb_cache_dat_map_terrain_new_load_compressed(
+    struct CacheDat* cache_dat,
+    int chunk_x,
+    int chunk_y);
+
 struct CacheDatArchive* //
 gioqb_cache_dat_models_new_load(
     struct CacheDat* cache_dat,
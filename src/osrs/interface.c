@@ -6,6 +6,7 @@
 
 #include "graphics/dash.h"
 #include "obj_icon.h"
+#include "obj_icon_cache.h"
 #include "osrs/buildcachedat.h"
 #include "osrs/dash_utils.h"
 #include "osrs/entity_scenebuild.h"
@@ -81,15 +82,18 @@ fill_rect_clipped(
     int height,
     int color_rgb)
 {
-    int x0 = x < vp->clip_left ? vp->clip_left : x;
-    int y0 = y < vp->clip_top ? vp->clip_top : y;
-    int x1 = x + width > vp->clip_right ? vp->clip_right : x + width;
-    int y1 = y + height > vp->clip_bottom ? vp->clip_bottom : y + height;
-    if( x0 >= x1 || y0 >= y1 )
-        return;
-    for( int py = y0; py < y1; py++ )
-        for( int px = x0; px < x1; px++ )
-            pixel_buffer[py * stride + px] = color_rgb;
+    dash2d_fill_rect_clipped(
+        pixel_buffer,
+        stride,
+        x,
+        y,
+        width,
+        height,
+        color_rgb,
+        vp->clip_left,
+        vp->clip_top,
+        vp->clip_right,
+        vp->clip_bottom);
 }
 
 static void
@@ -104,26 +108,20 @@ fill_rect_alpha_clipped(
     int color_rgb,
     int alpha)
 {
-    int x0 = x < vp->clip_left ? vp->clip_left : x;
-    int y0 = y < vp->clip_top ? vp->clip_top : y;
-    int x1 = x + width > vp->clip_right ? vp->clip_right : x + width;
-    int y1 = y + height > vp->clip_bottom ? vp->clip_bottom : y + height;
-    if( x0 >= x1 || y0 >= y1 )
-        return;
-    int r = (color_rgb >> 16) & 0xFF;
-    int g = (color_rgb >> 8) & 0xFF;
-    int b = color_rgb & 0xFF;
-    for( int py = y0; py < y1; py++ )
-        for( int px = x0; px < x1; px++ )
-        {
-            int idx = py * stride + px;
-            int existing = pixel_buffer[idx];
-            int er = (existing >> 16) & 0xFF, eg = (existing >> 8) & 0xFF, eb = existing & 0xFF;
-            int nr = (r * (256 - alpha) + er * alpha) >> 8;
-            int ng = (g * (256 - alpha) + eg * alpha) >> 8;
-            int nb = (b * (256 - alpha) + eb * alpha) >> 8;
-            pixel_buffer[idx] = (nr << 16) | (ng << 8) | nb;
-        }
+    /* alpha weights the existing pixel here, the reverse of dash2d_fill_rect_alpha. */
+    dash2d_fill_rect_alpha_clipped(
+        pixel_buffer,
+        stride,
+        x,
+        y,
+        width,
+        height,
+        color_rgb,
+        256 - alpha,
+        vp->clip_left,
+        vp->clip_top,
+        vp->clip_right,
+        vp->clip_bottom);
 }
 
 static void
@@ -1271,7 +1269,8 @@ interface_draw_component_inv(
                 int item_id = component->invSlotObjId[slot] - 1;
                 int item_count = component->invSlotObjCount[slot];
 
-                struct DashSprite* icon = obj_icon_get(game, item_id, item_count);
+                struct DashSprite* icon = obj_icon_cache_get(
+                    game->sys_obj_icon_cache, game, item_id, item_count, OBJ_ICON_DEFAULT);
 
                 if( icon )
                 {
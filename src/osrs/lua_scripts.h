@@ -6,6 +6,7 @@
 #include "datatypes/appearances.h"
 #include "datatypes/player_appearance.h"
 #include "graphics/dash.h"
+#include "graphics/dash_text_cache.h"
 #include "graphics/dashmap.h"
 #include "osrs/buildcache.h"
 #include "osrs/buildcache_loader.h"
@@ -569,6 +570,8 @@ l_buildcachedat_cache_title(lua_State* L)
     void* data = lua_touserdata(L, 2);
 
     buildcachedat_loader_cache_title(buildcachedat, game->ui_scene, data_size, data);
+    /* Replaced fonts may come back at the address of the ones they freed. */
+    dashtextcache_clear(game->sys_text_cache);
 
     return 0;
 }
@@ -42,7 +42,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    66u,
+    71u,
     0u,
     0u,
     0u,
@@ -61,7 +61,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    41u,
+    46u,
     0u,
     0u,
     0u,
@@ -101,7 +101,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    42u,
+    47u,
     0u,
     0u,
     24u,
@@ -110,8 +110,8 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    69u,
-    40u,
+    74u,
+    45u,
     0u,
     0u,
     0u,
@@ -135,7 +135,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    33u,
+    38u,
     0u,
     0u,
     0u,
@@ -144,7 +144,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    37u,
+    42u,
     0u,
     0u,
     0u,
@@ -169,9 +169,9 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    34u,
+    39u,
     0u,
-    38u,
+    43u,
     0u,
     0u,
     0u,
@@ -240,6 +240,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
+    27u,
     0u,
     0u,
     0u,
@@ -249,8 +250,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    0u,
-    26u,
+    31u,
     0u,
     12u,
     0u,
@@ -274,12 +274,12 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    75u,
+    80u,
     0u,
     0u,
     0u,
     0u,
-    28u,
+    33u,
     0u,
     0u,
     0u,
@@ -288,7 +288,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    68u,
+    73u,
     0u,
     0u,
     0u,
@@ -342,7 +342,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    64u,
+    69u,
     0u,
     0u,
     0u,
@@ -406,13 +406,13 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    62u,
+    67u,
     15u,
     0u,
     0u,
     0u,
     14u,
-    27u,
+    32u,
     13u,
     0u,
     0u,
@@ -438,8 +438,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    58u,
-    0u,
+    63u,
     0u,
     0u,
     0u,
@@ -447,14 +446,15 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    56u,
     0u,
-    47u,
+    61u,
     0u,
+    52u,
     0u,
     0u,
     0u,
     0u,
+    28u,
     0u,
     0u,
     0u,
@@ -477,12 +477,12 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    52u,
+    57u,
     0u,
     0u,
-    29u,
+    34u,
     0u,
-    71u,
+    76u,
     0u,
     0u,
     0u,
@@ -499,12 +499,12 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    51u,
+    56u,
     0u,
-    36u,
+    41u,
     0u,
     0u,
-    30u,
+    35u,
     0u,
     0u,
     0u,
@@ -567,7 +567,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    31u,
+    36u,
     0u,
     0u,
     0u,
@@ -590,7 +590,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    45u,
+    50u,
     0u,
     0u,
     0u,
@@ -606,7 +606,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    65u,
+    70u,
     0u,
     0u,
     0u,
@@ -636,7 +636,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     6u,
-    0u,
+    25u,
     0u,
     0u,
     0u,
@@ -674,20 +674,19 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    44u,
-    0u,
+    49u,
     0u,
     0u,
     0u,
     0u,
-    73u,
     0u,
+    78u,
     0u,
     0u,
     0u,
     0u,
-    74u,
     0u,
+    79u,
     0u,
     0u,
     0u,
@@ -696,6 +695,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
+    26u,
     0u,
     0u,
     0u,
@@ -703,7 +703,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    46u,
+    51u,
     0u,
     0u,
     0u,
@@ -717,7 +717,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    25u,
+    30u,
     0u,
     0u,
     4u,
@@ -725,7 +725,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    78u,
+    83u,
     0u,
     8u,
     0u,
@@ -743,7 +743,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    32u,
+    37u,
     0u,
     0u,
     0u,
@@ -778,23 +778,23 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    60u,
+    65u,
     0u,
     0u,
     0u,
     0u,
     0u,
     16u,
-    80u,
+    85u,
     0u,
     0u,
     0u,
     0u,
-    39u,
+    44u,
     0u,
-    76u,
+    81u,
     0u,
-    67u,
+    72u,
     0u,
     0u,
     0u,
@@ -808,7 +808,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    61u,
+    66u,
     0u,
     0u,
     0u,
@@ -858,7 +858,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     19u,
-    59u,
+    64u,
     0u,
     0u,
     0u,
@@ -882,7 +882,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    77u,
+    82u,
     0u,
     0u,
     0u,
@@ -896,7 +896,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    55u,
+    60u,
     0u,
     0u,
     0u,
@@ -927,16 +927,15 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    57u,
-    49u,
-    0u,
+    62u,
+    54u,
     0u,
     0u,
     0u,
     0u,
     0u,
-    70u,
     0u,
+    75u,
     0u,
     0u,
     0u,
@@ -962,20 +961,20 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    48u,
     0u,
+    53u,
     0u,
     0u,
-    79u,
     0u,
+    84u,
     0u,
     0u,
     0u,
     0u,
     0u,
     0u,
-    53u,
     0u,
+    58u,
     0u,
     0u,
     0u,
@@ -985,11 +984,12 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
+    29u,
     0u,
     0u,
     0u,
-    72u,
-    43u,
+    77u,
+    48u,
     0u,
     0u,
     0u,
@@ -1018,7 +1018,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    63u,
+    68u,
     0u,
     0u,
     0u,
@@ -1029,7 +1029,7 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    35u,
+    40u,
     0u,
     0u,
     0u,
@@ -1038,8 +1038,8 @@ static const uint16_t k_lua_api_ht_slot_id[LUA_API_HT_MOD] = {
     0u,
     0u,
     0u,
-    54u,
-    50u,
+    59u,
+    55u,
     0u,
     0u,
     0u,
@@ -1267,7 +1267,7 @@ static const uint32_t k_lua_api_ht_slot_kh[LUA_API_HT_MOD] = {
     0x00000000u,
     0x00000000u,
     0x00000000u,
-    0x00000000u,
+    0x1E3614DCu,
     0x00000000u,
     0x00000000u,
     0x00000000u,
@@ -1481,7 +1481,7 @@ static const uint32_t k_lua_api_ht_slot_kh[LUA_API_HT_MOD] = {
     0x00000000u,
     0x00000000u,
     0x00000000u,
-    0x00000000u,
+    0xBCE569B2u,
     0x00000000u,
     0x00000000u,
     0x00000000u,
@@ -1663,7 +1663,7 @@ static const uint32_t k_lua_api_ht_slot_kh[LUA_API_HT_MOD] = {
     0x00000000u,
     0x00000000u,
     0x0E17BE67u,
-    0x00000000u,
+    0x3DC02268u,
     0x00000000u,
     0x00000000u,
     0x00000000u,
@@ -1722,7 +1722,7 @@ static const uint32_t k_lua_api_ht_slot_kh[LUA_API_HT_MOD] = {
     0x00000000u,
     0x00000000u,
     0x00000000u,
-    0x00000000u,
+    0xCCC97AA3u,
     0x00000000u,
     0x00000000u,
     0x00000000u,
@@ -2011,7 +2011,7 @@ static const uint32_t k_lua_api_ht_slot_kh[LUA_API_HT_MOD] = {
     0x00000000u,
     0x00000000u,
     0x00000000u,
-    0x00000000u,
+    0xABAECBC4u,
     0x00000000u,
     0x00000000u,
     0x00000000u,
@@ -1,6 +1,7 @@
 #include "lua_buildcachedat.h"
 
 #include "lua_gametypes.h"
+#include "graphics/dash_text_cache.h"
 #include "osrs/buildcachedat.h"
 #include "osrs/buildcachedat_loader.h"
 #include "osrs/datatypes/appearances.h"
@@ -517,6 +518,125 @@ LuaBuildCacheDat_model_cache_add(
     return LuaGameType_NewVoid();
 }
 
+struct LuaGameType*
+LuaBuildCacheDat_decode_archives(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args)
+{
+    int count = LuaGameType_GetVarTypeArrayCount(args);
+    assert((count % 3) == 0);
+
+    int job_count = count / 3;
+    if( job_count <= 0 )
+        return LuaGameType_NewVoid();
+
+    struct BuildCacheDatLoaderDecodeJob* jobs =
+        calloc((size_t)job_count, sizeof(struct BuildCacheDatLoaderDecodeJob));
+    if( !jobs )
+    {
+        /* No room for the batch: decode (and free) the archives one at a time instead. */
+        for( int i = 0; i < job_count; i++ )
+        {
+            struct BuildCacheDatLoaderDecodeJob job = { 0 };
+            job.kind = (enum BuildCacheDatLoaderDecodeKind)arg_int(args, i * 3 + 0);
+            job.id = arg_int(args, i * 3 + 1);
+            job.archive = arg_userdata(args, i * 3 + 2);
+            buildcachedat_loader_decode_archives(buildcachedat, &job, 1);
+        }
+        return LuaGameType_NewVoid();
+    }
+    for( int i = 0; i < job_count; i++ )
+    {
+        jobs[i].kind = (enum BuildCacheDatLoaderDecodeKind)arg_int(args, i * 3 + 0);
+        jobs[i].id = arg_int(args, i * 3 + 1);
+        jobs[i].archive = arg_userdata(args, i * 3 + 2);
+    }
+
+    buildcachedat_loader_decode_archives(buildcachedat, jobs, job_count);
+    free(jobs);
+    return LuaGameType_NewVoid();
+}
+
+struct LuaGameType*
+LuaBuildCacheDat_prefetch_archives(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args)
+{
+    int count = LuaGameType_GetVarTypeArrayCount(args);
+    assert((count % 3) == 0);
+
+    int job_count = count / 3;
+    if( job_count <= 0 )
+        return LuaGameType_NewVoid();
+
+    struct BuildCacheDatLoaderDecodeJob* jobs =
+        calloc((size_t)job_count, sizeof(struct BuildCacheDatLoaderDecodeJob));
+    if( !jobs )
+    {
+        /* No room for the batch: prefetch the archives one at a time instead. */
+        for( int i = 0; i < job_count; i++ )
+        {
+            struct BuildCacheDatLoaderDecodeJob job = { 0 };
+            job.kind = (enum BuildCacheDatLoaderDecodeKind)arg_int(args, i * 3 + 0);
+            job.id = arg_int(args, i * 3 + 1);
+            job.archive = arg_userdata(args, i * 3 + 2);
+            buildcachedat_loader_prefetch_archives(buildcachedat, &job, 1);
+        }
+        return LuaGameType_NewVoid();
+    }
+
+    for( int i = 0; i < job_count; i++ )
+    {
+        jobs[i].kind = (enum BuildCacheDatLoaderDecodeKind)arg_int(args, i * 3 + 0);
+        jobs[i].id = arg_int(args, i * 3 + 1);
+        jobs[i].archive = arg_userdata(args, i * 3 + 2);
+    }
+
+    buildcachedat_loader_prefetch_archives(buildcachedat, jobs, job_count);
+    free(jobs);
+    return LuaGameType_NewVoid();
+}
+
+struct LuaGameType*
+LuaBuildCacheDat_prefetch_has(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args)
+{
+    int kind = arg_int(args, 0);
+    int id = arg_int(args, 1);
+    bool has =
+        buildcachedat_prefetch_has(buildcachedat, (enum BuildCacheDatPrefetchKind)kind, id);
+    return LuaGameType_NewBool(has);
+}
+
+struct LuaGameType*
+LuaBuildCacheDat_prefetch_scenery_model_ids(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args)
+{
+    int chunk_x = arg_int(args, 0);
+    int chunk_z = arg_int(args, 1);
+
+    int* model_ids = NULL;
+    int count = buildcachedat_loader_prefetch_scenery_model_ids(
+        buildcachedat, chunk_x, chunk_z, &model_ids);
+
+    struct LuaGameType* result = LuaGameType_NewIntArray(count);
+    for( int i = 0; i < count; i++ )
+        LuaGameType_IntArrayPush(result, model_ids[i]);
+    free(model_ids);
+    return result;
+}
+
+struct LuaGameType*
+LuaBuildCacheDat_has_config_jagfile(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args)
+{
+    (void)args;
+    return LuaGameType_NewBool(buildcachedat_config_jagfile(buildcachedat) != NULL);
+}
+
 struct LuaGameType*
 LuaBuildCacheDat_load_interfaces(
     struct BuildCacheDat* buildcachedat,
@@ -612,8 +732,12 @@ LuaBuildCacheDat_cache_title(
     struct CacheDatArchive* archive = arg_userdata(args, 0);
 
     if( game && game->ui_scene )
+    {
         buildcachedat_loader_cache_title(
             buildcachedat, game->ui_scene, archive->data_size, archive->data);
+        /* Replaced fonts may come back at the address of the ones they freed. */
+        dashtextcache_clear(game->sys_text_cache);
+    }
     cache_dat_archive_free(archive);
     return LuaGameType_NewVoid();
 }
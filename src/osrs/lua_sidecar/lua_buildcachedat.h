@@ -138,6 +138,34 @@ LuaBuildCacheDat_model_cache_add(
     struct BuildCacheDat* buildcachedat,
     struct LuaGameType* args);
 
+/** args: (kind, id, archive) triplets; see buildcachedat_loader_decode_archives. */
+struct LuaGameType*
+LuaBuildCacheDat_decode_archives(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args);
+
+/** args: (kind, id, archive) triplets, decoded into the prefetch store. */
+struct LuaGameType*
+LuaBuildCacheDat_prefetch_archives(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args);
+
+/** args: (kind, id); true if live or prefetched. */
+struct LuaGameType*
+LuaBuildCacheDat_prefetch_has(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args);
+
+struct LuaGameType*
+LuaBuildCacheDat_prefetch_scenery_model_ids(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args);
+
+struct LuaGameType*
+LuaBuildCacheDat_has_config_jagfile(
+    struct BuildCacheDat* buildcachedat,
+    struct LuaGameType* args);
+
 struct LuaGameType*
 LuaBuildCacheDat_load_interfaces(
     struct BuildCacheDat* buildcachedat,
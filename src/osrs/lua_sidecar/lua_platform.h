@@ -7,7 +7,7 @@ struct LuaGameScript
 {
     char name[64];
     struct LuaGameType* args;
-    /** Owned RevPacket_LC245_2_Item* freed after script run (see gameproto_free_lc245_2_item). */
+    /** Owned RevPacket_LC245_2_Item* released after script run (see packet_queue_release). */
     void* lc245_packet_item_to_free;
 };
 
@@ -6,41 +6,57 @@
 #include "osrs/rscache/cache_dat.h"
 
 #include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
 
-struct LuaGameType*
-LuaCSidecar_CachedatLoadArchive(
+static struct CacheDatArchive*
+load_archive(
     struct CacheDat* cache_dat,
-    struct LuaGameType* args)
+    int table_id,
+    int archive_id,
+    int flags)
 {
-    assert(args && LuaGameType_GetVarTypeArrayCount(args) >= 3);
-
-    int table_id = LuaGameType_GetInt(LuaGameType_GetVarTypeArrayAt(args, 0));
-    int archive_id = LuaGameType_GetInt(LuaGameType_GetVarTypeArrayAt(args, 1));
-    int flags = LuaGameType_GetInt(LuaGameType_GetVarTypeArrayAt(args, 2));
+    bool compressed = (flags & LUA_CACHEDAT_ARCHIVE_COMPRESSED) != 0;
 
-    int cache_dat_table = table_id;
-    struct CacheDatArchive* archive = NULL;
-
-    switch( cache_dat_table )
+    switch( table_id )
     {
     case CACHE_DAT_MAPS:
     {
         int chunk_x = archive_id >> 16;
         int chunk_z = archive_id & 0xFFFF;
-        if( flags == 2 )
-        {
-            archive = gioqb_cache_dat_map_scenery_new_load(cache_dat, chunk_x, chunk_z);
-        }
-        else if( flags == 1 )
+        switch( flags & LUA_CACHEDAT_ARCHIVE_MAP_MASK )
         {
-            archive = gioqb_cache_dat_map_terrain_new_load(cache_dat, chunk_x, chunk_z);
+        case LUA_CACHEDAT_ARCHIVE_MAP_SCENERY:
+            if( compressed )
+                return gioqb_cache_dat_map_scenery_new_load_compressed(cache_dat, chunk_x, chunk_z);
+            return gioqb_cache_dat_map_scenery_new_load(cache_dat, chunk_x, chunk_z);
+        case LUA_CACHEDAT_ARCHIVE_MAP_TERRAIN:
+            if( compressed )
+                return gioqb_cache_dat_map_terrain_new_load_compressed(cache_dat, chunk_x, chunk_z);
+            return gioqb_cache_dat_map_terrain_new_load(cache_dat, chunk_x, chunk_z);
+        default:
+            return NULL;
         }
     }
-    break;
     default:
-        archive = cache_dat_archive_new_load(cache_dat, table_id, archive_id);
-        break;
+        if( compressed )
+            return cache_dat_archive_new_load_compressed(cache_dat, table_id, archive_id);
+        return cache_dat_archive_new_load(cache_dat, table_id, archive_id);
     }
+}
+
+struct LuaGameType*
+LuaCSidecar_CachedatLoadArchive(
+    struct CacheDat* cache_dat,
+    struct LuaGameType* args)
+{
+    assert(args && LuaGameType_GetVarTypeArrayCount(args) >= 3);
+
+    int table_id = LuaGameType_GetInt(LuaGameType_GetVarTypeArrayAt(args, 0));
+    int archive_id = LuaGameType_GetInt(LuaGameType_GetVarTypeArrayAt(args, 1));
+    int flags = LuaGameType_GetInt(LuaGameType_GetVarTypeArrayAt(args, 2));
+
+    struct CacheDatArchive* archive = load_archive(cache_dat, table_id, archive_id, flags);
 
     assert(archive);
     return LuaGameType_NewUserData(archive);
@@ -71,31 +87,7 @@ LuaCSidecar_CachedatLoadArchives(
         int archive_id = LuaGameType_GetInt(LuaGameType_GetVarTypeArrayAt(args, base + 1));
         int flags = LuaGameType_GetInt(LuaGameType_GetVarTypeArrayAt(args, base + 2));
 
-        int cache_dat_table = table_id;
-        struct CacheDatArchive* archive = NULL;
-
-        switch( cache_dat_table )
-        {
-        case CACHE_DAT_MAPS:
-        {
-            int chunk_x = archive_id >> 16;
-            int chunk_z = archive_id & 0xFFFF;
-            if( flags == 2 )
-            {
-                archive = gioqb_cache_dat_map_scenery_new_load(cache_dat, chunk_x, chunk_z);
-            }
-            else if( flags == 1 )
-            {
-                archive = gioqb_cache_dat_map_terrain_new_load(cache_dat, chunk_x, chunk_z);
-            }
-        }
-        break;
-        default:
-            archive = cache_dat_archive_new_load(cache_dat, table_id, archive_id);
-            break;
-        }
-
-        archives[i] = archive;
+        archives[i] = load_archive(cache_dat, table_id, archive_id, flags);
     }
 
     struct LuaGameType* result = LuaGameType_NewUserDataArraySpread(triplet_count);
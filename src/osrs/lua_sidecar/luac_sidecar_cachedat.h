@@ -4,6 +4,17 @@
 #include "osrs/lua_sidecar/luac_sidecar.h"
 #include "osrs/rscache/cache_dat.h"
 
+/* Mirrors CacheDat.ArchiveIdFlags in scripts/cachedat.lua. */
+enum LuaCacheDatArchiveFlags
+{
+    LUA_CACHEDAT_ARCHIVE_MAP_TERRAIN = 1,
+    LUA_CACHEDAT_ARCHIVE_MAP_SCENERY = 2,
+    LUA_CACHEDAT_ARCHIVE_MAP_MASK = 3,
+    /* Return the archive still compressed; the consumer inflates it, e.g. on the
+     * buildcachedat_loader_decode_archives worker pool. */
+    LUA_CACHEDAT_ARCHIVE_COMPRESSED = 4,
+};
+
 struct LuaGameType*
 LuaCSidecar_CachedatLoadArchive(
     struct CacheDat* cache_dat,
@@ -46,23 +46,15 @@ get_obj_inv_model(
     return model;
 }
 
-// Generate a 32x32 icon sprite from an object model
-// Based on ObjType.getIcon() in Client.ts (lines 370-524)
-struct DashSprite*
-obj_icon_get(
+int
+obj_icon_resolve_count(
     struct GGame* game,
     int obj_id,
     int count)
 {
-    // obj_id is already 0-indexed (caller subtracts 1 from stored value)
-
-    // Get the object configuration
     struct CacheDatConfigObj* obj = buildcachedat_get_obj(game->buildcachedat, obj_id);
     if( !obj )
-    {
-        printf("obj_icon_get: Could not find obj %d in buildcachedat\n", obj_id);
-        return NULL;
-    }
+        return -1;
 
     // Handle count-based object variations (e.g., coin stacks)
     if( obj->countobj && obj->countco && count > 1 )
@@ -77,11 +69,36 @@ obj_icon_get(
         }
 
         if( countobj_id != -1 )
-        {
-            // printf("  Using count variant: %d -> %d (count=%d)\n", obj_id, countobj_id, count);
-            return obj_icon_get(game, countobj_id, 1);
-        }
+            return countobj_id;
     }
+    return obj_id;
+}
+
+// Generate a 32x32 icon sprite from an object model
+// Based on ObjType.getIcon() in Client.ts (lines 370-524)
+struct DashSprite*
+obj_icon_render(
+    struct GGame* game,
+    int obj_id,
+    int count,
+    int flags)
+{
+    // obj_id is already 0-indexed (caller subtracts 1 from stored value)
+
+    int resolved_id = obj_icon_resolve_count(game, obj_id, count);
+    if( resolved_id == -1 )
+    {
+        printf("obj_icon_get: Could not find obj %d in buildcachedat\n", obj_id);
+        return NULL;
+    }
+    if( resolved_id != obj_id )
+    {
+        // printf("  Using count variant: %d -> %d (count=%d)\n", obj_id, resolved_id, count);
+        return obj_icon_render(game, resolved_id, 1, flags);
+    }
+
+    // Get the object configuration
+    struct CacheDatConfigObj* obj = buildcachedat_get_obj(game->buildcachedat, obj_id);
 
     // Get or create the model for this object
     struct CacheModel* model = get_obj_inv_model(game, obj);
@@ -233,28 +250,31 @@ obj_icon_get(
     //     }
     // }
 
-    for( int x = 31; x >= 0; x-- )
+    if( flags & OBJ_ICON_OUTLINE )
     {
-        for( int y = 31; y >= 0; y-- )
+        for( int x = 31; x >= 0; x-- )
         {
-            if( icon->pixels_argb[x + y * 32] != 0 )
-                continue;
-
-            if( x > 0 && icon->pixels_argb[(x - 1) + y * 32] > 1 )
+            for( int y = 31; y >= 0; y-- )
             {
-                icon->pixels_argb[x + y * 32] = 1;
-            }
-            else if( y > 0 && icon->pixels_argb[x + (y - 1) * 32] > 1 )
-            {
-                icon->pixels_argb[x + y * 32] = 1;
-            }
-            else if( x < 31 && icon->pixels_argb[x + 1 + y * 32] > 1 )
-            {
-                icon->pixels_argb[x + y * 32] = 1;
-            }
-            else if( y < 31 && icon->pixels_argb[x + (y + 1) * 32] > 1 )
-            {
-                icon->pixels_argb[x + y * 32] = 1;
+                if( icon->pixels_argb[x + y * 32] != 0 )
+                    continue;
+
+                if( x > 0 && icon->pixels_argb[(x - 1) + y * 32] > 1 )
+                {
+                    icon->pixels_argb[x + y * 32] = 1;
+                }
+                else if( y > 0 && icon->pixels_argb[x + (y - 1) * 32] > 1 )
+                {
+                    icon->pixels_argb[x + y * 32] = 1;
+                }
+                else if( x < 31 && icon->pixels_argb[x + 1 + y * 32] > 1 )
+                {
+                    icon->pixels_argb[x + y * 32] = 1;
+                }
+                else if( y < 31 && icon->pixels_argb[x + (y + 1) * 32] > 1 )
+                {
+                    icon->pixels_argb[x + y * 32] = 1;
+                }
             }
         }
     }
@@ -262,14 +282,17 @@ obj_icon_get(
     // Shadow is drawn at bottom-right diagonal
 
     // draw shadow
-    for( int x = 31; x >= 0; x-- )
+    if( flags & OBJ_ICON_SHADOW )
     {
-        for( int y = 31; y >= 0; y-- )
+        for( int x = 31; x >= 0; x-- )
         {
-            if( icon->pixels_argb[x + y * 32] == 0 && x > 0 && y > 0 &&
-                icon->pixels_argb[(x - 1) + (y - 1) * 32] > 0 )
+            for( int y = 31; y >= 0; y-- )
             {
-                icon->pixels_argb[x + y * 32] = 1;
+                if( icon->pixels_argb[x + y * 32] == 0 && x > 0 && y > 0 &&
+                    icon->pixels_argb[(x - 1) + (y - 1) * 32] > 0 )
+                {
+                    icon->pixels_argb[x + y * 32] = 1;
+                }
             }
         }
     }
@@ -286,6 +309,15 @@ obj_icon_get(
     return icon;
 }
 
+struct DashSprite*
+obj_icon_get(
+    struct GGame* game,
+    int obj_id,
+    int count)
+{
+    return obj_icon_render(game, obj_id, count, OBJ_ICON_DEFAULT);
+}
+
 void
 head_model_render(
     struct GGame* game,
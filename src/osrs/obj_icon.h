@@ -4,9 +4,34 @@
 #include "graphics/dash.h"
 #include "osrs/game.h"
 
-// Generate a 32x32 sprite icon for an item
+enum ObjIconFlags
+{
+    OBJ_ICON_OUTLINE = 1 << 0,
+    OBJ_ICON_SHADOW = 1 << 1,
+    OBJ_ICON_DEFAULT = OBJ_ICON_OUTLINE | OBJ_ICON_SHADOW,
+};
+
+// Object id whose model is drawn for `count` of obj_id (countobj/countco stacks, e.g. coins).
+// Returns obj_id itself when no variant applies, -1 when obj_id is not loaded.
+int
+obj_icon_resolve_count(
+    struct GGame* game,
+    int obj_id,
+    int count);
+
+// Generate a 32x32 sprite icon for an item, outline and shadow drawn as selected by `flags`
+// (enum ObjIconFlags). The caller owns the sprite.
 // Based on ObjType.getIcon() from Client.ts
 struct DashSprite*
+obj_icon_render(
+    struct GGame* game,
+    int obj_id,
+    int count,
+    int flags);
+
+// obj_icon_render with OBJ_ICON_DEFAULT. The caller owns the sprite; per-frame callers should go
+// through obj_icon_cache_get (obj_icon_cache.h) instead.
+struct DashSprite*
 obj_icon_get(
     struct GGame* game,
     int obj_id,
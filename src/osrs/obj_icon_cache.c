@@ -0,0 +1,188 @@
+#include "obj_icon_cache.h"
+
+#include "graphics/dash_slot_lru.h"
+#include "obj_icon.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+struct ObjIconKey
+{
+    int32_t obj_id;
+    int32_t flags;
+};
+
+struct ObjIcon
+{
+    struct DashSprite* sprite;
+};
+
+struct ObjIconCache
+{
+    struct DashSlotLRU lru;
+    /** Indexed by LRU slot. */
+    struct ObjIcon* icons;
+    size_t bytes;
+
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+};
+
+static size_t
+objiconcache__sprite_bytes(const struct DashSprite* sprite)
+{
+    return sizeof(struct DashSprite) + (size_t)sprite->width * sprite->height * sizeof(int);
+}
+
+/** Frees the icon in slot; the slot itself stays with the LRU. */
+static void
+objiconcache__release(
+    struct ObjIconCache* cache,
+    int32_t slot)
+{
+    struct ObjIcon* icon = &cache->icons[slot];
+    cache->bytes -= objiconcache__sprite_bytes(icon->sprite);
+    dashsprite_free(icon->sprite);
+    icon->sprite = NULL;
+}
+
+static void
+objiconcache__release_all(struct ObjIconCache* cache)
+{
+    for( int32_t slot = cache->lru.head; slot != -1; slot = cache->lru.next[slot] )
+        objiconcache__release(cache, slot);
+}
+
+struct ObjIconCache*
+obj_icon_cache_new(int capacity)
+{
+    if( capacity <= 0 )
+        capacity = OBJ_ICON_CACHE_CAPACITY_DEFAULT;
+
+    struct ObjIconCache* cache = (struct ObjIconCache*)malloc(sizeof(struct ObjIconCache));
+    if( !cache )
+        return NULL;
+    memset(cache, 0, sizeof(struct ObjIconCache));
+
+    cache->icons = (struct ObjIcon*)calloc((size_t)capacity, sizeof(struct ObjIcon));
+    if( !cache->icons || !dashslotlru_init(&cache->lru, capacity, sizeof(struct ObjIconKey)) )
+    {
+        free(cache->icons);
+        free(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+void
+obj_icon_cache_clear(struct ObjIconCache* cache)
+{
+    if( !cache )
+        return;
+    objiconcache__release_all(cache);
+    dashslotlru_clear(&cache->lru);
+}
+
+void
+obj_icon_cache_free(struct ObjIconCache* cache)
+{
+    if( !cache )
+        return;
+    objiconcache__release_all(cache);
+    dashslotlru_fini(&cache->lru);
+    free(cache->icons);
+    free(cache);
+}
+
+void
+obj_icon_cache_invalidate(
+    struct ObjIconCache* cache,
+    int obj_id)
+{
+    if( !cache )
+        return;
+    int32_t slot = cache->lru.head;
+    while( slot != -1 )
+    {
+        int32_t next = cache->lru.next[slot];
+        const struct ObjIconKey* key =
+            (const struct ObjIconKey*)dashslotlru_key(&cache->lru, slot);
+        if( key->obj_id == obj_id )
+        {
+            objiconcache__release(cache, slot);
+            dashslotlru_remove(&cache->lru, slot);
+        }
+        slot = next;
+    }
+}
+
+static void
+objiconcache__store(
+    struct ObjIconCache* cache,
+    const struct ObjIconKey* key,
+    struct DashSprite* sprite)
+{
+    if( cache->lru.count >= cache->lru.capacity )
+    {
+        objiconcache__release(cache, cache->lru.tail);
+        dashslotlru_remove(&cache->lru, cache->lru.tail);
+        cache->evictions++;
+    }
+
+    int32_t slot = dashslotlru_insert(&cache->lru, key);
+    cache->icons[slot].sprite = sprite;
+    cache->bytes += objiconcache__sprite_bytes(sprite);
+}
+
+struct DashSprite*
+obj_icon_cache_get(
+    struct ObjIconCache* cache,
+    struct GGame* game,
+    int obj_id,
+    int count,
+    int flags)
+{
+    if( !cache )
+        return NULL;
+
+    int resolved_id = obj_icon_resolve_count(game, obj_id, count);
+    if( resolved_id == -1 )
+        return NULL;
+
+    struct ObjIconKey key;
+    memset(&key, 0, sizeof(key));
+    key.obj_id = resolved_id;
+    key.flags = flags;
+
+    int32_t slot = dashslotlru_find(&cache->lru, &key);
+    if( slot != -1 )
+    {
+        dashslotlru_touch(&cache->lru, slot);
+        cache->hits++;
+        return cache->icons[slot].sprite;
+    }
+
+    cache->misses++;
+    struct DashSprite* sprite = obj_icon_render(game, resolved_id, 1, flags);
+    if( !sprite )
+        return NULL;
+    objiconcache__store(cache, &key, sprite);
+    return sprite;
+}
+
+void
+obj_icon_cache_stats(
+    const struct ObjIconCache* cache,
+    struct ObjIconCacheStats* out)
+{
+    memset(out, 0, sizeof(*out));
+    if( !cache )
+        return;
+    out->hits = cache->hits;
+    out->misses = cache->misses;
+    out->evictions = cache->evictions;
+    out->count = cache->lru.count;
+    out->capacity = cache->lru.capacity;
+    out->bytes = cache->bytes;
+}
@@ -0,0 +1,64 @@
+#ifndef OBJ_ICON_CACHE_H
+#define OBJ_ICON_CACHE_H
+
+#include "graphics/dash.h"
+#include "osrs/game.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Bounded LRU of rendered 32x32 object icons, keyed by (obj id after count variants are resolved,
+ * enum ObjIconFlags). Inventory and bank interfaces draw the same icons every frame; a hit returns
+ * the cached sprite instead of copying, lighting, projecting and rasterizing the model again.
+ *
+ * Sprites are owned by the cache and stay valid until they are evicted, invalidated or the cache
+ * is cleared; callers blit them and must not keep or free them.
+ */
+struct ObjIconCache;
+
+struct ObjIconCacheStats
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    int count;
+    int capacity;
+    size_t bytes;
+};
+
+#define OBJ_ICON_CACHE_CAPACITY_DEFAULT 512
+
+struct ObjIconCache*
+obj_icon_cache_new(int capacity);
+
+void
+obj_icon_cache_free(struct ObjIconCache* cache);
+
+/** Drops every cached icon. Counters are kept. */
+void
+obj_icon_cache_clear(struct ObjIconCache* cache);
+
+/** Drops the icons rendered for obj_id (every flag combination), e.g. after its config or model
+ * changed. Count variants are cached under their own obj id. */
+void
+obj_icon_cache_invalidate(
+    struct ObjIconCache* cache,
+    int obj_id);
+
+/** Same icon as obj_icon_render(game, obj_id, count, flags), served from the cache when it was
+ * rendered before. NULL when the object cannot be rendered (not cached, so it is retried). */
+struct DashSprite*
+obj_icon_cache_get(
+    struct ObjIconCache* cache,
+    struct GGame* game,
+    int obj_id,
+    int count,
+    int flags);
+
+void
+obj_icon_cache_stats(
+    const struct ObjIconCache* cache,
+    struct ObjIconCacheStats* out);
+
+#endif
@@ -11,6 +11,7 @@ init_tile(struct OverlaymapTile* tile)
     tile->rgb_color = -1;
     tile->texture_id = -1;
     tile->texture_avg_hsl16 = -1;
+    tile->occlude = true;
 }
 
 static inline int
@@ -98,6 +99,18 @@ overlaymap_set_tile_texture(
     tile->texture_avg_hsl16 = texture_avg_hsl16;
 }
 
+void
+overlaymap_set_tile_occlude(
+    struct Overlaymap* overlaymap,
+    int x,
+    int z,
+    int level,
+    bool occlude)
+{
+    int idx = overlaymap_coord_idx(overlaymap, x, z, level);
+    overlaymap->tiles[idx].occlude = occlude;
+}
+
 struct OverlaymapTile*
 overlaymap_get_tile(
     struct Overlaymap* overlaymap,
@@ -11,6 +11,8 @@ struct OverlaymapTile
     uint32_t rgb_color;
     int16_t texture_id;
     uint16_t texture_avg_hsl16;
+    /* Floor may become a painter occluder (flo occlude, and not a bare shaped overlay). */
+    bool occlude;
 };
 
 struct Overlaymap
@@ -55,6 +57,14 @@ overlaymap_set_tile_texture(
     uint8_t texture_id,
     uint16_t texture_avg_hsl16);
 
+void
+overlaymap_set_tile_occlude(
+    struct Overlaymap* overlaymap,
+    int x,
+    int z,
+    int level,
+    bool occlude);
+
 struct OverlaymapTile*
 overlaymap_get_tile(
     struct Overlaymap* overlaymap,
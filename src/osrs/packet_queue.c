@@ -0,0 +1,144 @@
+#include "packet_queue.h"
+
+#include "gameproto_parse.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+void
+packet_queue_init(
+    struct PacketQueue* q,
+    int capacity)
+{
+    memset(q, 0, sizeof(*q));
+    if( capacity <= 0 )
+        capacity = PACKET_QUEUE_CAPACITY_DEFAULT;
+
+    q->slab = malloc(capacity * sizeof(struct RevPacket_LC245_2_Item));
+    q->ring = malloc(capacity * sizeof(struct RevPacket_LC245_2_Item*));
+    if( !q->slab || !q->ring )
+    {
+        free(q->slab);
+        free(q->ring);
+        q->slab = NULL;
+        q->ring = NULL;
+        return;
+    }
+    memset(q->slab, 0, capacity * sizeof(struct RevPacket_LC245_2_Item));
+    q->slab_capacity = capacity;
+    q->ring_capacity = capacity;
+
+    for( int i = capacity - 1; i >= 0; i-- )
+    {
+        q->slab[i].pool_nullable = q;
+        q->slab[i].next_nullable = q->free_list;
+        q->free_list = &q->slab[i];
+    }
+}
+
+void
+packet_queue_clear(struct PacketQueue* q)
+{
+    struct RevPacket_LC245_2_Item* item;
+    while( (item = packet_queue_pop(q)) )
+        packet_queue_release(item);
+
+    free(q->slab);
+    free(q->ring);
+    memset(q, 0, sizeof(*q));
+}
+
+static bool
+packet_queue_grow_ring(struct PacketQueue* q)
+{
+    int capacity = q->ring_capacity > 0 ? q->ring_capacity * 2 : PACKET_QUEUE_CAPACITY_DEFAULT;
+    struct RevPacket_LC245_2_Item** ring =
+        malloc(capacity * sizeof(struct RevPacket_LC245_2_Item*));
+    if( !ring )
+        return false;
+
+    for( int i = 0; i < q->count; i++ )
+        ring[i] = q->ring[(q->head + i) % q->ring_capacity];
+
+    free(q->ring);
+    q->ring = ring;
+    q->ring_capacity = capacity;
+    q->head = 0;
+    return true;
+}
+
+struct RevPacket_LC245_2_Item*
+packet_queue_push(
+    struct PacketQueue* q,
+    const struct RevPacket_LC245_2* packet)
+{
+    if( q->count == q->ring_capacity && !packet_queue_grow_ring(q) )
+        return NULL;
+
+    struct RevPacket_LC245_2_Item* item = q->free_list;
+    if( item )
+    {
+        q->free_list = item->next_nullable;
+    }
+    else
+    {
+        item = malloc(sizeof(struct RevPacket_LC245_2_Item));
+        if( !item )
+            return NULL;
+        item->pool_nullable = NULL;
+    }
+
+    item->packet = *packet;
+    item->next_nullable = NULL;
+
+    q->ring[(q->head + q->count) % q->ring_capacity] = item;
+    q->count++;
+    return item;
+}
+
+struct RevPacket_LC245_2_Item*
+packet_queue_peek(const struct PacketQueue* q)
+{
+    if( q->count == 0 )
+        return NULL;
+    return q->ring[q->head];
+}
+
+struct RevPacket_LC245_2_Item*
+packet_queue_pop(struct PacketQueue* q)
+{
+    if( q->count == 0 )
+        return NULL;
+
+    struct RevPacket_LC245_2_Item* item = q->ring[q->head];
+    q->head++;
+    if( q->head == q->ring_capacity )
+        q->head = 0;
+    q->count--;
+    return item;
+}
+
+int
+packet_queue_count(const struct PacketQueue* q)
+{
+    return q->count;
+}
+
+void
+packet_queue_release(struct RevPacket_LC245_2_Item* item)
+{
+    if( !item )
+        return;
+
+    gameproto_free_lc245_2_item(item);
+
+    struct PacketQueue* q = item->pool_nullable;
+    if( !q )
+    {
+        free(item);
+        return;
+    }
+
+    item->next_nullable = q->free_list;
+    q->free_list = item;
+}
@@ -0,0 +1,69 @@
+#ifndef OSRS_PACKET_QUEUE_H
+#define OSRS_PACKET_QUEUE_H
+
+#include "osrs/packets/revpacket_lc245_2.h"
+
+#include <stdbool.h>
+
+/** Slots in the packet slab; bursts past this fall back to heap items. */
+#ifndef PACKET_QUEUE_CAPACITY_DEFAULT
+#define PACKET_QUEUE_CAPACITY_DEFAULT 256
+#endif
+
+struct PacketQueue;
+
+struct RevPacket_LC245_2_Item
+{
+    struct RevPacket_LC245_2 packet;
+
+    /** Free-list link while the slot is unused. */
+    struct RevPacket_LC245_2_Item* next_nullable;
+    /** Queue whose slab holds this item; NULL for heap items (slab was exhausted). */
+    struct PacketQueue* pool_nullable;
+};
+
+/* FIFO of parsed incoming packets. Items come from a fixed slab with a free list and the FIFO is
+ * a ring of item pointers, so push/pop are O(1) and steady-state traffic does not allocate.
+ * Popped items stay valid until packet_queue_release (Lua packet scripts hold them across the
+ * script run). */
+struct PacketQueue
+{
+    struct RevPacket_LC245_2_Item* slab;
+    struct RevPacket_LC245_2_Item* free_list;
+    int slab_capacity;
+
+    struct RevPacket_LC245_2_Item** ring;
+    int ring_capacity;
+    int head;
+    int count;
+};
+
+void
+packet_queue_init(
+    struct PacketQueue* q,
+    int capacity);
+
+/** Release every queued packet and free the slab. Items popped earlier must be released first. */
+void
+packet_queue_clear(struct PacketQueue* q);
+
+/** Append a copy of `packet`; heap fields (payloads) move into the item. */
+struct RevPacket_LC245_2_Item*
+packet_queue_push(
+    struct PacketQueue* q,
+    const struct RevPacket_LC245_2* packet);
+
+struct RevPacket_LC245_2_Item*
+packet_queue_peek(const struct PacketQueue* q);
+
+struct RevPacket_LC245_2_Item*
+packet_queue_pop(struct PacketQueue* q);
+
+int
+packet_queue_count(const struct PacketQueue* q);
+
+/** Free the packet's heap fields and return the item to its slab (or the heap). */
+void
+packet_queue_release(struct RevPacket_LC245_2_Item* item);
+
+#endif
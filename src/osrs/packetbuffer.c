@@ -187,6 +187,14 @@ packetbuffer_data(struct PacketBuffer* packetbuffer)
     return packetbuffer->data;
 }
 
+void*
+packetbuffer_detach_data(struct PacketBuffer* packetbuffer)
+{
+    void* data = packetbuffer->data;
+    packetbuffer->data = NULL;
+    return data;
+}
+
 int
 packetbuffer_amt_recv_cnt(struct PacketBuffer* packetbuffer)
 {
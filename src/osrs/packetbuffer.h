@@ -52,6 +52,9 @@ int
 packetbuffer_packet_type(struct PacketBuffer* packetbuffer);
 void*
 packetbuffer_data(struct PacketBuffer* packetbuffer);
+/** Take ownership of the payload (free() it); the next reset will not free it. */
+void*
+packetbuffer_detach_data(struct PacketBuffer* packetbuffer);
 
 int
 packetbuffer_amt_recv_cnt(struct PacketBuffer* packetbuffer);
@@ -129,6 +129,8 @@ static int
 distmetric_ctx_init(struct Painter* painter);
 static void
 distmetric_ctx_free(struct Painter* painter);
+static void
+painter_occlude_free(struct Painter* painter);
 
 static struct Painter* s_scenery_sort_painter;
 static int s_scenery_sort_camera_sx;
@@ -597,6 +599,7 @@ painter_free(struct Painter* painter)
     bucket_ctx_free(painter);
     w3d_ctx_free(painter);
     distmetric_ctx_free(painter);
+    painter_occlude_free(painter);
     free(painter);
 }
 
@@ -1033,6 +1036,16 @@ push_command_entity(
     };
 }
 
+/* Walls are large and opaque, so the command is flagged as an occlusion-culling occluder. */
+static inline void
+push_command_wall(
+    struct PaintersBuffer* buffer,
+    int entity)
+{
+    push_command_entity(buffer, entity);
+    buffer->commands[buffer->command_count - 1]._entity._bf_occluder = 1;
+}
+
 static inline void
 push_command_terrain(
     struct PaintersBuffer* buffer,
@@ -1105,6 +1118,7 @@ int g_trap_z = -1;
 
 // clang-format off
 #include "painter_tile_iter.u.c"
+#include "painters_occlude.u.c"
 #include "painters_bucket.u.c"
 #include "painters_world3d.u.c"
 #include "painters_distancemetric.u.c"
@@ -277,6 +277,9 @@ struct PaintersElement
     uint16_t sx;
     uint16_t sz;
     uint8_t slevel;
+    /* Model height above the element's tiles, sampled by the occluder test. 0 = never occluded
+     * (dynamic entities, animated locs). */
+    uint16_t occlude_height;
 
     union
     {
@@ -305,6 +308,7 @@ enum PaintersCommandKind
 // Entity:
 // - 4  bits: kind = 1, CMD = Entity
 // - 16 bits: world entity idx.
+// - 1  bit:  occluder (walls; the frame rasterizes these into its coverage buffer).
 // Terrain:
 // - 4  bits: kind = 2, CMD = Terrain
 // - 16 bits: terrain x,y,z. (9 bits each)
@@ -323,6 +327,7 @@ struct PaintersElementCommand
         {
             uint32_t _bf_kind : 4;
             uint32_t _bf_entity : 16;
+            uint32_t _bf_occluder : 1;
         } _entity;
 
         struct
@@ -339,6 +344,8 @@ struct Painter;
 
 struct PaintersCullMap;
 
+struct Heightmap;
+
 /** Build cullmap at runtime (CPU bake). */
 struct PaintersCullMap*
 painters_cullmap_build(
@@ -385,6 +392,47 @@ painter_set_level_range(
     int lo,
     int hi);
 
+/**
+ * Occluder marks (docs/OCCLUDER_SYSTEM.md). Three bits per top level: wall in the constant-x
+ * plane at the tile's west edge, wall in the constant-z plane at its south edge, and a flat
+ * floor/roof covering the tile. The constants set the bit for every top level.
+ */
+#define PAINTERS_OCCLUDE_WALL_X 0x249
+#define PAINTERS_OCCLUDE_WALL_Z 0x492
+#define PAINTERS_OCCLUDE_FLOOR 0x924
+
+/** OR occluder bits into (sx, sz, slevel). sx/sz may be width/height (east/north edge walls). */
+void
+painter_occlude_mark(
+    struct Painter* painter,
+    int sx,
+    int sz,
+    int slevel,
+    int bits);
+
+/**
+ * Merge the marked tiles into wall and floor occluders and free the marks. Call once the
+ * heightmap is final; the painter keeps the heightmap pointer for the per-frame tests.
+ */
+void
+painter_build_occluders(
+    struct Painter* painter,
+    struct Heightmap* heightmap);
+
+/** Camera eye in scene units (y negative-up). Occluders are skipped until this is set. */
+void
+painter_set_camera_position(
+    struct Painter* painter,
+    int x,
+    int y,
+    int z);
+
+void
+painter_set_element_occlude_height(
+    struct Painter* painter,
+    int element,
+    int height);
+
 /** Bitmask: which scratch contexts painter_new allocates up front (see painters_bucket / world3d /
  * distancemetric). */
 enum PainterNewContextFlags
@@ -166,6 +166,7 @@ painter_paint_bucket(
         return 0;
 
     painter_cullmap_refresh_camera_key(painter);
+    painter_occlude_begin_frame(painter, camera_sx, camera_sz, draw_mask);
 
     painter_clear_tile_paints_region(
         painter, min_draw_x, max_draw_x, min_draw_z, max_draw_z, max_level);
@@ -243,6 +244,7 @@ painter_paint_bucket(
         int tile_sz = tile->sz;
         int grid_level = painters_tile_get_grid_level(tile);
         int tile_slevel = painters_tile_get_slevel(tile);
+        int terrain_level = painters_tile_get_terrain_level(tile);
 
         if( tile_paint->step == PAINT_STEP_DONE )
             continue;
@@ -366,7 +368,7 @@ painter_paint_bucket(
                 {
                     element = &painter->elements[bridge_underpass_tile->wall_a];
                     assert(element->kind == PNTRELEM_WALL_A);
-                    push_command_entity(buffer, element->_wall.entity);
+                    push_command_wall(buffer, element->_wall.entity);
                 }
 
                 for( int32_t sn = bridge_underpass_tile->scenery_head; sn != -1;
@@ -385,36 +387,45 @@ painter_paint_bucket(
                 }
             }
 
-            push_command_terrain(buffer, tile_sx, tile_sz, painters_tile_get_terrain_level(tile));
+            if( !painter_occlude_tile_hidden(painter, e_tile, tile_sx, tile_sz, terrain_level) )
+                push_command_terrain(buffer, tile_sx, tile_sz, terrain_level);
 
             if( tile->wall_a != -1 )
             {
                 element = &painter->elements[tile->wall_a];
                 assert(element->kind == PNTRELEM_WALL_A);
-                if( (element->_wall.side & far_walls) != 0 )
-                    push_command_entity(buffer, element->_wall.entity);
+                if( (element->_wall.side & far_walls) != 0 &&
+                    !painter_occlude_wall_hidden(
+                        painter, e_tile, tile_sx, tile_sz, terrain_level, element->_wall.side) )
+                    push_command_wall(buffer, element->_wall.entity);
             }
 
             if( tile->wall_b != -1 )
             {
                 element = &painter->elements[tile->wall_b];
                 assert(element->kind == PNTRELEM_WALL_B);
-                if( (element->_wall.side & far_walls) != 0 )
-                    push_command_entity(buffer, element->_wall.entity);
+                if( (element->_wall.side & far_walls) != 0 &&
+                    !painter_occlude_wall_hidden(
+                        painter, e_tile, tile_sx, tile_sz, terrain_level, element->_wall.side) )
+                    push_command_wall(buffer, element->_wall.entity);
             }
 
             if( tile->ground_decor != -1 )
             {
                 element = &painter->elements[tile->ground_decor];
                 assert(element->kind == PNTRELEM_GROUND_DECOR);
-                push_command_entity(buffer, element->_ground_decor.entity);
+                if( !painter_occlude_column_hidden(
+                        painter, e_tile, tile_sx, tile_sz, terrain_level, element->occlude_height) )
+                    push_command_entity(buffer, element->_ground_decor.entity);
             }
 
             if( tile->ground_object_bottom != -1 )
             {
                 element = &painter->elements[tile->ground_object_bottom];
                 assert(element->kind == PNTRELEM_GROUND_OBJECT);
-                push_command_entity(buffer, element->_ground_object.entity);
+                if( !painter_occlude_column_hidden(
+                        painter, e_tile, tile_sx, tile_sz, terrain_level, element->occlude_height) )
+                    push_command_entity(buffer, element->_ground_object.entity);
             }
 
             if( tile->wall_decor_a != -1 )
@@ -445,7 +456,15 @@ painter_paint_bucket(
                         push_command_entity(buffer, element->_wall_decor.entity);
                     }
                 }
-                else if( (element->_wall_decor._bf_side & far_walls) != 0 )
+                else if(
+                    (element->_wall_decor._bf_side & far_walls) != 0 &&
+                    !painter_occlude_wall_hidden(
+                        painter,
+                        e_tile,
+                        tile_sx,
+                        tile_sz,
+                        terrain_level,
+                        element->_wall_decor._bf_side) )
                 {
                     push_command_entity(buffer, element->_wall_decor.entity);
                 }
@@ -527,7 +546,6 @@ painter_paint_bucket(
 
             element = &painter->elements[si];
             assert(element->kind == PNTRELEM_SCENERY);
-            push_command_entity(buffer, element->_scenery.entity);
 
             int el_slevel = (int)element->slevel;
             int min_tile_x = (int)element->sx;
@@ -544,6 +562,11 @@ painter_paint_bucket(
             if( min_tile_z < min_draw_z )
                 min_tile_z = min_draw_z;
 
+            /* Hidden scenery still releases the tiles it spans. */
+            if( !painter_occlude_scenery_hidden(
+                    painter, element, min_tile_x, max_tile_x, min_tile_z, max_tile_z) )
+                push_command_entity(buffer, element->_scenery.entity);
+
             if( min_tile_x <= max_tile_x && min_tile_z <= max_tile_z )
             {
                 for( int ox = min_tile_x; ox <= max_tile_x; ox++ )
@@ -603,7 +626,15 @@ painter_paint_bucket(
                     push_command_entity(buffer, element->_wall_decor.entity);
                 }
             }
-            else if( (element->_wall_decor._bf_side & tile_paint->near_wall_flags) != 0 )
+            else if(
+                (element->_wall_decor._bf_side & tile_paint->near_wall_flags) != 0 &&
+                !painter_occlude_wall_hidden(
+                    painter,
+                    e_tile,
+                    tile_sx,
+                    tile_sz,
+                    terrain_level,
+                    element->_wall_decor._bf_side) )
             {
                 push_command_entity(buffer, element->_wall_decor.entity);
             }
@@ -613,16 +644,20 @@ painter_paint_bucket(
         {
             element = &painter->elements[tile->wall_a];
             assert(element->kind == PNTRELEM_WALL_A);
-            if( (element->_wall.side & tile_paint->near_wall_flags) != 0 )
-                push_command_entity(buffer, element->_wall.entity);
+            if( (element->_wall.side & tile_paint->near_wall_flags) != 0 &&
+                !painter_occlude_wall_hidden(
+                    painter, e_tile, tile_sx, tile_sz, terrain_level, element->_wall.side) )
+                push_command_wall(buffer, element->_wall.entity);
         }
 
         if( tile->wall_b != -1 )
         {
             element = &painter->elements[tile->wall_b];
             assert(element->kind == PNTRELEM_WALL_B);
-            if( (element->_wall.side & tile_paint->near_wall_flags) != 0 )
-                push_command_entity(buffer, element->_wall.entity);
+            if( (element->_wall.side & tile_paint->near_wall_flags) != 0 &&
+                !painter_occlude_wall_hidden(
+                    painter, e_tile, tile_sx, tile_sz, terrain_level, element->_wall.side) )
+                push_command_wall(buffer, element->_wall.entity);
         }
 
         tile_paint->step = PAINT_STEP_DONE;
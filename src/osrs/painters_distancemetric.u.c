@@ -473,7 +473,7 @@ painter_paint_distancemetric(
                 {
                     element = &painter->elements[bridge_underpass_tile->wall_a];
                     assert(element->kind == PNTRELEM_WALL_A);
-                    push_command_entity(buffer, element->_wall.entity);
+                    push_command_wall(buffer, element->_wall.entity);
                 }
 
                 for( int32_t sn = bridge_underpass_tile->scenery_head; sn != -1;
@@ -500,7 +500,7 @@ painter_paint_distancemetric(
                 assert(element->kind == PNTRELEM_WALL_A);
 
                 if( (element->_wall.side & far_walls) != 0 )
-                    push_command_entity(buffer, element->_wall.entity);
+                    push_command_wall(buffer, element->_wall.entity);
             }
 
             if( tile->wall_b != -1 )
@@ -509,7 +509,7 @@ painter_paint_distancemetric(
                 assert(element->kind == PNTRELEM_WALL_B);
 
                 if( (element->_wall.side & far_walls) != 0 )
-                    push_command_entity(buffer, element->_wall.entity);
+                    push_command_wall(buffer, element->_wall.entity);
             }
 
             if( tile->ground_decor != -1 )
@@ -867,7 +867,7 @@ painter_paint_distancemetric(
                 assert(element->kind == PNTRELEM_WALL_A);
 
                 if( (element->_wall.side & tile_paint->near_wall_flags) != 0 )
-                    push_command_entity(buffer, element->_wall.entity);
+                    push_command_wall(buffer, element->_wall.entity);
             }
 
             if( tile->wall_b != -1 )
@@ -876,7 +876,7 @@ painter_paint_distancemetric(
                 assert(element->kind == PNTRELEM_WALL_B);
 
                 if( (element->_wall.side & tile_paint->near_wall_flags) != 0 )
-                    push_command_entity(buffer, element->_wall.entity);
+                    push_command_wall(buffer, element->_wall.entity);
             }
 
             tile_paint->step = PAINT_STEP_DONE;
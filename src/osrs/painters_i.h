@@ -35,6 +35,60 @@ struct ElementPaint
     uint8_t drawn;
 };
 
+enum PaintersOccluderType
+{
+    /* Wall in a constant-x plane, spanning z and one or more levels. */
+    PAINTERS_OCCLUDER_WALL_X = 1,
+    /* Wall in a constant-z plane, spanning x and one or more levels. */
+    PAINTERS_OCCLUDER_WALL_Z = 2,
+    /* Flat floor or roof in a constant-y plane. */
+    PAINTERS_OCCLUDER_FLOOR = 4,
+};
+
+/* Which side of the occluder the camera is on this frame; points on the other side are tested. */
+enum PaintersOccluderMode
+{
+    PAINTERS_OCCLUDER_MODE_NONE = 0,
+    PAINTERS_OCCLUDER_MODE_CAMERA_EAST,
+    PAINTERS_OCCLUDER_MODE_CAMERA_WEST,
+    PAINTERS_OCCLUDER_MODE_CAMERA_NORTH,
+    PAINTERS_OCCLUDER_MODE_CAMERA_SOUTH,
+    PAINTERS_OCCLUDER_MODE_CAMERA_ABOVE,
+};
+
+/**
+ * Axis-aligned occluding plane built from painter_occlude_mark runs (painters_occlude.u.c).
+ * Bounds are in scene units; y is negative-up, so min_y is the top edge. The deltas are the
+ * per-frame 8.8 slopes from the camera through the plane edges.
+ */
+struct PaintersOccluder
+{
+    uint8_t type;
+    uint8_t mode;
+
+    int16_t min_tile_x;
+    int16_t max_tile_x;
+    int16_t min_tile_z;
+    int16_t max_tile_z;
+
+    int min_x;
+    int max_x;
+    int min_y;
+    int max_y;
+    int min_z;
+    int max_z;
+
+    int min_delta_x;
+    int max_delta_x;
+    int min_delta_y;
+    int max_delta_y;
+    int min_delta_z;
+    int max_delta_z;
+};
+
+/* The mark bitfield has 3 bits per top level in a uint16_t. */
+#define PAINTERS_OCCLUDE_LEVELS 4
+
 struct Painter
 {
     int width;
@@ -71,6 +125,26 @@ struct Painter
     void* bucket_ctx;
     void* w3d_ctx;
     void* distmetric_ctx;
+
+    /** Build-only occluder marks, (width + 1) * (height + 1) * levels; freed by the build. */
+    uint16_t* occlude_marks;
+    /** Owned by the world; heights for occluder bounds and per-frame tests. */
+    struct Heightmap* heightmap;
+    struct PaintersOccluder* occluders;
+    int occluder_count;
+    /** Occluders for top level t are [occluder_level_start[t], occluder_level_start[t + 1]). */
+    int occluder_level_start[PAINTERS_OCCLUDE_LEVELS + 1];
+    int* active_occluders;
+    int active_occluder_count;
+    /** Per tile: +cycle visible, -cycle occluded this frame (tile_capacity entries). */
+    int32_t* occlude_tile_cycles;
+    int32_t occlude_cycle;
+
+    /** Camera eye in scene units (painter_set_camera_position); occluders need it. */
+    int camera_x;
+    int camera_y;
+    int camera_z;
+    bool camera_position_set;
 };
 
 /**
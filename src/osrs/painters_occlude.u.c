@@ -0,0 +1,811 @@
+#ifndef PAINTERS_OCCLUDE_U_C
+#define PAINTERS_OCCLUDE_U_C
+
+#include "heightmap.h"
+#include "painters_i.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * CPU occluders, after the reference client (docs/OCCLUDER_SYSTEM.md).
+ *
+ * World build ORs wall/roof/floor bits into occlude_marks; painter_build_occluders merges runs
+ * of marked tiles into axis-aligned planes. Each paint activates the planes that face the camera
+ * and painter_paint_bucket drops terrain, walls and elements whose sample points all project
+ * behind one of them. Tile traversal is unchanged; only commands are skipped.
+ */
+
+/* Uncomment to build occluders but never test against them. */
+// #define DISABLE_OCCLUDERS 1
+
+/* Occluders must overlap this many tiles around the camera (the bucket paint radius). */
+#define OCCLUDE_RADIUS 25
+/* The camera must be this far (scene units) in front of a wall plane to use it. */
+#define OCCLUDE_WALL_MIN_DISTANCE 32
+/* The camera must be this far above a floor plane to use it. */
+#define OCCLUDE_FLOOR_MIN_DISTANCE 128
+#define OCCLUDE_WALL_MIN_AREA 8
+#define OCCLUDE_FLOOR_MIN_AREA 4
+/* Wall occluders top out one storey below the ground of their highest level. */
+#define OCCLUDE_WALL_HEIGHT 240
+
+/* Wall side sample heights above the ground: mid storey, wall top, just under the top. */
+#define OCCLUDE_WALL_SAMPLE_MID 120
+#define OCCLUDE_WALL_SAMPLE_TOP 230
+#define OCCLUDE_WALL_SAMPLE_CORNER 238
+
+static inline int
+occlude_mark_idx(
+    const struct Painter* painter,
+    int x,
+    int z,
+    int level)
+{
+    int stride_x = painter->width + 1;
+    int stride_level = stride_x * (painter->height + 1);
+    return x + z * stride_x + level * stride_level;
+}
+
+void
+painter_occlude_mark(
+    struct Painter* painter,
+    int sx,
+    int sz,
+    int slevel,
+    int bits)
+{
+    if( !painter )
+        return;
+    if( sx < 0 || sz < 0 || sx > painter->width || sz > painter->height || slevel < 0 ||
+        slevel >= painter->levels || slevel >= PAINTERS_OCCLUDE_LEVELS )
+        return;
+
+    if( !painter->occlude_marks )
+    {
+        size_t count = (size_t)(painter->width + 1) * (size_t)(painter->height + 1) *
+                       (size_t)painter->levels;
+        painter->occlude_marks = (uint16_t*)calloc(count, sizeof(uint16_t));
+        if( !painter->occlude_marks )
+            return;
+    }
+
+    painter->occlude_marks[occlude_mark_idx(painter, sx, sz, slevel)] |= (uint16_t)bits;
+}
+
+void
+painter_set_camera_position(
+    struct Painter* painter,
+    int x,
+    int y,
+    int z)
+{
+    if( !painter )
+        return;
+    painter->camera_x = x;
+    painter->camera_y = y;
+    painter->camera_z = z;
+    painter->camera_position_set = true;
+}
+
+void
+painter_set_element_occlude_height(
+    struct Painter* painter,
+    int element,
+    int height)
+{
+    if( !painter || element < 0 || element >= painter->element_count )
+        return;
+    if( height < 0 )
+        height = 0;
+    if( height > UINT16_MAX )
+        height = UINT16_MAX;
+    painter->elements[element].occlude_height = (uint16_t)height;
+}
+
+/* ---- Build ---- */
+
+static bool
+occlude_marked_run_z(
+    const struct Painter* painter,
+    int level,
+    int x,
+    int min_z,
+    int max_z,
+    uint16_t bit)
+{
+    for( int z = min_z; z <= max_z; z++ )
+    {
+        if( (painter->occlude_marks[occlude_mark_idx(painter, x, z, level)] & bit) == 0 )
+            return false;
+    }
+    return true;
+}
+
+static bool
+occlude_marked_run_x(
+    const struct Painter* painter,
+    int level,
+    int z,
+    int min_x,
+    int max_x,
+    uint16_t bit)
+{
+    for( int x = min_x; x <= max_x; x++ )
+    {
+        if( (painter->occlude_marks[occlude_mark_idx(painter, x, z, level)] & bit) == 0 )
+            return false;
+    }
+    return true;
+}
+
+static void
+occlude_clear_marks(
+    struct Painter* painter,
+    int min_level,
+    int max_level,
+    int min_x,
+    int max_x,
+    int min_z,
+    int max_z,
+    uint16_t bit)
+{
+    for( int level = min_level; level <= max_level; level++ )
+        for( int z = min_z; z <= max_z; z++ )
+            for( int x = min_x; x <= max_x; x++ )
+                painter->occlude_marks[occlude_mark_idx(painter, x, z, level)] &= (uint16_t)~bit;
+}
+
+static void
+occlude_push(
+    struct Painter* painter,
+    int* capacity,
+    const struct PaintersOccluder* occluder)
+{
+    if( painter->occluder_count >= *capacity )
+    {
+        int new_capacity = *capacity ? *capacity * 2 : 64;
+        struct PaintersOccluder* occluders = (struct PaintersOccluder*)realloc(
+            painter->occluders, (size_t)new_capacity * sizeof(struct PaintersOccluder));
+        if( !occluders )
+            return;
+        painter->occluders = occluders;
+        *capacity = new_capacity;
+    }
+    painter->occluders[painter->occluder_count++] = *occluder;
+}
+
+static void
+occlude_set_y(
+    struct PaintersOccluder* occluder,
+    int y_a,
+    int y_b)
+{
+    occluder->min_y = y_a < y_b ? y_a : y_b;
+    occluder->max_y = y_a < y_b ? y_b : y_a;
+}
+
+/* Grow a constant-x wall along z, then across levels up to top_level. */
+static void
+occlude_build_wall_x(
+    struct Painter* painter,
+    int* capacity,
+    int top_level,
+    int level,
+    int x,
+    int z,
+    uint16_t bit)
+{
+    int min_z = z;
+    int max_z = z;
+    int min_level = level;
+    int max_level = level;
+
+    while( min_z > 0 && occlude_marked_run_z(painter, level, x, min_z - 1, min_z - 1, bit) )
+        min_z--;
+    while( max_z < painter->height &&
+           occlude_marked_run_z(painter, level, x, max_z + 1, max_z + 1, bit) )
+        max_z++;
+    while( min_level > 0 && occlude_marked_run_z(painter, min_level - 1, x, min_z, max_z, bit) )
+        min_level--;
+    while( max_level < top_level &&
+           occlude_marked_run_z(painter, max_level + 1, x, min_z, max_z, bit) )
+        max_level++;
+
+    int area = (max_level + 1 - min_level) * (max_z + 1 - min_z);
+    if( area < OCCLUDE_WALL_MIN_AREA )
+        return;
+
+    struct PaintersOccluder occluder = { 0 };
+    occluder.type = PAINTERS_OCCLUDER_WALL_X;
+    occluder.min_tile_x = (int16_t)x;
+    occluder.max_tile_x = (int16_t)x;
+    occluder.min_tile_z = (int16_t)min_z;
+    occluder.max_tile_z = (int16_t)max_z;
+    occluder.min_x = x * 128;
+    occluder.max_x = x * 128;
+    occluder.min_z = min_z * 128;
+    occluder.max_z = max_z * 128 + 128;
+    occlude_set_y(
+        &occluder,
+        heightmap_get(painter->heightmap, x, min_z, min_level),
+        heightmap_get(painter->heightmap, x, min_z, max_level) - OCCLUDE_WALL_HEIGHT);
+    occlude_push(painter, capacity, &occluder);
+
+    occlude_clear_marks(painter, min_level, max_level, x, x, min_z, max_z, bit);
+}
+
+/* Grow a constant-z wall along x, then across levels up to top_level. */
+static void
+occlude_build_wall_z(
+    struct Painter* painter,
+    int* capacity,
+    int top_level,
+    int level,
+    int x,
+    int z,
+    uint16_t bit)
+{
+    int min_x = x;
+    int max_x = x;
+    int min_level = level;
+    int max_level = level;
+
+    while( min_x > 0 && occlude_marked_run_x(painter, level, z, min_x - 1, min_x - 1, bit) )
+        min_x--;
+    while( max_x < painter->width &&
+           occlude_marked_run_x(painter, level, z, max_x + 1, max_x + 1, bit) )
+        max_x++;
+    while( min_level > 0 && occlude_marked_run_x(painter, min_level - 1, z, min_x, max_x, bit) )
+        min_level--;
+    while( max_level < top_level &&
+           occlude_marked_run_x(painter, max_level + 1, z, min_x, max_x, bit) )
+        max_level++;
+
+    int area = (max_level + 1 - min_level) * (max_x + 1 - min_x);
+    if( area < OCCLUDE_WALL_MIN_AREA )
+        return;
+
+    struct PaintersOccluder occluder = { 0 };
+    occluder.type = PAINTERS_OCCLUDER_WALL_Z;
+    occluder.min_tile_x = (int16_t)min_x;
+    occluder.max_tile_x = (int16_t)max_x;
+    occluder.min_tile_z = (int16_t)z;
+    occluder.max_tile_z = (int16_t)z;
+    occluder.min_x = min_x * 128;
+    occluder.max_x = max_x * 128 + 128;
+    occluder.min_z = z * 128;
+    occluder.max_z = z * 128;
+    occlude_set_y(
+        &occluder,
+        heightmap_get(painter->heightmap, min_x, z, min_level),
+        heightmap_get(painter->heightmap, min_x, z, max_level) - OCCLUDE_WALL_HEIGHT);
+    occlude_push(painter, capacity, &occluder);
+
+    occlude_clear_marks(painter, min_level, max_level, min_x, max_x, z, z, bit);
+}
+
+/* Grow a floor along z, then along x, on a single level. */
+static void
+occlude_build_floor(
+    struct Painter* painter,
+    int* capacity,
+    int level,
+    int x,
+    int z,
+    uint16_t bit)
+{
+    int min_x = x;
+    int max_x = x;
+    int min_z = z;
+    int max_z = z;
+
+    while( min_z > 0 && occlude_marked_run_z(painter, level, x, min_z - 1, min_z - 1, bit) )
+        min_z--;
+    while( max_z < painter->height &&
+           occlude_marked_run_z(painter, level, x, max_z + 1, max_z + 1, bit) )
+        max_z++;
+    while( min_x > 0 && occlude_marked_run_z(painter, level, min_x - 1, min_z, max_z, bit) )
+        min_x--;
+    while( max_x < painter->width &&
+           occlude_marked_run_z(painter, level, max_x + 1, min_z, max_z, bit) )
+        max_x++;
+
+    int area = (max_x + 1 - min_x) * (max_z + 1 - min_z);
+    if( area < OCCLUDE_FLOOR_MIN_AREA )
+        return;
+
+    int y = heightmap_get(painter->heightmap, min_x, min_z, level);
+
+    struct PaintersOccluder occluder = { 0 };
+    occluder.type = PAINTERS_OCCLUDER_FLOOR;
+    occluder.min_tile_x = (int16_t)min_x;
+    occluder.max_tile_x = (int16_t)max_x;
+    occluder.min_tile_z = (int16_t)min_z;
+    occluder.max_tile_z = (int16_t)max_z;
+    occluder.min_x = min_x * 128;
+    occluder.max_x = max_x * 128 + 128;
+    occluder.min_z = min_z * 128;
+    occluder.max_z = max_z * 128 + 128;
+    occluder.min_y = y;
+    occluder.max_y = y;
+    occlude_push(painter, capacity, &occluder);
+
+    occlude_clear_marks(painter, level, level, min_x, max_x, min_z, max_z, bit);
+}
+
+void
+painter_build_occluders(
+    struct Painter* painter,
+    struct Heightmap* heightmap)
+{
+    if( !painter )
+        return;
+
+    painter->heightmap = heightmap;
+    painter->occluder_count = 0;
+    painter->active_occluder_count = 0;
+    memset(painter->occluder_level_start, 0, sizeof(painter->occluder_level_start));
+
+    int levels = painter->levels < PAINTERS_OCCLUDE_LEVELS ? painter->levels
+                                                           : PAINTERS_OCCLUDE_LEVELS;
+    int capacity = 0;
+    free(painter->occluders);
+    painter->occluders = NULL;
+
+    if( painter->occlude_marks && heightmap )
+    {
+        for( int top_level = 0; top_level < levels; top_level++ )
+        {
+            painter->occluder_level_start[top_level] = painter->occluder_count;
+
+            uint16_t wall_x_bit = (uint16_t)(0x1u << (top_level * 3));
+            uint16_t wall_z_bit = (uint16_t)(0x2u << (top_level * 3));
+            uint16_t floor_bit = (uint16_t)(0x4u << (top_level * 3));
+
+            for( int level = 0; level <= top_level; level++ )
+            {
+                for( int z = 0; z <= painter->height; z++ )
+                {
+                    for( int x = 0; x <= painter->width; x++ )
+                    {
+                        uint16_t* mark =
+                            &painter->occlude_marks[occlude_mark_idx(painter, x, z, level)];
+                        if( *mark & wall_x_bit )
+                            occlude_build_wall_x(
+                                painter, &capacity, top_level, level, x, z, wall_x_bit);
+                        if( *mark & wall_z_bit )
+                            occlude_build_wall_z(
+                                painter, &capacity, top_level, level, x, z, wall_z_bit);
+                        if( *mark & floor_bit )
+                            occlude_build_floor(painter, &capacity, level, x, z, floor_bit);
+                    }
+                }
+            }
+        }
+    }
+    for( int t = levels; t <= PAINTERS_OCCLUDE_LEVELS; t++ )
+        painter->occluder_level_start[t] = painter->occluder_count;
+
+    free(painter->occlude_marks);
+    painter->occlude_marks = NULL;
+
+    free(painter->active_occluders);
+    painter->active_occluders = NULL;
+    if( painter->occluder_count > 0 )
+        painter->active_occluders = (int*)malloc((size_t)painter->occluder_count * sizeof(int));
+
+    if( !painter->occlude_tile_cycles )
+        painter->occlude_tile_cycles =
+            (int32_t*)calloc((size_t)painter->tile_capacity, sizeof(int32_t));
+    painter->occlude_cycle = 0;
+}
+
+static void
+painter_occlude_free(struct Painter* painter)
+{
+    free(painter->occlude_marks);
+    free(painter->occluders);
+    free(painter->active_occluders);
+    free(painter->occlude_tile_cycles);
+    painter->occlude_marks = NULL;
+    painter->occluders = NULL;
+    painter->active_occluders = NULL;
+    painter->occlude_tile_cycles = NULL;
+    painter->occluder_count = 0;
+    painter->active_occluder_count = 0;
+}
+
+/* ---- Per frame ---- */
+
+static inline bool
+occlude_tile_range_near(
+    int min_tile,
+    int max_tile,
+    int camera_tile)
+{
+    return max_tile >= camera_tile - OCCLUDE_RADIUS && min_tile <= camera_tile + OCCLUDE_RADIUS;
+}
+
+/**
+ * Pick the occluders of the highest drawn level that lie around the camera and face it, and
+ * precompute their edge slopes. Resets active_occluder_count to 0 when occlusion can't run.
+ */
+static void
+painter_occlude_begin_frame(
+    struct Painter* painter,
+    int camera_sx,
+    int camera_sz,
+    uint8_t draw_mask)
+{
+    painter->active_occluder_count = 0;
+
+#ifdef DISABLE_OCCLUDERS
+    (void)camera_sx;
+    (void)camera_sz;
+    (void)draw_mask;
+    return;
+#else
+    if( !painter->camera_position_set || !painter->heightmap || !painter->active_occluders ||
+        !painter->occlude_tile_cycles || painter->occluder_count == 0 )
+        return;
+
+    int top_level = -1;
+    for( int l = 0; l < PAINTERS_OCCLUDE_LEVELS; l++ )
+    {
+        if( draw_mask & (1u << l) )
+            top_level = l;
+    }
+    if( top_level < 0 || top_level >= painter->levels )
+        return;
+
+    painter->occlude_cycle++;
+    if( painter->occlude_cycle == INT32_MAX )
+    {
+        memset(
+            painter->occlude_tile_cycles, 0, (size_t)painter->tile_capacity * sizeof(int32_t));
+        painter->occlude_cycle = 1;
+    }
+
+    int eye_x = painter->camera_x;
+    int eye_y = painter->camera_y;
+    int eye_z = painter->camera_z;
+
+    int first = painter->occluder_level_start[top_level];
+    int last = painter->occluder_level_start[top_level + 1];
+    for( int i = first; i < last; i++ )
+    {
+        struct PaintersOccluder* occluder = &painter->occluders[i];
+        if( !occlude_tile_range_near(occluder->min_tile_x, occluder->max_tile_x, camera_sx) ||
+            !occlude_tile_range_near(occluder->min_tile_z, occluder->max_tile_z, camera_sz) )
+            continue;
+
+        switch( occluder->type )
+        {
+        case PAINTERS_OCCLUDER_WALL_X:
+        {
+            int dx = eye_x - occluder->min_x;
+            if( dx > OCCLUDE_WALL_MIN_DISTANCE )
+                occluder->mode = PAINTERS_OCCLUDER_MODE_CAMERA_EAST;
+            else if( dx < -OCCLUDE_WALL_MIN_DISTANCE )
+            {
+                occluder->mode = PAINTERS_OCCLUDER_MODE_CAMERA_WEST;
+                dx = -dx;
+            }
+            else
+                continue;
+
+            occluder->min_delta_z = (occluder->min_z - eye_z) * 256 / dx;
+            occluder->max_delta_z = (occluder->max_z - eye_z) * 256 / dx;
+            occluder->min_delta_y = (occluder->min_y - eye_y) * 256 / dx;
+            occluder->max_delta_y = (occluder->max_y - eye_y) * 256 / dx;
+            break;
+        }
+        case PAINTERS_OCCLUDER_WALL_Z:
+        {
+            int dz = eye_z - occluder->min_z;
+            if( dz > OCCLUDE_WALL_MIN_DISTANCE )
+                occluder->mode = PAINTERS_OCCLUDER_MODE_CAMERA_NORTH;
+            else if( dz < -OCCLUDE_WALL_MIN_DISTANCE )
+            {
+                occluder->mode = PAINTERS_OCCLUDER_MODE_CAMERA_SOUTH;
+                dz = -dz;
+            }
+            else
+                continue;
+
+            occluder->min_delta_x = (occluder->min_x - eye_x) * 256 / dz;
+            occluder->max_delta_x = (occluder->max_x - eye_x) * 256 / dz;
+            occluder->min_delta_y = (occluder->min_y - eye_y) * 256 / dz;
+            occluder->max_delta_y = (occluder->max_y - eye_y) * 256 / dz;
+            break;
+        }
+        case PAINTERS_OCCLUDER_FLOOR:
+        {
+            int dy = occluder->min_y - eye_y;
+            if( dy <= OCCLUDE_FLOOR_MIN_DISTANCE )
+                continue;
+            occluder->mode = PAINTERS_OCCLUDER_MODE_CAMERA_ABOVE;
+
+            occluder->min_delta_x = (occluder->min_x - eye_x) * 256 / dy;
+            occluder->max_delta_x = (occluder->max_x - eye_x) * 256 / dy;
+            occluder->min_delta_z = (occluder->min_z - eye_z) * 256 / dy;
+            occluder->max_delta_z = (occluder->max_z - eye_z) * 256 / dy;
+            break;
+        }
+        default:
+            continue;
+        }
+
+        painter->active_occluders[painter->active_occluder_count++] = i;
+    }
+#endif
+}
+
+/* True when (x, y, z) lies behind an active occluder as seen from the camera. */
+static bool
+painter_occlude_point(
+    const struct Painter* painter,
+    int x,
+    int y,
+    int z)
+{
+    for( int i = 0; i < painter->active_occluder_count; i++ )
+    {
+        const struct PaintersOccluder* o = &painter->occluders[painter->active_occluders[i]];
+        int d;
+        switch( o->mode )
+        {
+        case PAINTERS_OCCLUDER_MODE_CAMERA_EAST:
+        case PAINTERS_OCCLUDER_MODE_CAMERA_WEST:
+            d = o->mode == PAINTERS_OCCLUDER_MODE_CAMERA_EAST ? o->min_x - x : x - o->min_x;
+            if( d <= 0 )
+                break;
+            if( z >= o->min_z + ((o->min_delta_z * d) >> 8) &&
+                z <= o->max_z + ((o->max_delta_z * d) >> 8) &&
+                y >= o->min_y + ((o->min_delta_y * d) >> 8) &&
+                y <= o->max_y + ((o->max_delta_y * d) >> 8) )
+                return true;
+            break;
+        case PAINTERS_OCCLUDER_MODE_CAMERA_NORTH:
+        case PAINTERS_OCCLUDER_MODE_CAMERA_SOUTH:
+            d = o->mode == PAINTERS_OCCLUDER_MODE_CAMERA_NORTH ? o->min_z - z : z - o->min_z;
+            if( d <= 0 )
+                break;
+            if( x >= o->min_x + ((o->min_delta_x * d) >> 8) &&
+                x <= o->max_x + ((o->max_delta_x * d) >> 8) &&
+                y >= o->min_y + ((o->min_delta_y * d) >> 8) &&
+                y <= o->max_y + ((o->max_delta_y * d) >> 8) )
+                return true;
+            break;
+        case PAINTERS_OCCLUDER_MODE_CAMERA_ABOVE:
+            d = y - o->min_y;
+            if( d <= 0 )
+                break;
+            if( x >= o->min_x + ((o->min_delta_x * d) >> 8) &&
+                x <= o->max_x + ((o->max_delta_x * d) >> 8) &&
+                z >= o->min_z + ((o->min_delta_z * d) >> 8) &&
+                z <= o->max_z + ((o->max_delta_z * d) >> 8) )
+                return true;
+            break;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+
+/* Corners of tile (x, z), inset by one unit, at their ground heights minus lift. */
+static bool
+painter_occlude_tile_corners(
+    struct Painter* painter,
+    int x,
+    int z,
+    int level,
+    int lift)
+{
+    struct Heightmap* hm = painter->heightmap;
+    int wx = x << 7;
+    int wz = z << 7;
+    return painter_occlude_point(painter, wx + 1, heightmap_get(hm, x, z, level) - lift, wz + 1) &&
+           painter_occlude_point(
+               painter, wx + 127, heightmap_get(hm, x + 1, z, level) - lift, wz + 1) &&
+           painter_occlude_point(
+               painter, wx + 127, heightmap_get(hm, x + 1, z + 1, level) - lift, wz + 127) &&
+           painter_occlude_point(
+               painter, wx + 1, heightmap_get(hm, x, z + 1, level) - lift, wz + 127);
+}
+
+/**
+ * Ground of the tile at index ti is fully hidden. level is the tile's terrain level (heights);
+ * the result is cached per tile for the frame.
+ */
+static bool
+painter_occlude_tile_hidden(
+    struct Painter* painter,
+    int ti,
+    int x,
+    int z,
+    int level)
+{
+    if( painter->active_occluder_count == 0 )
+        return false;
+
+    int32_t cycle = painter->occlude_cycle;
+    int32_t cached = painter->occlude_tile_cycles[ti];
+    if( cached == cycle )
+        return false;
+    if( cached == -cycle )
+        return true;
+
+    bool hidden = painter_occlude_tile_corners(painter, x, z, level, 0);
+    painter->occlude_tile_cycles[ti] = hidden ? -cycle : cycle;
+    return hidden;
+}
+
+/* A flat element of the given height standing on the tile is hidden. */
+static bool
+painter_occlude_column_hidden(
+    struct Painter* painter,
+    int ti,
+    int x,
+    int z,
+    int level,
+    int height)
+{
+    if( height <= 0 || !painter_occlude_tile_hidden(painter, ti, x, z, level) )
+        return false;
+    return painter_occlude_tile_corners(painter, x, z, level, height);
+}
+
+/* One edge (WallSide bit) of the tile, sampled from the ground to the wall top, is hidden. */
+static bool
+painter_occlude_wall_side_hidden(
+    struct Painter* painter,
+    int x,
+    int z,
+    int level,
+    int side)
+{
+    int wx = x << 7;
+    int wz = z << 7;
+    int ground = heightmap_get(painter->heightmap, x, z, level) - 1;
+    int mid = ground - OCCLUDE_WALL_SAMPLE_MID;
+    int top = ground - OCCLUDE_WALL_SAMPLE_TOP;
+
+    /* Edge endpoints; the ground samples only matter when the camera looks at that face. */
+    int ax;
+    int az;
+    int bx;
+    int bz;
+    bool camera_facing;
+    switch( side )
+    {
+    case WALL_SIDE_WEST:
+        ax = wx;
+        az = wz;
+        bx = wx;
+        bz = wz + 128;
+        camera_facing = wx > painter->camera_x;
+        break;
+    case WALL_SIDE_NORTH:
+        ax = wx;
+        az = wz + 128;
+        bx = wx + 128;
+        bz = wz + 128;
+        camera_facing = wz < painter->camera_z;
+        break;
+    case WALL_SIDE_EAST:
+        ax = wx + 128;
+        az = wz;
+        bx = wx + 128;
+        bz = wz + 128;
+        camera_facing = wx < painter->camera_x;
+        break;
+    case WALL_SIDE_SOUTH:
+        ax = wx;
+        az = wz;
+        bx = wx + 128;
+        bz = wz;
+        camera_facing = wz > painter->camera_z;
+        break;
+    default:
+    {
+        /* Corner posts: the tile centre near the top, then the corner itself. */
+        int corner = ground - OCCLUDE_WALL_SAMPLE_CORNER;
+        if( !painter_occlude_point(painter, wx + 64, corner, wz + 64) )
+            return false;
+        switch( side )
+        {
+        case WALL_CORNER_NORTHWEST:
+            return painter_occlude_point(painter, wx, top, wz + 128);
+        case WALL_CORNER_NORTHEAST:
+            return painter_occlude_point(painter, wx + 128, top, wz + 128);
+        case WALL_CORNER_SOUTHEAST:
+            return painter_occlude_point(painter, wx + 128, top, wz);
+        case WALL_CORNER_SOUTHWEST:
+            return painter_occlude_point(painter, wx, top, wz);
+        default:
+            return false;
+        }
+    }
+    }
+
+    if( camera_facing && (!painter_occlude_point(painter, ax, ground, az) ||
+                          !painter_occlude_point(painter, bx, ground, bz)) )
+        return false;
+    if( level > 0 && (!painter_occlude_point(painter, ax, mid, az) ||
+                      !painter_occlude_point(painter, bx, mid, bz)) )
+        return false;
+    return painter_occlude_point(painter, ax, top, az) &&
+           painter_occlude_point(painter, bx, top, bz);
+}
+
+/* Wall (or wall decor) on the given sides of tile ti is hidden. */
+static bool
+painter_occlude_wall_hidden(
+    struct Painter* painter,
+    int ti,
+    int x,
+    int z,
+    int level,
+    int sides)
+{
+    if( sides == 0 || !painter_occlude_tile_hidden(painter, ti, x, z, level) )
+        return false;
+    for( int bit = 1; bit <= WALL_CORNER_SOUTHWEST; bit <<= 1 )
+    {
+        if( (sides & bit) && !painter_occlude_wall_side_hidden(painter, x, z, level, bit) )
+            return false;
+    }
+    return true;
+}
+
+/**
+ * A scenery element covering [min_x, max_x] x [min_z, max_z] on grid level slevel is hidden:
+ * every footprint tile is hidden and so are the footprint's corners at the element's height.
+ */
+static bool
+painter_occlude_scenery_hidden(
+    struct Painter* painter,
+    const struct PaintersElement* element,
+    int min_x,
+    int max_x,
+    int min_z,
+    int max_z)
+{
+    int height = element->occlude_height;
+    if( height == 0 || painter->active_occluder_count == 0 )
+        return false;
+
+    int level = 0;
+    for( int x = min_x; x <= max_x; x++ )
+    {
+        for( int z = min_z; z <= max_z; z++ )
+        {
+            int ti = painter_coord_idx(painter, x, z, element->slevel);
+            level = painters_tile_get_terrain_level(&painter->tiles[ti]);
+            if( !painter_occlude_tile_hidden(painter, ti, x, z, level) )
+                return false;
+        }
+    }
+
+    struct Heightmap* hm = painter->heightmap;
+    int wx0 = (min_x << 7) + 1;
+    int wz0 = (min_z << 7) + 1;
+    int wx1 = ((max_x + 1) << 7) - 1;
+    int wz1 = ((max_z + 1) << 7) - 1;
+    return painter_occlude_point(
+               painter, wx0, heightmap_get(hm, min_x, min_z, level) - height, wz0) &&
+           painter_occlude_point(
+               painter, wx1, heightmap_get(hm, max_x + 1, min_z, level) - height, wz0) &&
+           painter_occlude_point(
+               painter, wx1, heightmap_get(hm, max_x + 1, max_z + 1, level) - height, wz1) &&
+           painter_occlude_point(
+               painter, wx0, heightmap_get(hm, min_x, max_z + 1, level) - height, wz1);
+}
+
+#endif /* PAINTERS_OCCLUDE_U_C */
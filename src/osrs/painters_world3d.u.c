@@ -248,7 +248,7 @@ painter_w3d_emit_ground_pass(
         {
             element = &painter->elements[bridge_underpass_tile->wall_a];
             assert(element->kind == PNTRELEM_WALL_A);
-            push_command_entity(buffer, element->_wall.entity);
+            push_command_wall(buffer, element->_wall.entity);
         }
 
         for( int32_t sn = bridge_underpass_tile->scenery_head; sn != -1;
@@ -275,7 +275,7 @@ painter_w3d_emit_ground_pass(
         assert(element->kind == PNTRELEM_WALL_A);
 
         if( (element->_wall.side & far_walls) != 0 )
-            push_command_entity(buffer, element->_wall.entity);
+            push_command_wall(buffer, element->_wall.entity);
     }
 
     if( tile->wall_b != -1 )
@@ -284,7 +284,7 @@ painter_w3d_emit_ground_pass(
         assert(element->kind == PNTRELEM_WALL_B);
 
         if( (element->_wall.side & far_walls) != 0 )
-            push_command_entity(buffer, element->_wall.entity);
+            push_command_wall(buffer, element->_wall.entity);
     }
 
     if( tile->ground_decor != -1 )
@@ -397,7 +397,7 @@ painter_w3d_emit_near_wall_pass(
         assert(element->kind == PNTRELEM_WALL_A);
 
         if( (element->_wall.side & tile_paint->near_wall_flags) != 0 )
-            push_command_entity(buffer, element->_wall.entity);
+            push_command_wall(buffer, element->_wall.entity);
     }
 
     if( tile->wall_b != -1 )
@@ -406,7 +406,7 @@ painter_w3d_emit_near_wall_pass(
         assert(element->kind == PNTRELEM_WALL_B);
 
         if( (element->_wall.side & tile_paint->near_wall_flags) != 0 )
-            push_command_entity(buffer, element->_wall.entity);
+            push_command_wall(buffer, element->_wall.entity);
     }
 }
 
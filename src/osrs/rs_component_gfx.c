@@ -155,10 +155,21 @@ rs_gfx_model_step(
     position.y = position.y - game->camera_world_y;
     position.z = position.z - game->camera_world_z;
 
+    struct DashProjectedModel* projection = NULL;
     if( project_models )
     {
-        int cull =
-            dash3d_project_model(game->sys_dash, mod, &position, game->view_port, game->camera);
+        int cull;
+        if( game->sys_projection_arena )
+        {
+            projection = dash3d_project_model_arena(
+                game->sys_projection_arena, mod, &position, game->view_port, game->camera);
+            cull = projection ? projection->cull : DASHCULL_ERROR;
+        }
+        else
+        {
+            cull = dash3d_project_model(
+                game->sys_dash, mod, &position, game->view_port, game->camera);
+        }
         if( cull != DASHCULL_VISIBLE )
             return true;
     }
@@ -172,6 +183,7 @@ rs_gfx_model_step(
         cmd->_model_draw.model_key = rs_model_cache_key_u64(game->world->scene2, se);
         cmd->_model_draw.model_id = scene2_element_dash_model_gpu_id(se);
         memcpy(&cmd->_model_draw.position, &position, sizeof(struct DashPosition));
+        cmd->_model_draw.projection = projection;
     }
     return true;
 }
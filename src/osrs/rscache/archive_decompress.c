@@ -135,25 +135,30 @@ archive_decompress(struct ArchiveBuffer* archive)
     return archive_decrypt_decompress(archive, NULL);
 }
 
-static uint8_t decompress_buffer[65536];
+static uint8_t decompress_buffer[ARCHIVE_DAT_DECOMPRESS_SCRATCH_SIZE];
 bool
 archive_decompress_dat(struct ArchiveBuffer* archive)
+{
+    return archive_decompress_dat_scratch(archive, decompress_buffer, sizeof(decompress_buffer));
+}
+
+bool
+archive_decompress_dat_scratch(
+    struct ArchiveBuffer* archive,
+    uint8_t* scratch,
+    int scratch_size)
 {
     switch( archive->format )
     {
     case ARCHIVE_FORMAT_DAT:
     {
         int uncompressed_length = cache_gzip_decompress(
-            decompress_buffer,
-            sizeof(decompress_buffer),
-            archive->data,
-            archive->data_size,
-            GZIP_NO_FOOTER);
+            scratch, scratch_size, archive->data, archive->data_size, GZIP_NO_FOOTER);
 
         void* decompressed_data = malloc(uncompressed_length);
         if( !decompressed_data )
             return false;
-        memcpy(decompressed_data, decompress_buffer, uncompressed_length);
+        memcpy(decompressed_data, scratch, uncompressed_length);
 
         free(archive->data);
         archive->data = decompressed_data;
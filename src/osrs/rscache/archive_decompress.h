@@ -14,7 +14,19 @@ archive_decrypt_decompress(
     struct ArchiveBuffer* archive,
     uint32_t* xtea_key_nullable);
 
+/* Largest inflated single-blob dat archive. */
+#define ARCHIVE_DAT_DECOMPRESS_SCRATCH_SIZE 65536
+
 bool
 archive_decompress_dat(struct ArchiveBuffer* archive);
 
+// Same as archive_decompress_dat, but inflates through the caller's scratch buffer
+// (ARCHIVE_DAT_DECOMPRESS_SCRATCH_SIZE bytes) instead of the shared static one, so it
+// may run on several threads at once.
+bool
+archive_decompress_dat_scratch(
+    struct ArchiveBuffer* archive,
+    uint8_t* scratch,
+    int scratch_size);
+
 #endif
\ No newline at end of file
@@ -113,6 +113,40 @@ init_files(char const* directory)
     }
 }
 
+static void
+map_files(struct Cache* cache)
+{
+    char path[1024];
+
+    snprintf(path, sizeof(path), "%s/%s.dat2", cache->directory, CACHE_FILE_NAME_ROOT);
+    cache->_dat2_map = disk_mapped_file_open(path);
+    if( !cache->_dat2_map )
+        return;
+
+    snprintf(path, sizeof(path), "%s/%s.idx255", cache->directory, CACHE_FILE_NAME_ROOT);
+    cache->_index_maps[255] = disk_mapped_file_open(path);
+
+    for( int i = 0; i < sizeof(g_table_idx_files) / sizeof(g_table_idx_files[0]); i++ )
+    {
+        int idx_file = g_table_idx_files[i];
+        snprintf(
+            path, sizeof(path), "%s/%s.idx%d", cache->directory, CACHE_FILE_NAME_ROOT, idx_file);
+        cache->_index_maps[idx_file] = disk_mapped_file_open(path);
+    }
+}
+
+static void
+unmap_files(struct Cache* cache)
+{
+    disk_mapped_file_free(cache->_dat2_map);
+    cache->_dat2_map = NULL;
+    for( int i = 0; i < CACHE_INDEX_FILE_COUNT; ++i )
+    {
+        disk_mapped_file_free(cache->_index_maps[i]);
+        cache->_index_maps[i] = NULL;
+    }
+}
+
 static void
 init_reference_tables(struct Cache* cache)
 {
@@ -184,6 +218,10 @@ cache_new_from_directory(char const* directory)
         goto error;
     }
 
+    // Local caches are never appended to, so the files can be mapped for the lifetime
+    // of the cache.
+    map_files(cache);
+
     init_reference_tables(cache);
 
     return cache;
@@ -310,6 +348,7 @@ cache_free(struct Cache* cache)
 {
     if( cache->_dat2_file )
         fclose(cache->_dat2_file);
+    unmap_files(cache);
 
     free(cache->directory);
     for( int i = 0; i < CACHE_TABLE_COUNT; ++i )
@@ -334,11 +373,20 @@ fopen_index(
 static int
 read_index(
     struct IndexRecord* record,
-    char const* cache_directory,
+    struct Cache* cache,
     int table_id,
     int entry_idx)
 {
-    FILE* index_file = fopen_index(cache_directory, table_id);
+    struct DiskMappedFile* index_map = cache->_index_maps[table_id];
+    if( index_map )
+    {
+        if( disk_indexmap_read_record(index_map, entry_idx, record) != 0 )
+            return -1;
+        record->idx_file_id = table_id;
+        return 0;
+    }
+
+    FILE* index_file = fopen_index(cache->directory, table_id);
     if( !index_file )
         return -1;
 
@@ -357,6 +405,30 @@ error:;
     return -1;
 }
 
+static int
+read_archive(
+    struct Cache* cache,
+    struct IndexRecord const* index_record,
+    struct ArchiveBuffer* archive)
+{
+    if( cache->_dat2_map )
+        return disk_dat2map_read_archive(
+            cache->_dat2_map,
+            index_record->idx_file_id,
+            index_record->archive_idx,
+            index_record->sector,
+            index_record->length,
+            archive);
+
+    return disk_dat2file_read_archive(
+        cache->_dat2_file,
+        index_record->idx_file_id,
+        index_record->archive_idx,
+        index_record->sector,
+        index_record->length,
+        archive);
+}
+
 struct CacheArchive*
 cache_archive_new_reference_table_load(
     struct Cache* cache,
@@ -371,18 +443,12 @@ cache_archive_new_reference_table_load(
     memset(archive, 0, sizeof(struct CacheArchive));
 
     struct IndexRecord index_record = { 0 };
-    if( read_index(&index_record, cache->directory, 255, table_id) != 0 )
+    if( read_index(&index_record, cache, 255, table_id) != 0 )
     {
         goto error;
     }
 
-    res = disk_dat2file_read_archive(
-        cache->_dat2_file,
-        index_record.idx_file_id,
-        index_record.archive_idx,
-        index_record.sector,
-        index_record.length,
-        &dat2_archive);
+    res = read_archive(cache, &index_record, &dat2_archive);
 
     if( res != 0 )
     {
@@ -463,7 +529,7 @@ cache_archive_new_load_decrypted(
 
     // TODO: Read archive_id or archive_slot?
     struct IndexRecord index_record = { 0 };
-    read_index(&index_record, cache->directory, table_id, archive_id);
+    read_index(&index_record, cache, table_id, archive_id);
 
     // // The archive is not loaded.
     // if( index_record.sector == 0 )
@@ -501,13 +567,7 @@ cache_archive_new_load_decrypted(
     //     read_index(&index_record, cache->directory, table_id, archive_id);
     // }
 
-    int res = disk_dat2file_read_archive(
-        cache->_dat2_file,
-        index_record.idx_file_id,
-        index_record.archive_idx,
-        index_record.sector,
-        index_record.length,
-        &dat2_archive);
+    int res = read_archive(cache, &index_record, &dat2_archive);
     if( res != 0 )
     {
         printf("Failed to read dat2 archive for table %d\n", table_id);
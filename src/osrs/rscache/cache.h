@@ -74,6 +74,10 @@ enum CacheMode
     CACHE_MODE_INET = 1,
 };
 
+// idx0..idx24 plus idx255, indexed by file number.
+#define CACHE_INDEX_FILE_COUNT 256
+
+struct DiskMappedFile;
 struct Cache
 {
     char const* directory;
@@ -82,6 +86,11 @@ struct Cache
 
     FILE* _dat2_file;
 
+    // Read-only mappings of the dat2 and idx files for local caches. NULL where mmap is
+    // unavailable, in which case reads go through _dat2_file and fopen'd index files.
+    struct DiskMappedFile* _dat2_map;
+    struct DiskMappedFile* _index_maps[CACHE_INDEX_FILE_COUNT];
+
     enum CacheMode mode;
     void* _inet_nullable;
 };
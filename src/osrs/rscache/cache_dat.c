@@ -7,6 +7,7 @@
 #include "tables_dat/config_versionlist_mapsquare.h"
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -31,14 +32,54 @@ fopen_index(
     return fopen(path, "rb+");
 }
 
+static void
+map_files(struct CacheDat* cache_dat)
+{
+    char path[1024];
+
+    snprintf(path, sizeof(path), "%s/%s.dat", cache_dat->directory, CACHE_FILE_NAME_ROOT);
+    cache_dat->_dat_map = disk_mapped_file_open(path);
+    if( !cache_dat->_dat_map )
+        return;
+
+    for( int i = 0; i < CACHE_DAT_TABLE_COUNT; i++ )
+    {
+        snprintf(path, sizeof(path), "%s/%s.idx%d", cache_dat->directory, CACHE_FILE_NAME_ROOT, i);
+        cache_dat->_index_maps[i] = disk_mapped_file_open(path);
+    }
+}
+
+static void
+unmap_files(struct CacheDat* cache_dat)
+{
+    disk_mapped_file_free(cache_dat->_dat_map);
+    cache_dat->_dat_map = NULL;
+    for( int i = 0; i < CACHE_DAT_TABLE_COUNT; i++ )
+    {
+        disk_mapped_file_free(cache_dat->_index_maps[i]);
+        cache_dat->_index_maps[i] = NULL;
+    }
+}
+
 static int
 read_index(
     struct IndexRecord* record,
-    char const* cache_directory,
+    struct CacheDat* cache_dat,
     int table_id,
     int entry_idx)
 {
-    FILE* index_file = fopen_index(cache_directory, table_id);
+    struct DiskMappedFile* index_map = NULL;
+    if( table_id >= 0 && table_id < CACHE_DAT_TABLE_COUNT )
+        index_map = cache_dat->_index_maps[table_id];
+    if( index_map )
+    {
+        if( disk_indexmap_read_record(index_map, entry_idx, record) != 0 )
+            return -1;
+        record->idx_file_id = table_id;
+        return 0;
+    }
+
+    FILE* index_file = fopen_index(cache_dat->directory, table_id);
     if( !index_file )
         return -1;
 
@@ -67,6 +108,7 @@ cache_dat_new_from_directory(char const* directory)
     struct CacheDat* cache_dat = malloc(sizeof(struct CacheDat));
     if( cache_dat == NULL )
         return NULL;
+    memset(cache_dat, 0, sizeof(struct CacheDat));
     cache_dat->directory = strdup(directory);
     cache_dat->_dat_file = fopen_dat(cache_dat->directory);
     if( cache_dat->_dat_file == NULL )
@@ -76,6 +118,8 @@ cache_dat_new_from_directory(char const* directory)
         return NULL;
     }
 
+    map_files(cache_dat);
+
     archive = cache_dat_archive_new_load(cache_dat, CACHE_DAT_CONFIGS, CONFIG_DAT_VERSION_LIST);
 
     filelist = filelist_dat_new_from_cache_dat_archive(archive);
@@ -133,16 +177,18 @@ cache_dat_free(struct CacheDat* cache_dat)
         return;
     if( cache_dat->_dat_file )
         fclose(cache_dat->_dat_file);
+    unmap_files(cache_dat);
     cache_map_squares_free(cache_dat->map_squares);
     free(cache_dat->directory);
     free(cache_dat);
 }
 
-struct CacheDatArchive*
-cache_dat_archive_new_load(
+static struct CacheDatArchive*
+archive_new_load(
     struct CacheDat* cache_dat,
     int table_id,
-    int archive_id)
+    int archive_id,
+    bool decompress)
 {
     struct CacheInetPayload* payload = NULL;
     struct ArchiveBuffer dat2_archive = { 0 };
@@ -162,22 +208,32 @@ cache_dat_archive_new_load(
 
     // TODO: Read archive_id or archive_slot?
     struct IndexRecord index_record = { 0 };
-    read_index(&index_record, cache_dat->directory, table_id, archive_id);
-
-    int res = disk_datfile_read_archive(
-        cache_dat->_dat_file,
-        index_record.idx_file_id,
-        index_record.archive_idx,
-        index_record.sector,
-        index_record.length,
-        &dat2_archive);
+    read_index(&index_record, cache_dat, table_id, archive_id);
+
+    int res;
+    if( cache_dat->_dat_map )
+        res = disk_datmap_read_archive(
+            cache_dat->_dat_map,
+            index_record.idx_file_id,
+            index_record.archive_idx,
+            index_record.sector,
+            index_record.length,
+            &dat2_archive);
+    else
+        res = disk_datfile_read_archive(
+            cache_dat->_dat_file,
+            index_record.idx_file_id,
+            index_record.archive_idx,
+            index_record.sector,
+            index_record.length,
+            &dat2_archive);
     if( res != 0 )
     {
         printf("Failed to read dat2 archive for table %d\n", table_id);
         goto error;
     }
 
-    if( dat2_archive.format == ARCHIVE_FORMAT_DAT )
+    if( dat2_archive.format == ARCHIVE_FORMAT_DAT && decompress )
     {
         if( !archive_decompress_dat(&dat2_archive) )
         {
@@ -191,16 +247,59 @@ cache_dat_archive_new_load(
     archive->archive_id = archive_id;
     archive->table_id = table_id;
     archive->format = dat2_archive.format;
+    archive->compressed = dat2_archive.format == ARCHIVE_FORMAT_DAT && !decompress;
 
     return archive;
 
 error:;
-    if( archive->data )
-        free(archive->data);
+    if( dat2_archive.data )
+        free(dat2_archive.data);
     free(archive);
     return NULL;
 }
 
+struct CacheDatArchive*
+cache_dat_archive_new_load(
+    struct CacheDat* cache_dat,
+    int table_id,
+    int archive_id)
+{
+    return archive_new_load(cache_dat, table_id, archive_id, true);
+}
+
+struct CacheDatArchive*
+cache_dat_archive_new_load_compressed(
+    struct CacheDat* cache_dat,
+    int table_id,
+    int archive_id)
+{
+    return archive_new_load(cache_dat, table_id, archive_id, false);
+}
+
+bool
+cache_dat_archive_decompress(
+    struct CacheDatArchive* archive,
+    uint8_t* scratch,
+    int scratch_size)
+{
+    if( !archive->compressed )
+        return true;
+
+    struct ArchiveBuffer buffer = {
+        .format = archive->format,
+        .data = archive->data,
+        .data_size = archive->data_size,
+        .archive_id = archive->archive_id,
+    };
+    if( !archive_decompress_dat_scratch(&buffer, scratch, scratch_size) )
+        return false;
+
+    archive->data = buffer.data;
+    archive->data_size = buffer.data_size;
+    archive->compressed = false;
+    return true;
+}
+
 void
 cache_dat_archive_free(struct CacheDatArchive* archive)
 {
@@ -3,6 +3,8 @@
 
 #include "archive_decompress.h"
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -17,6 +19,7 @@ enum CacheDatTable
     CACHE_DAT_ANIMATIONS = 2,
     CACHE_DAT_SOUNDS = 3,
     CACHE_DAT_MAPS = 4,
+    CACHE_DAT_TABLE_COUNT
 };
 
 /**
@@ -142,12 +145,18 @@ enum CacheDatTable
  * @return struct CacheDat*
  */
 struct CacheMapSquares;
+struct DiskMappedFile;
 struct CacheDat
 {
     char const* directory;
 
     FILE* _dat_file;
 
+    // Read-only mappings of the dat and idx files. NULL where mmap is unavailable,
+    // in which case reads go through _dat_file and fopen'd index files.
+    struct DiskMappedFile* _dat_map;
+    struct DiskMappedFile* _index_maps[CACHE_DAT_TABLE_COUNT];
+
     struct CacheMapSquares* map_squares;
     // This is just because there is no way to look up an animframe by id
     // unless you unpack all the animframes up front.
@@ -173,6 +182,8 @@ struct CacheDatArchive
     int file_count;
 
     enum ArchiveFormat format;
+    // True while data still holds the gzip stream; see cache_dat_archive_new_load_compressed.
+    bool compressed;
 };
 
 struct CacheDatArchive*
@@ -181,6 +192,27 @@ cache_dat_archive_new_load(
     int table_id,
     int archive_id);
 
+/**
+ * Reads the archive without inflating it, so decompression can be deferred to a worker
+ * thread via cache_dat_archive_decompress. Multifile (config) archives are returned as-is.
+ */
+struct CacheDatArchive*
+cache_dat_archive_new_load_compressed(
+    struct CacheDat* cache_dat,
+    int table_id,
+    int archive_id);
+
+/**
+ * Inflates an archive from cache_dat_archive_new_load_compressed in place. scratch must hold
+ * ARCHIVE_DAT_DECOMPRESS_SCRATCH_SIZE bytes and belong to the calling thread. No-op for
+ * archives that are already decompressed.
+ */
+bool
+cache_dat_archive_decompress(
+    struct CacheDatArchive* archive,
+    uint8_t* scratch,
+    int scratch_size);
+
 void
 cache_dat_archive_free(struct CacheDatArchive* archive);
 
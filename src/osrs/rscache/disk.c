@@ -7,6 +7,16 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(_WIN32)
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DISK_POSIX_MMAP
+#endif
+
 #define SECTOR_SIZE 520
 #define INDEX_ENTRY_SIZE 6
 
@@ -21,7 +31,7 @@ struct SectorHeader
 static void
 read_sector_header_small(
     struct SectorHeader* header,
-    uint8_t* data)
+    uint8_t const* data)
 {
     header->archive_id = ((data[0] & 0xFF) << 8) | (data[1] & 0xFF);
     header->part_no = ((data[2] & 0xFF) << 8) | (data[3] & 0xFF);
@@ -49,7 +59,7 @@ write_sector_header_small(
 static void
 read_sector_header_large(
     struct SectorHeader* header,
-    uint8_t* data)
+    uint8_t const* data)
 {
     header->archive_id = ((data[0] & 0xFF) << 24) | ((data[1] & 0xFF) << 16) |
                          ((data[2] & 0xFF) << 8) | (data[3] & 0xFF);
@@ -87,7 +97,7 @@ static void
 read_sector_header(
     struct SectorHeader* header,
     int archive_id,
-    uint8_t* data,
+    uint8_t const* data,
     int data_size)
 {
     if( archive_id > 0xFFFF )
@@ -120,6 +130,88 @@ write_sector_header(
     }
 }
 
+struct DiskMappedFile*
+disk_mapped_file_open(char const* path)
+{
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(
+        path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if( file == INVALID_HANDLE_VALUE )
+        return NULL;
+
+    LARGE_INTEGER file_size;
+    if( !GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0 )
+    {
+        CloseHandle(file);
+        return NULL;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if( !mapping )
+    {
+        CloseHandle(file);
+        return NULL;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if( !view )
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return NULL;
+    }
+
+    struct DiskMappedFile* mapped = malloc(sizeof(struct DiskMappedFile));
+    mapped->data = (uint8_t const*)view;
+    mapped->size = (size_t)file_size.QuadPart;
+    mapped->_mapping = mapping;
+    mapped->_file_handle = file;
+    return mapped;
+#elif defined(DISK_POSIX_MMAP)
+    int fd = open(path, O_RDONLY);
+    if( fd < 0 )
+        return NULL;
+
+    struct stat st;
+    if( fstat(fd, &st) != 0 || st.st_size <= 0 )
+    {
+        close(fd);
+        return NULL;
+    }
+
+    void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps its own reference to the file.
+    close(fd);
+    if( view == MAP_FAILED )
+        return NULL;
+
+    struct DiskMappedFile* mapped = malloc(sizeof(struct DiskMappedFile));
+    mapped->data = (uint8_t const*)view;
+    mapped->size = (size_t)st.st_size;
+    mapped->_mapping = view;
+    mapped->_file_handle = NULL;
+    return mapped;
+#else
+    (void)path;
+    return NULL;
+#endif
+}
+
+void
+disk_mapped_file_free(struct DiskMappedFile* mapped)
+{
+    if( !mapped )
+        return;
+#if defined(_WIN32)
+    UnmapViewOfFile(mapped->data);
+    CloseHandle((HANDLE)mapped->_mapping);
+    CloseHandle((HANDLE)mapped->_file_handle);
+#elif defined(DISK_POSIX_MMAP)
+    munmap(mapped->_mapping, mapped->size);
+#endif
+    free(mapped);
+}
+
 int
 disk_dat2file_read_archive(
     FILE* dat2_file,
@@ -285,6 +377,100 @@ disk_datfile_read_archive(
         dat_file, index_id + 1, archive_id, start_sector, length_bytes, archive);
 }
 
+int
+disk_dat2map_read_archive(
+    struct DiskMappedFile const* mapped,
+    int idx_file_id,
+    int archive_id,
+    int sector,
+    int length,
+    struct ArchiveBuffer* archive)
+{
+    // Same sector walk as disk_dat2file_read_archive, but the headers are parsed in place
+    // and payloads are copied straight from the mapping; no seek or intermediate buffer.
+    int data_block_size;
+    int header_size = header_size_for_archive(archive_id);
+    struct SectorHeader header = { 0 };
+    uint8_t const* sector_data = NULL;
+    char* out = NULL;
+
+    if( sector <= 0L )
+    {
+        printf("bad read, dat length %d, requested sector %d", length, sector);
+        goto error;
+    }
+
+    int out_len = 0;
+    out = malloc(length);
+
+    for( int part = 0, read_bytes_count = 0; length > read_bytes_count;
+         sector = header.next_sector_no )
+    {
+        if( sector == 0 )
+        {
+            printf("Unexpected end of file\n");
+            goto error;
+        }
+
+        data_block_size = length - read_bytes_count;
+        if( data_block_size > SECTOR_SIZE - header_size )
+            data_block_size = SECTOR_SIZE - header_size;
+
+        if( (size_t)sector * SECTOR_SIZE + header_size + data_block_size > mapped->size )
+        {
+            printf("short read when reading file data for %d/%d\n", archive_id, idx_file_id);
+            goto error;
+        }
+
+        sector_data = mapped->data + (size_t)sector * SECTOR_SIZE;
+        read_sector_header(&header, archive_id, sector_data, header_size + data_block_size);
+
+        if( archive_id != header.archive_id || header.part_no != part ||
+            idx_file_id != header.index_id )
+        {
+            printf(
+                "data mismatch %d != %d, %d != %d, %d != %d\n",
+                archive_id,
+                header.archive_id,
+                part,
+                header.part_no,
+                idx_file_id,
+                header.index_id);
+            goto error;
+        }
+
+        memcpy(out + out_len, sector_data + header_size, data_block_size);
+        out_len += data_block_size;
+
+        read_bytes_count += data_block_size;
+
+        ++part;
+    }
+
+    archive->data = out;
+    archive->data_size = out_len;
+    archive->archive_id = archive_id;
+    return 0;
+
+error:
+    if( out )
+        free(out);
+    return -1;
+}
+
+int
+disk_datmap_read_archive(
+    struct DiskMappedFile const* mapped,
+    int index_id,
+    int archive_id,
+    int start_sector,
+    int length_bytes,
+    struct ArchiveBuffer* archive)
+{
+    return disk_dat2map_read_archive(
+        mapped, index_id + 1, archive_id, start_sector, length_bytes, archive);
+}
+
 int
 disk_dat2file_append_archive(
     FILE* file,
@@ -414,6 +600,31 @@ disk_indexfile_read_record(
     return 0;
 }
 
+int
+disk_indexmap_read_record(
+    struct DiskMappedFile const* mapped,
+    int entry_idx,
+    struct IndexRecord* record)
+{
+    size_t offset = (size_t)entry_idx * INDEX_ENTRY_SIZE;
+    if( entry_idx < 0 || offset + INDEX_ENTRY_SIZE > mapped->size )
+        return -1;
+
+    uint8_t const* data = mapped->data + offset;
+    int length = (data[0] << 16) | (data[1] << 8) | data[2];
+    int sector = (data[3] << 16) | (data[4] << 8) | data[5];
+
+    if( length <= 0 || sector <= 0 )
+        return -1;
+
+    record->length = length;
+    record->sector = sector;
+    record->archive_idx = entry_idx;
+    record->idx_file_id = -1;
+
+    return 0;
+}
+
 int
 disk_indexfile_write_record(
     FILE* file,
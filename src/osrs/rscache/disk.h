@@ -4,9 +4,35 @@
 #include "archive.h"
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 
+/**
+ * Read-only memory map of a cache file (.dat, .dat2 or .idxN).
+ *
+ * Archives and index records are read straight out of the mapping instead of
+ * seeking and copying through stdio. disk_mapped_file_open returns NULL when the
+ * platform has no mmap (or mapping fails); callers keep the FILE* path for that case.
+ *
+ * The mapping is a snapshot of the file size at open time, so it must not be used
+ * for files that are appended to while mapped.
+ */
+struct DiskMappedFile
+{
+    uint8_t const* data;
+    size_t size;
+
+    void* _mapping;
+    void* _file_handle;
+};
+
+struct DiskMappedFile*
+disk_mapped_file_open(char const* path);
+
+void
+disk_mapped_file_free(struct DiskMappedFile* mapped);
+
 int
 disk_dat2file_read_archive(
     FILE* file,
@@ -25,6 +51,24 @@ disk_datfile_read_archive(
     int length_bytes,
     struct ArchiveBuffer* archive);
 
+int
+disk_dat2map_read_archive(
+    struct DiskMappedFile const* mapped,
+    int index_id,
+    int archive_id,
+    int start_sector,
+    int length_bytes,
+    struct ArchiveBuffer* archive);
+
+int
+disk_datmap_read_archive(
+    struct DiskMappedFile const* mapped,
+    int index_id,
+    int archive_id,
+    int start_sector,
+    int length_bytes,
+    struct ArchiveBuffer* archive);
+
 int
 disk_dat2file_append_archive(
     FILE* file,
@@ -51,6 +95,12 @@ disk_indexfile_read_record(
     int entry_idx,
     struct IndexRecord* record);
 
+int
+disk_indexmap_read_record(
+    struct DiskMappedFile const* mapped,
+    int entry_idx,
+    struct IndexRecord* record);
+
 int
 disk_indexfile_write_record(
     FILE* file,
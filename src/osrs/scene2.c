@@ -201,6 +201,7 @@ scene2_new(
     scene2->next_model_gpu_id = 0;
 
     scene2->batch_active = false;
+    scene2->batch_suspended = false;
     scene2->batch_current_id = 0;
 
     return scene2;
@@ -1142,7 +1143,8 @@ scene2_batch_begin(
 {
     if( !scene2 )
         return;
-    assert(!scene2->batch_active && "scene2_batch_begin: nested batch");
+    assert(
+        !scene2->batch_active && !scene2->batch_suspended && "scene2_batch_begin: nested batch");
     scene2->batch_current_id = batch_id;
     scene2->batch_active = true;
     scene2_eventbuffer_push(
@@ -1159,9 +1161,11 @@ scene2_batch_end(struct Scene2* scene2)
 {
     if( !scene2 )
         return;
-    assert(scene2->batch_active && "scene2_batch_end: no active batch");
+    assert(
+        (scene2->batch_active || scene2->batch_suspended) && "scene2_batch_end: no active batch");
     uint32_t id = scene2->batch_current_id;
     scene2->batch_active = false;
+    scene2->batch_suspended = false;
     scene2_eventbuffer_push(
         scene2,
         (struct Scene2Event){
@@ -1171,6 +1175,26 @@ scene2_batch_end(struct Scene2* scene2)
         });
 }
 
+void
+scene2_batch_suspend(struct Scene2* scene2)
+{
+    if( !scene2 )
+        return;
+    assert(scene2->batch_active && "scene2_batch_suspend: no active batch");
+    scene2->batch_active = false;
+    scene2->batch_suspended = true;
+}
+
+void
+scene2_batch_resume(struct Scene2* scene2)
+{
+    if( !scene2 )
+        return;
+    assert(scene2->batch_suspended && "scene2_batch_resume: no suspended batch");
+    scene2->batch_suspended = false;
+    scene2->batch_active = true;
+}
+
 void
 scene2_batch_clear(
     struct Scene2* scene2,
@@ -154,6 +154,8 @@ struct Scene2
 
     /** World rebuild GPU batch: when true, static load events are tagged `batched`. */
     bool batch_active;
+    /** Begun but suspended between the slices of an incremental rebuild: not tagging. */
+    bool batch_suspended;
     uint32_t batch_current_id;
 
     /** World texture batch: wraps all TEXTURE_LOADED events during initial cache load. */
@@ -357,10 +359,19 @@ scene2_batch_begin(
     struct Scene2* scene2,
     uint32_t batch_id);
 
-/** End the active batch; emits BATCH_END with current batch id. */
+/** End the active (or suspended) batch; emits BATCH_END with current batch id. */
 void
 scene2_batch_end(struct Scene2* scene2);
 
+/** Stop tagging load events with the active batch without ending it; no event. Used between the
+ * frame slices of an incremental rebuild, so elements created meanwhile stay unbatched. */
+void
+scene2_batch_suspend(struct Scene2* scene2);
+
+/** Tag load events with the suspended batch again. */
+void
+scene2_batch_resume(struct Scene2* scene2);
+
 /** Tell renderers to unload merged GPU data for a prior batch id. */
 void
 scene2_batch_clear(
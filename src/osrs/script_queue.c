@@ -1,6 +1,6 @@
 #include "script_queue.h"
 
-#include "gameproto_parse.h"
+#include "packet_queue.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -21,8 +21,7 @@ script_queue_clear(struct ScriptQueue* q)
         struct ScriptQueueItem* next = it->next;
         if( it->lc245_2_packet_to_free )
         {
-            gameproto_free_lc245_2_item(it->lc245_2_packet_to_free);
-            free(it->lc245_2_packet_to_free);
+            packet_queue_release(it->lc245_2_packet_to_free);
         }
         free(it);
         it = next;
@@ -18,6 +18,7 @@ enum ScriptKind
     SCRIPT_PKT_IF_SETTAB,
     SCRIPT_PKT_UPDATE_INV_FULL,
     SCRIPT_LOAD_CULLMAP,
+    SCRIPT_PREFETCH_ZONE,
     SCRIPT_COUNT
 };
 
@@ -48,6 +49,13 @@ struct ScriptArgsRebuildNormal
     int zonez;
 };
 
+/** Center zone the player is predicted to rebuild around next. */
+struct ScriptArgsPrefetchZone
+{
+    int zonex;
+    int zonez;
+};
+
 struct ScriptArgsPlayerInfo
 {
     int length;
@@ -87,6 +95,7 @@ struct ScriptArgs
         struct ScriptArgsNpcInfo npc_info;
         struct ScriptArgsLc245Packet lc245_packet;
         struct ScriptArgsLoadCullmap load_cullmap;
+        struct ScriptArgsPrefetchZone prefetch_zone;
     } u;
 };
 
@@ -94,7 +103,7 @@ struct ScriptArgs
 struct ScriptQueueItem
 {
     struct ScriptArgs args;
-    /** If non-NULL, free with gameproto_free_lc245_2_item + free() after Lua script finishes. */
+    /** If non-NULL, give back with packet_queue_release after the Lua script finishes. */
     struct RevPacket_LC245_2_Item* lc245_2_packet_to_free;
     struct ScriptQueueItem* next;
 };
@@ -30,6 +30,16 @@ M.Func = {
 M.ArchiveIdFlags = {
     MAP_TERRAIN = 1,
     MAP_SCENERY = 2,
+    -- OR'd in: return the archive still compressed so Game.BuildCacheDat.decode_archives can
+    -- inflate it on the decode pool. Only pass these archives to decode_archives.
+    COMPRESSED = 4,
+}
+
+-- Job kinds for Game.BuildCacheDat.decode_archives (kind, id, archive triplets).
+M.DecodeKind = {
+    MAP_TERRAIN = 1,
+    MAP_SCENERY = 2,
+    MODEL = 3,
 }
 
 function M.load_archives(requests)
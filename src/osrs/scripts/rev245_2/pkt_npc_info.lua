@@ -1,5 +1,6 @@
 -- pkt_npc_info: load all NPC models (body + head) via CacheDat /
 -- Game.BuildCacheDat.* APIs, then run gameproto_exec NPC info.
+-- Only queued when some model is missing; otherwise gameproto_process runs the packet natively.
 local CacheDat = require("cachedat")
 
 local function queue_unique(seen, list, model_id)
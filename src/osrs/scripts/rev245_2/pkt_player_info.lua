@@ -1,4 +1,5 @@
 -- pkt_player_info: load all appearance models (IDK + OBJ) via CacheDat / Game.BuildCacheDat.* before processing.
+-- Only queued when some model is missing; otherwise gameproto_process runs the packet natively.
 local CacheDat = require("cachedat")
 
 local function print_table(tbl)
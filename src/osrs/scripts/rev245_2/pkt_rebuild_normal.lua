@@ -36,46 +36,45 @@ local wz_ne = zone_ne_z * 8
 
 local chunks, _, _, _, _ = world_to_map_chunks(wx_sw, wz_sw, wx_ne, wz_ne)
 
--- Load map terrain from CacheDat
-local terrain_requests = {}
-local terrain_map_ids = {}
+-- Load map terrain and scenery from CacheDat. Archives stay compressed; decode_archives
+-- inflates and decodes them across the decode pool and adds them in request order.
+local map_requests = {}
+local map_jobs = {}
 for _, chunk in ipairs(chunks) do
+    local map_id = (chunk.x << 16) | (chunk.z)
     if not Game.BuildCacheDat.has_map_terrain(chunk.x, chunk.z) then
-        local map_id = (chunk.x << 16) | (chunk.z)
-        table.insert(terrain_requests, {
+        table.insert(map_requests, {
             table_id = CacheDat.Tables.CACHE_DAT_MAPS,
             archive_id = map_id,
-            flags = CacheDat.ArchiveIdFlags.MAP_TERRAIN,
+            flags = CacheDat.ArchiveIdFlags.MAP_TERRAIN | CacheDat.ArchiveIdFlags.COMPRESSED,
         })
-        table.insert(terrain_map_ids, map_id)
+        table.insert(map_jobs, { kind = CacheDat.DecodeKind.MAP_TERRAIN, id = map_id })
     end
 end
-if #terrain_requests > 0 then
-    local terrain_archives = CacheDat.load_archives(terrain_requests)
-    for i, map_id in ipairs(terrain_map_ids) do
-        Game.BuildCacheDat.map_terrain_cache_add(terrain_archives[i], map_id)
-    end
-end
-
--- Load map scenery from CacheDat
-local scenery_requests = {}
-local scenery_map_ids = {}
 for _, chunk in ipairs(chunks) do
+    local map_id = (chunk.x << 16) | (chunk.z)
     if not Game.BuildCacheDat.has_map_scenery(chunk.x, chunk.z) then
-        local map_id = (chunk.x << 16) | (chunk.z)
-        table.insert(scenery_requests, {
+        table.insert(map_requests, {
             table_id = CacheDat.Tables.CACHE_DAT_MAPS,
             archive_id = map_id,
-            flags = CacheDat.ArchiveIdFlags.MAP_SCENERY,
+            flags = CacheDat.ArchiveIdFlags.MAP_SCENERY | CacheDat.ArchiveIdFlags.COMPRESSED,
         })
-        table.insert(scenery_map_ids, map_id)
+        table.insert(map_jobs, { kind = CacheDat.DecodeKind.MAP_SCENERY, id = map_id })
     end
 end
-if #scenery_requests > 0 then
-    local scenery_archives = CacheDat.load_archives(scenery_requests)
-    for i, map_id in ipairs(scenery_map_ids) do
-        Game.BuildCacheDat.map_scenery_cache_add(scenery_archives[i], map_id)
+
+local function decode_archives(archives, jobs)
+    local args = {}
+    for i, job in ipairs(jobs) do
+        args[#args + 1] = job.kind
+        args[#args + 1] = job.id
+        args[#args + 1] = archives[i]
     end
+    Game.BuildCacheDat.decode_archives(table.unpack(args))
+end
+
+if #map_requests > 0 then
+    decode_archives(CacheDat.load_archives(map_requests), map_jobs)
 end
 
 -- Initialize config from config jagfiles (same path as init_cache_dat)
@@ -86,23 +85,20 @@ Game.BuildCacheDat.init_scenery_configs_from_config_jagfile()
 local models_to_load = Game.BuildCacheDat.get_all_unique_scenery_model_ids()
 
 local model_requests = {}
-local models_needed = {}
+local model_jobs = {}
 for _, model_id in ipairs(models_to_load) do
     if not Game.BuildCacheDat.model_cache_has(model_id) then
         table.insert(model_requests, {
             table_id = CacheDat.Tables.CACHE_DAT_MODELS,
             archive_id = model_id,
-            flags = 0,
+            flags = CacheDat.ArchiveIdFlags.COMPRESSED,
         })
-        table.insert(models_needed, model_id)
+        table.insert(model_jobs, { kind = CacheDat.DecodeKind.MODEL, id = model_id })
     end
 end
 
 if #model_requests > 0 then
-    local model_archives = CacheDat.load_archives(model_requests)
-    for i, model_id in ipairs(models_needed) do
-        Game.BuildCacheDat.model_cache_add(model_archives[i], model_id)
-    end
+    decode_archives(CacheDat.load_archives(model_requests), model_jobs)
 end
 
 Game.Game.build_scene_centerzone(zonex, zonez, SCENE_WIDTH)
@@ -0,0 +1,85 @@
+-- prefetch_zone: decode terrain, scenery and models for the zone the local player is walking
+-- toward into the BuildCacheDat prefetch store, so pkt_rebuild_normal mostly finds them warm.
+-- Queued from GameStep (SCRIPT_PREFETCH_ZONE); nothing is built here.
+local CacheDat = require("cachedat")
+
+local SCENE_WIDTH = 104
+local zone_padding = math.floor(SCENE_WIDTH / (2 * 8)) -- 6
+
+local zonex, zonez = ...
+
+local map_sw_x = math.floor((zonex - zone_padding) * 8 / 64)
+local map_sw_z = math.floor((zonez - zone_padding) * 8 / 64)
+local map_ne_x = math.floor((zonex + zone_padding) * 8 / 64)
+local map_ne_z = math.floor((zonez + zone_padding) * 8 / 64)
+
+local function prefetch_archives(archives, jobs)
+    local args = {}
+    for i, job in ipairs(jobs) do
+        args[#args + 1] = job.kind
+        args[#args + 1] = job.id
+        args[#args + 1] = archives[i]
+    end
+    Game.BuildCacheDat.prefetch_archives(table.unpack(args))
+end
+
+-- Map squares not already live or prefetched (squares shared with the current scene usually are).
+local map_requests = {}
+local map_jobs = {}
+for x = map_sw_x, map_ne_x do
+    for z = map_sw_z, map_ne_z do
+        local map_id = (x << 16) | z
+        if not Game.BuildCacheDat.prefetch_has(CacheDat.DecodeKind.MAP_TERRAIN, map_id) then
+            table.insert(map_requests, {
+                table_id = CacheDat.Tables.CACHE_DAT_MAPS,
+                archive_id = map_id,
+                flags = CacheDat.ArchiveIdFlags.MAP_TERRAIN | CacheDat.ArchiveIdFlags.COMPRESSED,
+            })
+            table.insert(map_jobs, { kind = CacheDat.DecodeKind.MAP_TERRAIN, id = map_id })
+        end
+        if not Game.BuildCacheDat.prefetch_has(CacheDat.DecodeKind.MAP_SCENERY, map_id) then
+            table.insert(map_requests, {
+                table_id = CacheDat.Tables.CACHE_DAT_MAPS,
+                archive_id = map_id,
+                flags = CacheDat.ArchiveIdFlags.MAP_SCENERY | CacheDat.ArchiveIdFlags.COMPRESSED,
+            })
+            table.insert(map_jobs, { kind = CacheDat.DecodeKind.MAP_SCENERY, id = map_id })
+        end
+    end
+end
+
+if #map_requests > 0 then
+    prefetch_archives(CacheDat.load_archives(map_requests), map_jobs)
+end
+
+-- Loc configs are needed to find the scenery models; the rebuild reads the same jagfile.
+if not Game.BuildCacheDat.has_config_jagfile() then
+    local config_jagfile = CacheDat.load_archive(
+        CacheDat.Tables.CACHE_DAT_CONFIGS,
+        CacheDat.ConfigDatKind.CONFIG_DAT_CONFIGS, 0)
+    Game.BuildCacheDat.set_config_jagfile(config_jagfile)
+end
+
+local model_requests = {}
+local model_jobs = {}
+local requested = {}
+for x = map_sw_x, map_ne_x do
+    for z = map_sw_z, map_ne_z do
+        for _, model_id in ipairs(Game.BuildCacheDat.prefetch_scenery_model_ids(x, z)) do
+            if not requested[model_id]
+                and not Game.BuildCacheDat.prefetch_has(CacheDat.DecodeKind.MODEL, model_id) then
+                requested[model_id] = true
+                table.insert(model_requests, {
+                    table_id = CacheDat.Tables.CACHE_DAT_MODELS,
+                    archive_id = model_id,
+                    flags = CacheDat.ArchiveIdFlags.COMPRESSED,
+                })
+                table.insert(model_jobs, { kind = CacheDat.DecodeKind.MODEL, id = model_id })
+            end
+        end
+    end
+end
+
+if #model_requests > 0 then
+    prefetch_archives(CacheDat.load_archives(model_requests), model_jobs)
+end
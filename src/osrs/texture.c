@@ -419,6 +419,10 @@ texture_free(struct DashTexture* texture)
 {
     if( !texture )
         return;
+    free(texture->animation_texels);
+    free(texture->palette_indices);
+    free(texture->palette);
+    free(texture->mip_texels);
     free(texture->texels);
     free(texture);
 }
\ No newline at end of file
@@ -97,12 +97,39 @@ world_new(
     return world;
 }
 
+/* Returns the Scene2 elements of all map-build tiles and locs to the shared pool. */
+static void
+world_release_map_build_elements(struct World* world)
+{
+    int prev_scene = world->_scene_size;
+    int tile_slots = 0;
+    if( prev_scene > 0 )
+        tile_slots = prev_scene * prev_scene * MAP_TERRAIN_LEVELS;
+    else
+        tile_slots = entity_vec_count(&world->map_build_tile_entities);
+    if( tile_slots > MAX_MAP_BUILD_TILE_ENTITIES )
+        tile_slots = MAX_MAP_BUILD_TILE_ENTITIES;
+    for( int i = 0; i < tile_slots; i++ )
+    {
+        world_cleanup_map_build_tile_entity(world, i);
+    }
+    for( int i = 0; i < world->active_loc_entity_count; i++ )
+    {
+        world_cleanup_map_build_loc_entity(world, world->active_loc_entities[i]);
+    }
+    world->active_loc_entity_count = 0;
+}
+
 void
 world_free(struct World* world)
 {
     if( !world )
         return;
 
+    /* Scene2 is shared with the next world; do not leak this world's static elements into it. */
+    if( world->scene2 )
+        world_release_map_build_elements(world);
+
     for( int i = 0; i < entity_vec_count(&world->map_build_loc_entities); i++ )
         free(world_loc_entity(world, i)->actions);
 
@@ -160,6 +187,8 @@ world_free(struct World* world)
         overlaymap_free(world->overlaymap);
     if( world->sharelight_map )
         sharelight_map_free(world->sharelight_map);
+    world_loc_model_cache_end(world);
+    world_scenebuild_model_caches_free(world);
     if( world->blendmap )
         blendmap_free(world->blendmap);
     if( world->terrain_shapemap )
@@ -303,6 +332,7 @@ flag_map_set(
 }
 
 #include "platforms/common/platform_memory.h"
+#include "platforms/common/platform_time.h"
 
 static void
 world_print_scene2_dashmodel_heap_stats(struct World* world)
@@ -438,6 +468,7 @@ world_rebuild_centerzone_begin(
         decor_buildmap_free(world->decor_buildmap);
     if( world->sharelight_map )
         sharelight_map_free(world->sharelight_map);
+    world_loc_model_cache_end(world);
 
     for( int ti = 0; ti < MAP_TERRAIN_LEVELS; ti++ )
     {
@@ -464,31 +495,13 @@ world_rebuild_centerzone_begin(
         }
     }
 
-    {
-        int prev_scene = world->_scene_size;
-        int tile_slots = 0;
-        if( prev_scene > 0 )
-            tile_slots = prev_scene * prev_scene * MAP_TERRAIN_LEVELS;
-        else
-            tile_slots = entity_vec_count(&world->map_build_tile_entities);
-        if( tile_slots > MAX_MAP_BUILD_TILE_ENTITIES )
-            tile_slots = MAX_MAP_BUILD_TILE_ENTITIES;
-        for( int i = 0; i < tile_slots; i++ )
-        {
-            world_cleanup_map_build_tile_entity(world, i);
-        }
-        entity_vec_free(&world->map_build_tile_entities);
-        entity_vec_init(
-            &world->map_build_tile_entities,
-            sizeof(struct MapBuildTileEntity),
-            MAX_MAP_BUILD_TILE_ENTITIES);
-        world_prime_map_build_tile_slot0(world);
-    }
-    for( int i = 0; i < world->active_loc_entity_count; i++ )
-    {
-        world_cleanup_map_build_loc_entity(world, world->active_loc_entities[i]);
-    }
-    world->active_loc_entity_count = 0;
+    world_release_map_build_elements(world);
+    entity_vec_free(&world->map_build_tile_entities);
+    entity_vec_init(
+        &world->map_build_tile_entities,
+        sizeof(struct MapBuildTileEntity),
+        MAX_MAP_BUILD_TILE_ENTITIES);
+    world_prime_map_build_tile_slot0(world);
 
     struct PlatformMemoryInfo mem = { 0 };
     platform_get_memory_info(&mem);
@@ -516,6 +529,7 @@ world_rebuild_centerzone_begin(
     world->decor_buildmap = decor_buildmap_new(scene_size, scene_size, MAP_TERRAIN_LEVELS);
     world->shademap = shademap2_new(scene_size, scene_size, MAP_TERRAIN_LEVELS);
     world->sharelight_map = sharelight_map_new(scene_size, scene_size, MAP_TERRAIN_LEVELS);
+    world_loc_model_cache_begin(world);
 
     struct PlatformMemoryInfo mem2 = { 0 };
     platform_get_memory_info(&mem2);
@@ -674,6 +688,16 @@ world_rebuild_centerzone_chunk_terrain(
                                 level,
                                 flotype->secondary_rgb_color);
                         }
+
+                        /* Floor occluders (painter_occlude_mark in build_scene_terrain) follow
+                         * the flo occlude flag; in dat caches opcode 5 clears it and is decoded
+                         * as hide_underlay = false. A shaped overlay with no underlay leaves part
+                         * of the tile open. */
+                        if( !flotype->hide_underlay || (underlay_id == -1 && tile2->shape != 0) )
+                        {
+                            overlaymap_set_tile_occlude(
+                                world->overlaymap, offset_x, offset_z, level, false);
+                        }
                     }
 
                     if( underlay_id != -1 || overlay_id != -1 )
@@ -956,14 +980,13 @@ world_rebuild_centerzone_chunk(
     world_rebuild_centerzone_chunk_scenery(world, mapx, mapz);
 }
 
-void
-world_rebuild_centerzone_end(struct World* world)
+/* Scene-wide passes that run after contour ground and before lighting: decor offsets, bridges,
+ * painter draw levels and terrain geometry. */
+static void
+world_rebuild_centerzone_layout(struct World* world)
 {
-    struct BuildCacheDat* buildcachedat = world->buildcachedat;
     int scene_size = world->_scene_size;
 
-    world_contour_ground(world);
-
     /* ---- Decor wall-offset pass (scene-local, not chunk-indexed) ---- */
     struct DecorElementsOnWall* elements = NULL;
     struct Scene2Element* scene_element = NULL;
@@ -1111,13 +1134,18 @@ world_rebuild_centerzone_end(struct World* world)
     build_scene_terrain(world);
 #endif
 
+    /* Walls and roofs were marked by scenery_add, floors by the terrain build. */
+    painter_build_occluders(world->painter, world->heightmap);
+
     overlaymap_free(world->overlaymap);
     world->overlaymap = NULL;
     decor_buildmap_free(world->decor_buildmap);
     world->decor_buildmap = NULL;
+}
 
-    world_build_lighting(world);
-
+static void
+world_rebuild_centerzone_finish(struct World* world)
+{
     lightmap_free(world->lightmap);
     world->lightmap = NULL;
     shademap2_free(world->shademap);
@@ -1129,6 +1157,8 @@ world_rebuild_centerzone_end(struct World* world)
     sharelight_map_free(world->sharelight_map);
     world->sharelight_map = NULL;
 
+    world_loc_model_cache_end(world);
+
     world_print_scene2_dashmodel_heap_stats(world);
 
     if( world->scene2 )
@@ -1140,6 +1170,187 @@ world_rebuild_centerzone_end(struct World* world)
     world->load_complete = true;
 }
 
+void
+world_rebuild_centerzone_end(struct World* world)
+{
+    world_contour_ground(world);
+    world_rebuild_centerzone_layout(world);
+    world_build_lighting(world);
+    world_rebuild_centerzone_finish(world);
+}
+
+/* =========================================================================
+ * Incremental rebuild: world_rebuild_new / _step / _take
+ *
+ * Runs the same stages as world_buildcachedat_rebuild_centerzone, but one slice at a
+ * time (a map square, a batch of contour locs, a lighting column) until the frame's
+ * budget is spent. The world being built is not game->world, so the current scene keeps
+ * rendering until the caller swaps the finished one in.
+ * =========================================================================*/
+
+struct WorldRebuild*
+world_rebuild_new(
+    struct World* world,
+    int zone_center_x,
+    int zone_center_z,
+    int scene_size)
+{
+    struct WorldRebuild* rebuild = malloc(sizeof(struct WorldRebuild));
+    memset(rebuild, 0, sizeof(struct WorldRebuild));
+
+    rebuild->world = world;
+    rebuild->stage = WORLD_REBUILD_STAGE_BEGIN;
+    rebuild->zone_center_x = zone_center_x;
+    rebuild->zone_center_z = zone_center_z;
+    rebuild->scene_size = scene_size;
+
+    return rebuild;
+}
+
+void
+world_rebuild_free(struct WorldRebuild* rebuild)
+{
+    if( !rebuild )
+        return;
+
+    struct World* world = rebuild->world;
+    if( world && rebuild->stage != WORLD_REBUILD_STAGE_BEGIN &&
+        rebuild->stage != WORLD_REBUILD_STAGE_DONE )
+    {
+        /* Abandoned mid-build: close the batch opened in _begin (suspended between steps). */
+        if( world->scene2 )
+            scene2_batch_end(world->scene2);
+        if( world->_build_flag_map )
+        {
+            flag_map_free(world->_build_flag_map);
+            world->_build_flag_map = NULL;
+        }
+    }
+    world_free(world);
+    free(rebuild);
+}
+
+/* Advances the map square cursor in the same x-major order as the monolithic rebuild.
+ * Returns true after the last square. */
+static bool
+world_rebuild_next_chunk(struct WorldRebuild* rebuild)
+{
+    struct World* world = rebuild->world;
+
+    rebuild->mapz++;
+    if( rebuild->mapz > world->_chunk_ne_z )
+    {
+        rebuild->mapz = world->_chunk_sw_z;
+        rebuild->mapx++;
+    }
+    return rebuild->mapx > world->_chunk_ne_x;
+}
+
+static void
+world_rebuild_slice(struct WorldRebuild* rebuild)
+{
+    struct World* world = rebuild->world;
+
+    switch( rebuild->stage )
+    {
+    case WORLD_REBUILD_STAGE_BEGIN:
+        world_rebuild_centerzone_begin(
+            world, rebuild->zone_center_x, rebuild->zone_center_z, rebuild->scene_size);
+        rebuild->mapx = world->_chunk_sw_x;
+        rebuild->mapz = world->_chunk_sw_z;
+        rebuild->stage = WORLD_REBUILD_STAGE_TERRAIN;
+        break;
+    case WORLD_REBUILD_STAGE_TERRAIN:
+        world_rebuild_centerzone_chunk_terrain(world, rebuild->mapx, rebuild->mapz);
+        if( world_rebuild_next_chunk(rebuild) )
+        {
+            rebuild->mapx = world->_chunk_sw_x;
+            rebuild->mapz = world->_chunk_sw_z;
+            rebuild->stage = WORLD_REBUILD_STAGE_SCENERY;
+        }
+        break;
+    case WORLD_REBUILD_STAGE_SCENERY:
+        world_rebuild_centerzone_chunk_scenery(world, rebuild->mapx, rebuild->mapz);
+        if( world_rebuild_next_chunk(rebuild) )
+        {
+            rebuild->cursor = 0;
+            rebuild->stage = WORLD_REBUILD_STAGE_CONTOUR;
+        }
+        break;
+    case WORLD_REBUILD_STAGE_CONTOUR:
+    {
+        int last = rebuild->cursor + WORLD_REBUILD_CONTOUR_SLICE;
+        if( last > world->contour_ground_queue_count )
+            last = world->contour_ground_queue_count;
+        world_contour_ground_range(world, rebuild->cursor, last);
+        rebuild->cursor = last;
+        if( rebuild->cursor >= world->contour_ground_queue_count )
+        {
+            world_contour_ground_finish(world);
+            rebuild->stage = WORLD_REBUILD_STAGE_LAYOUT;
+        }
+        break;
+    }
+    case WORLD_REBUILD_STAGE_LAYOUT:
+        world_rebuild_centerzone_layout(world);
+        world_build_lighting_begin(world);
+        rebuild->cursor = 0;
+        rebuild->stage = WORLD_REBUILD_STAGE_LIGHTING;
+        break;
+    case WORLD_REBUILD_STAGE_LIGHTING:
+        world_build_lighting_column(world, rebuild->cursor);
+        rebuild->cursor++;
+        if( rebuild->cursor >= world->sharelight_map->width )
+        {
+            world_build_lighting_end(world);
+            world_rebuild_centerzone_finish(world);
+            rebuild->stage = WORLD_REBUILD_STAGE_DONE;
+        }
+        break;
+    case WORLD_REBUILD_STAGE_DONE:
+        break;
+    }
+}
+
+bool
+world_rebuild_step(
+    struct WorldRebuild* rebuild,
+    int budget_ms)
+{
+    uint64_t budget_us = budget_ms > 0 ? (uint64_t)budget_ms * 1000 : 0;
+    uint64_t start_us = platform_time_us();
+    struct Scene2* scene2 = rebuild->world->scene2;
+
+    /* The batch opened in _begin only tags what this step builds; the old world keeps creating
+     * elements on the same scene2 between steps. */
+    if( scene2 && rebuild->stage != WORLD_REBUILD_STAGE_BEGIN &&
+        rebuild->stage != WORLD_REBUILD_STAGE_DONE )
+        scene2_batch_resume(scene2);
+
+    while( rebuild->stage != WORLD_REBUILD_STAGE_DONE )
+    {
+        world_rebuild_slice(rebuild);
+
+        if( budget_us != 0 && platform_time_us() - start_us >= budget_us )
+            break;
+    }
+
+    if( scene2 && rebuild->stage != WORLD_REBUILD_STAGE_DONE )
+        scene2_batch_suspend(scene2);
+
+    return rebuild->stage == WORLD_REBUILD_STAGE_DONE;
+}
+
+struct World*
+world_rebuild_take(struct WorldRebuild* rebuild)
+{
+    assert(rebuild->stage == WORLD_REBUILD_STAGE_DONE && "world_rebuild_take: rebuild not done");
+
+    struct World* world = rebuild->world;
+    free(rebuild);
+    return world;
+}
+
 void
 world_cleanup_map_build_loc_entity(
     struct World* world,
@@ -1243,6 +1454,12 @@ world_player_entity_set_appearance(
     world_scenebuild_player_entity_set_appearance(
         world, player_entity_id, appearance->appearance, appearance->color);
 
+    /* Kept for IF_SETPLAYERHEAD. */
+    for( int i = 0; i < 12; i++ )
+        player->appearance.slots[i] = appearance->appearance[i];
+    for( int i = 0; i < 5; i++ )
+        player->appearance.colors[i] = appearance->color[i];
+
     struct PassiveAnimationInfo passive_animations = {
         .readyanim = appearance->readyanim,
         .walkanim = appearance->walkanim,
@@ -25,6 +25,8 @@
 /* Forward declaration: defined in world.c (local struct used for bridging during build). */
 struct FlagMap;
 
+struct DashMap;
+
 #define MAX_PLAYERS 2048
 #define MAX_NPCS 8192
 
@@ -102,6 +104,13 @@ struct World
     struct DecorBuildMap* decor_buildmap;
     // Sharelight Element Map
     struct SharelightMap* sharelight_map;
+    /** Lit models shared by identical static loc placements (loc id, shape, rotation). Lives for
+     * one rebuild, like sharelight_map. */
+    struct DashMap* loc_model_cache;
+    /** Lit models shared by players with the same appearance slots and colors, and by NPCs of
+     * the same type. Bases nobody uses are dropped when a cache fills up. */
+    struct DashMap* appearance_look_cache;
+    struct DashMap* npc_model_cache;
 
     int _base_tile_x;
     int _base_tile_z;
@@ -180,6 +189,66 @@ world_rebuild_centerzone_chunk(
 void
 world_rebuild_centerzone_end(struct World* world);
 
+/** Slices of an incremental center-zone rebuild, in the order world_rebuild_step runs them. */
+enum WorldRebuildStage
+{
+    WORLD_REBUILD_STAGE_BEGIN,
+    /** One map square per slice. */
+    WORLD_REBUILD_STAGE_TERRAIN,
+    /** One map square per slice. */
+    WORLD_REBUILD_STAGE_SCENERY,
+    /** WORLD_REBUILD_CONTOUR_SLICE queued locs per slice. */
+    WORLD_REBUILD_STAGE_CONTOUR,
+    /** Decor offsets, bridges and terrain geometry in one slice. */
+    WORLD_REBUILD_STAGE_LAYOUT,
+    /** One scene column of sharelight merging per slice. */
+    WORLD_REBUILD_STAGE_LIGHTING,
+    WORLD_REBUILD_STAGE_DONE,
+};
+
+#define WORLD_REBUILD_CONTOUR_SLICE 64
+
+/** Center-zone rebuild of a World that is not visible yet, advanced a few slices per frame so
+ * the current world keeps rendering until the finished one is swapped in. Owns `world` until
+ * world_rebuild_take. */
+struct WorldRebuild
+{
+    struct World* world;
+    enum WorldRebuildStage stage;
+
+    int zone_center_x;
+    int zone_center_z;
+    int scene_size;
+
+    /* Map square cursor for the terrain and scenery stages. */
+    int mapx;
+    int mapz;
+    /* Contour queue index or lighting column. */
+    int cursor;
+};
+
+struct WorldRebuild*
+world_rebuild_new(
+    struct World* world,
+    int zone_center_x,
+    int zone_center_z,
+    int scene_size);
+
+/** Frees the rebuild and, if it was never taken, its unfinished world. */
+void
+world_rebuild_free(struct WorldRebuild* rebuild);
+
+/** Runs slices until the rebuild is done or `budget_ms` has elapsed; at least one slice always
+ * runs. `budget_ms` <= 0 finishes the rebuild in one call. Returns true once done. */
+bool
+world_rebuild_step(
+    struct WorldRebuild* rebuild,
+    int budget_ms);
+
+/** Returns the finished world and frees the rebuild. */
+struct World*
+world_rebuild_take(struct WorldRebuild* rebuild);
+
 /** After all map chunks are loaded; applies queued heightmap-based contour to loc DashModels. */
 void
 world_contour_ground(struct World* world);
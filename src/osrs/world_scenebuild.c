@@ -1,9 +1,11 @@
 #include "world_scenebuild.h"
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "datatypes/appearances.h"
+#include "graphics/dashmap.h"
 #include "osrs/buildcachedat.h"
 #include "osrs/dash_utils.h"
 #include "osrs/model_transforms.h"
@@ -154,6 +156,16 @@ player_appearance_model(
     struct AppearanceOp op;
     int model_count = 0;
     struct CacheModel* models[12];
+
+    /* Same 12 slots, same body: players rarely change outfits between info packets. */
+    merged = buildcachedat_get_appearance_model(buildcachedat, appearances);
+    if( merged )
+    {
+        dashmodel_move_from_cache_model(dash_model, model_new_copy(merged));
+        _light_model_default(dash_model, 0, 0);
+        return;
+    }
+
     for( int i = 0; i < 12; i++ )
     {
         model = NULL;
@@ -180,10 +192,180 @@ player_appearance_model(
     assert(merged->vertices_x && "Merged model must have vertices");
     assert(merged->vertices_y && "Merged model must have vertices");
     assert(merged->vertices_z && "Merged model must have vertices");
-    dashmodel_move_from_cache_model(dash_model, merged);
+    buildcachedat_add_appearance_model(buildcachedat, appearances, merged);
+    dashmodel_move_from_cache_model(dash_model, model_new_copy(merged));
     _light_model_default(dash_model, 0, 0);
 }
 
+/**
+ * Lit base models shared by entities that look the same: players with the same 12 appearance
+ * slots and 5 body colors, and NPCs of the same type. Each cache holds one reference to its bases;
+ * entities get instances (dashmodel_new_instance) that own only the vertex buffers they animate.
+ * Bases nobody uses anymore are dropped when a cache fills up.
+ */
+struct AppearanceLookKey
+{
+    uint16_t slots[12];
+    uint16_t colors[5];
+    uint16_t _pad;
+};
+
+struct AppearanceLookEntry
+{
+    struct AppearanceLookKey key; // Key must be first field and fixed size for DashMap
+    struct DashModel* base;
+};
+
+struct NpcModelEntry
+{
+    uint32_t npc_type; // Key must be first field and fixed size for DashMap
+    struct DashModel* base;
+};
+
+#define SHARED_MODEL_CACHE_CAPACITY 256
+
+static struct DashMap*
+shared_model_cache_new(
+    size_t key_size,
+    size_t entry_size)
+{
+    size_t buffer_size = dashmap_buffer_size_for(entry_size, SHARED_MODEL_CACHE_CAPACITY);
+    struct DashMapConfig config = {
+        .buffer = malloc(buffer_size),
+        .buffer_size = buffer_size,
+        .key_size = key_size,
+        .entry_size = entry_size,
+    };
+    return dashmap_new(&config, 0);
+}
+
+static struct DashModel**
+shared_model_cache_base(
+    void* entry,
+    size_t base_offset)
+{
+    return (struct DashModel**)((char*)entry + base_offset);
+}
+
+/** Drops bases no entity holds an instance of. Returns the number of entries released. */
+static int
+shared_model_cache_sweep(
+    struct DashMap* map,
+    size_t base_offset)
+{
+    int released = 0;
+    struct DashMapIter* iter = dashmap_iter_new(map);
+    void* entry;
+    while( (entry = dashmap_iter_next(iter)) )
+    {
+        struct DashModel* base = *shared_model_cache_base(entry, base_offset);
+        if( dashmodel_is_shared(base) )
+            continue;
+        dashmodel_free(base);
+        dashmap_search(map, entry, DASHMAP_REMOVE);
+        released++;
+    }
+    dashmap_iter_free(iter);
+    return released;
+}
+
+/** Gives the cache its own reference to `base`. Skipped when the cache is full of bases that
+ * are all still in use. */
+static void
+shared_model_cache_put(
+    struct DashMap* map,
+    const void* key,
+    size_t base_offset,
+    struct DashModel* base)
+{
+    if( dashmap_count(map) >= SHARED_MODEL_CACHE_CAPACITY &&
+        shared_model_cache_sweep(map, base_offset) == 0 )
+        return;
+
+    void* entry = dashmap_search(map, key, DASHMAP_INSERT);
+    if( entry )
+        *shared_model_cache_base(entry, base_offset) = dashmodel_share(base);
+}
+
+static void
+shared_model_cache_free(
+    struct DashMap* map,
+    size_t base_offset)
+{
+    if( !map )
+        return;
+
+    struct DashMapIter* iter = dashmap_iter_new(map);
+    void* entry;
+    while( (entry = dashmap_iter_next(iter)) )
+        dashmodel_free(*shared_model_cache_base(entry, base_offset));
+    dashmap_iter_free(iter);
+
+    free(dashmap_buffer_ptr(map));
+    dashmap_free(map);
+}
+
+/** Returns a lit base model for the look with one reference owned by the caller. */
+static struct DashModel*
+appearance_look_model(
+    struct World* world,
+    uint16_t* appearances,
+    uint16_t* colors)
+{
+    if( !world->appearance_look_cache )
+        world->appearance_look_cache = shared_model_cache_new(
+            sizeof(struct AppearanceLookKey), sizeof(struct AppearanceLookEntry));
+
+    struct AppearanceLookKey key;
+    memset(&key, 0, sizeof(key));
+    memcpy(key.slots, appearances, sizeof(key.slots));
+    memcpy(key.colors, colors, sizeof(key.colors));
+
+    struct AppearanceLookEntry* entry = (struct AppearanceLookEntry*)dashmap_search(
+        world->appearance_look_cache, &key, DASHMAP_FIND);
+    if( entry )
+        return dashmodel_share(entry->base);
+
+    struct DashModel* base = dashmodel_new();
+    player_appearance_model(world->buildcachedat, appearances, colors, base);
+    shared_model_cache_put(
+        world->appearance_look_cache, &key, offsetof(struct AppearanceLookEntry, base), base);
+    return base;
+}
+
+/** Returns a lit base model for the NPC type with one reference owned by the caller. */
+static struct DashModel*
+npc_type_model(
+    struct World* world,
+    int npc_type)
+{
+    if( !world->npc_model_cache )
+        world->npc_model_cache =
+            shared_model_cache_new(sizeof(uint32_t), sizeof(struct NpcModelEntry));
+
+    uint32_t key = (uint32_t)npc_type;
+    struct NpcModelEntry* entry =
+        (struct NpcModelEntry*)dashmap_search(world->npc_model_cache, &key, DASHMAP_FIND);
+    if( entry )
+        return dashmodel_share(entry->base);
+
+    struct DashModel* base = dashmodel_new();
+    npc_model(world->buildcachedat, npc_type, base);
+    shared_model_cache_put(
+        world->npc_model_cache, &key, offsetof(struct NpcModelEntry, base), base);
+    return base;
+}
+
+void
+world_scenebuild_model_caches_free(struct World* world)
+{
+    shared_model_cache_free(
+        world->appearance_look_cache, offsetof(struct AppearanceLookEntry, base));
+    world->appearance_look_cache = NULL;
+    shared_model_cache_free(world->npc_model_cache, offsetof(struct NpcModelEntry, base));
+    world->npc_model_cache = NULL;
+}
+
 void
 world_scenebuild_player_entity_set_appearance(
     struct World* world,
@@ -196,8 +378,9 @@ world_scenebuild_player_entity_set_appearance(
         scene2_element_at(world->scene2, player->scene_element2.element_id);
     scene2_element_expect(element, "world_scenebuild_player_entity_set_appearance");
 
-    struct DashModel* dash_model = dashmodel_new();
-    player_appearance_model(world->buildcachedat, appearances, colors, dash_model);
+    struct DashModel* base = appearance_look_model(world, appearances, colors);
+    struct DashModel* dash_model = dashmodel_new_instance(base);
+    dashmodel_free(base);
 
     scene2_element_set_dash_model(world->scene2, element, dash_model);
 }
@@ -213,8 +396,9 @@ world_scenebuild_npc_entity_set_npc_type(
         scene2_element_at(world->scene2, npc->scene_element2.element_id);
     scene2_element_expect(element, "world_scenebuild_npc_entity_set_npc_type");
 
-    struct DashModel* dash_model = dashmodel_new();
-    npc_model(world->buildcachedat, npc_type, dash_model);
+    struct DashModel* base = npc_type_model(world, npc_type);
+    struct DashModel* dash_model = dashmodel_new_instance(base);
+    dashmodel_free(base);
     scene2_element_set_dash_model(world->scene2, element, dash_model);
 
     struct CacheDatConfigNpc* npc_config = buildcachedat_get_npc(world->buildcachedat, npc_type);
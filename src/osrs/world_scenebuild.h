@@ -12,6 +12,10 @@ world_scenebuild_player_entity_set_appearance(
     uint16_t* appearances,
     uint16_t* colors);
 
+/** Releases the references held by the shared player look and NPC model caches. */
+void
+world_scenebuild_model_caches_free(struct World* world);
+
 void
 world_scenebuild_npc_entity_set_npc_type(
     struct World* world,
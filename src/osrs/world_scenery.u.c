@@ -3,6 +3,7 @@
 
 #include "contour_ground.h"
 #include "dash_utils.h"
+#include "graphics/dashmap.h"
 #include "model_transforms.h"
 #include "world.h"
 
@@ -188,6 +189,100 @@ apply_transforms(
     //     model_transform_hillskew(model, sw_height, se_height, ne_height, nw_height);
 }
 
+/**
+ * Loc model instance cache. Placements of the same loc with the same shape and rotation build
+ * identical lit models, unless the model is contoured to the ground (hillskew), merges normals
+ * with its neighbours (sharelight) or animates. Those placements share one DashModel instead;
+ * each element owns a reference (dashmodel_share) and only its DashPosition differs.
+ */
+struct LocModelCacheEntry
+{
+    uint32_t key; // Key must be first field and fixed size for DashMap
+    struct DashModel* dash_model;
+};
+
+#define LOC_MODEL_CACHE_INITIAL_CAPACITY 1024
+
+static void
+world_loc_model_cache_begin(struct World* world)
+{
+    size_t buffer_size = dashmap_buffer_size_for(
+        sizeof(struct LocModelCacheEntry), LOC_MODEL_CACHE_INITIAL_CAPACITY);
+    struct DashMapConfig config = {
+        .buffer = malloc(buffer_size),
+        .buffer_size = buffer_size,
+        .key_size = sizeof(uint32_t),
+        .entry_size = sizeof(struct LocModelCacheEntry),
+    };
+    world->loc_model_cache = dashmap_new(&config, 0);
+}
+
+/** Drops the cache's own references; the models stay alive with the elements that use them. */
+static void
+world_loc_model_cache_end(struct World* world)
+{
+    if( !world->loc_model_cache )
+        return;
+
+    struct DashMapIter* iter = dashmap_iter_new(world->loc_model_cache);
+    struct LocModelCacheEntry* entry;
+    while( (entry = (struct LocModelCacheEntry*)dashmap_iter_next(iter)) )
+        dashmodel_free(entry->dash_model);
+    dashmap_iter_free(iter);
+
+    free(dashmap_buffer_ptr(world->loc_model_cache));
+    dashmap_free(world->loc_model_cache);
+    world->loc_model_cache = NULL;
+}
+
+static bool
+world_loc_model_cacheable(
+    struct World* world,
+    struct CacheConfigLocation* config_loc)
+{
+    return world->loc_model_cache && config_loc->seq_id == -1 &&
+           config_loc->contour_ground_type == 0 && config_loc->sharelight == 0;
+}
+
+static uint32_t
+world_loc_model_cache_key(
+    int loc_id,
+    int shape_select,
+    int rotation)
+{
+    return ((uint32_t)loc_id << 10) | ((uint32_t)(shape_select & 0x7F) << 3) |
+           (uint32_t)(rotation & 0x7);
+}
+
+static void
+world_loc_model_cache_insert(
+    struct World* world,
+    uint32_t key,
+    struct DashModel* dash_model)
+{
+    struct DashMap* map = world->loc_model_cache;
+    uint32_t count = dashmap_count(map);
+    uint32_t capacity = dashmap_capacity(map);
+    if( count * 4 > capacity * 3 )
+    {
+        size_t new_capacity = (size_t)capacity * 2;
+        size_t new_buffer_size =
+            dashmap_buffer_size_for(sizeof(struct LocModelCacheEntry), new_capacity);
+        void* new_buffer = malloc(new_buffer_size);
+        void* old_buffer = NULL;
+        int rc = dashmap_resize(map, new_buffer, new_buffer_size, new_capacity, &old_buffer);
+        assert(rc == DASHMAP_OK);
+        (void)rc;
+        free(old_buffer);
+    }
+
+    struct LocModelCacheEntry* entry =
+        (struct LocModelCacheEntry*)dashmap_search(map, &key, DASHMAP_INSERT);
+    assert(entry);
+    entry->key = key;
+    entry->dash_model = dashmodel_share(dash_model);
+}
+
 static void
 world_load_scenery_model(
     struct World* world,
@@ -216,6 +311,28 @@ world_load_scenery_model(
         abort();
     }
 
+    struct DashModel* dash_model = NULL;
+    struct Scene2Element* scene_element = NULL;
+
+    bool cacheable = world_loc_model_cacheable(world, config_loc);
+    uint32_t cache_key = 0;
+    if( cacheable )
+    {
+        cache_key = world_loc_model_cache_key(map_tile->loc_id, shape_select, rotation);
+        struct LocModelCacheEntry* entry = (struct LocModelCacheEntry*)dashmap_search(
+            world->loc_model_cache, &cache_key, DASHMAP_FIND);
+        if( entry )
+        {
+            scene_element = scene2_element_at(world->scene2, element_id);
+            if( scene_element )
+            {
+                scene2_element_set_dash_model(
+                    world->scene2, scene_element, dashmodel_share(entry->dash_model));
+                return;
+            }
+        }
+    }
+
     int model_ids[10];
     int model_ids_count = 0;
 
@@ -293,14 +410,21 @@ world_load_scenery_model(
         model = model_new_copy(models[0]);
     }
 
-    struct DashModel* dash_model = NULL;
-    struct Scene2Element* scene_element = NULL;
-
     apply_transforms(config_loc, model, rotation, true);
 
     dash_model = dashmodel_new_from_cache_model(model);
     model_free(model);
 
+    if( cacheable )
+    {
+        /* defaultlight_build skips shared models, so cached models are lit here, once, from the
+         * same uint8_t values sharelight_map_push stores for the uncached path. */
+        _light_model_default(
+            dash_model, (uint8_t)config_loc->contrast, (uint8_t)config_loc->ambient);
+        dashmodel_free_normals(dash_model);
+        world_loc_model_cache_insert(world, cache_key, dash_model);
+    }
+
     scene_element = scene2_element_at(world->scene2, element_id);
     if( !scene_element )
     {
@@ -368,6 +492,71 @@ scenery_init_from_config_loc(
     }
 }
 
+/**
+ * Occluder marks for one straight wall side (see docs/OCCLUDER_SYSTEM.md). East and north
+ * walls sit on the neighbour's west/south edge.
+ */
+static void
+scenery_mark_wall_occluder(
+    struct World* world,
+    struct EntitySceneCoord* coord,
+    int orientation)
+{
+    int sx = coord->sx;
+    int sz = coord->sz;
+    int slevel = coord->slevel;
+
+    switch( ROTATION_WALL_TYPE[orientation & 0x3] )
+    {
+    case WALL_SIDE_WEST:
+        painter_occlude_mark(world->painter, sx, sz, slevel, PAINTERS_OCCLUDE_WALL_X);
+        break;
+    case WALL_SIDE_NORTH:
+        painter_occlude_mark(world->painter, sx, sz + 1, slevel, PAINTERS_OCCLUDE_WALL_Z);
+        break;
+    case WALL_SIDE_EAST:
+        painter_occlude_mark(world->painter, sx + 1, sz, slevel, PAINTERS_OCCLUDE_WALL_X);
+        break;
+    case WALL_SIDE_SOUTH:
+        painter_occlude_mark(world->painter, sx, sz, slevel, PAINTERS_OCCLUDE_WALL_Z);
+        break;
+    }
+}
+
+/**
+ * Height of a static loc model above its origin, for the painter's occluder test. Animated
+ * locs return 0 (never occluded) since their frames may reach past the base model.
+ */
+static int
+scenery_occlude_height(
+    struct World* world,
+    int element_id,
+    struct CacheConfigLocation* config_loc)
+{
+    if( config_loc->seq_id != -1 )
+        return 0;
+
+    struct Scene2Element* scene_element = scene2_element_at(world->scene2, element_id);
+    struct DashModel* dash_model = scene_element ? scene2_element_dash_model(scene_element) : NULL;
+    if( !dash_model )
+        return 0;
+
+    int vertex_count = dashmodel_vertex_count(dash_model);
+    const vertexint_t* vertices_y = dashmodel_vertices_y_const(dash_model);
+    if( !vertices_y || vertex_count <= 0 )
+        return 0;
+
+    int min_y = 0;
+    for( int i = 0; i < vertex_count; i++ )
+    {
+        if( vertices_y[i] < min_y )
+            min_y = vertices_y[i];
+    }
+
+    /* Flat models still get a nonzero height so they take part in the test. */
+    return -min_y > 0 ? -min_y : 1;
+}
+
 static void
 scenery_add_wall_single(
     struct World* world,
@@ -413,6 +602,9 @@ scenery_add_wall_single(
         WALL_A,
         ROTATION_WALL_TYPE[orientation]);
 
+    if( config_loc->occlude )
+        scenery_mark_wall_occluder(world, &entity->scene_coord, orientation);
+
     decor_buildmap_set_wall_offset(
         world->decor_buildmap,
         entity->scene_coord.sx,
@@ -600,6 +792,12 @@ scenery_add_wall_two_sides(
         WALL_B,
         ROTATION_WALL_TYPE[next_orientation]);
 
+    if( config_loc->occlude )
+    {
+        scenery_mark_wall_occluder(world, &entity->scene_coord, orientation);
+        scenery_mark_wall_occluder(world, &entity->scene_coord, next_orientation);
+    }
+
     decor_buildmap_set_wall_offset(
         world->decor_buildmap,
         entity->scene_coord.sx,
@@ -1203,7 +1401,7 @@ scenery_add_wall_diagonal(
     scenery_element_position_init(
         world, entity, &entity->scene_coord, &entity->scene_element, 1, 1);
 
-    painter_add_normal_scenery(
+    int element = painter_add_normal_scenery(
         world->painter,
         entity->scene_coord.sx,
         entity->scene_coord.sz,
@@ -1211,6 +1409,10 @@ scenery_add_wall_diagonal(
         entity->scene_element.element_id,
         1,
         1);
+    painter_set_element_occlude_height(
+        world->painter,
+        element,
+        scenery_occlude_height(world, entity->scene_element.element_id, config_loc));
 
     decor_buildmap_set_wall_offset(
         world->decor_buildmap,
@@ -1289,7 +1491,7 @@ scenery_add_normal(
         scene2_element_dash_position(scene_element)->yaw += 512 * orientation;
     scene2_element_dash_position(scene_element)->yaw %= 2048;
 
-    painter_add_normal_scenery(
+    int element = painter_add_normal_scenery(
         world->painter,
         entity->scene_coord.sx,
         entity->scene_coord.sz,
@@ -1297,6 +1499,10 @@ scenery_add_normal(
         entity->scene_element.element_id,
         size_x,
         size_z);
+    painter_set_element_occlude_height(
+        world->painter,
+        element,
+        scenery_occlude_height(world, entity->scene_element.element_id, config_loc));
 
     /* Shademap */
     int shade = size_x * size_z * 11;
@@ -1359,7 +1565,7 @@ scenery_add_roof(
     scenery_element_position_init(
         world, entity, &entity->scene_coord, &entity->scene_element, 1, 1);
 
-    painter_add_normal_scenery(
+    int element = painter_add_normal_scenery(
         world->painter,
         entity->scene_coord.sx,
         entity->scene_coord.sz,
@@ -1367,6 +1573,24 @@ scenery_add_roof(
         entity->scene_element.element_id,
         1,
         1);
+    painter_set_element_occlude_height(
+        world->painter,
+        element,
+        scenery_occlude_height(world, entity->scene_element.element_id, config_loc));
+
+    /* Upper-level roofs that cover their whole tile occlude like floors; the outer corner
+     * piece leaves half the tile open. */
+    int shape = map_tile->shape_select;
+    if( entity->scene_coord.slevel > 0 && shape >= LOC_SHAPE_ROOF_SLOPED &&
+        shape <= LOC_SHAPE_ROOF_FLAT && shape != LOC_SHAPE_ROOF_SLOPED_OUTER_CORNER )
+    {
+        painter_occlude_mark(
+            world->painter,
+            entity->scene_coord.sx,
+            entity->scene_coord.sz,
+            entity->scene_coord.slevel,
+            PAINTERS_OCCLUDE_FLOOR);
+    }
 
     sharelight_map_push(
         world->sharelight_map,
@@ -1417,12 +1641,16 @@ scenery_add_floor_decoration(
     scenery_element_position_init(
         world, entity, &entity->scene_coord, &entity->scene_element, 1, 1);
 
-    painter_add_ground_decor(
+    int element = painter_add_ground_decor(
         world->painter,
         entity->scene_coord.sx,
         entity->scene_coord.sz,
         entity->scene_coord.slevel,
         entity->scene_element.element_id);
+    painter_set_element_occlude_height(
+        world->painter,
+        element,
+        scenery_occlude_height(world, entity->scene_element.element_id, config_loc));
 
     sharelight_map_push(
         world->sharelight_map,
@@ -1536,124 +1764,138 @@ world_contour_ground_refresh_all_loc_dash_y(struct World* world)
     }
 }
 
-void
-world_contour_ground(struct World* world)
+/** Contours queue entries [first, last). Requires the full heightmap; see world_contour_ground. */
+static void
+world_contour_ground_range(
+    struct World* world,
+    int first,
+    int last)
 {
     struct Heightmap* hm = world->heightmap;
-    if( !hm )
+    if( !world->contour_ground_queue )
         return;
 
-    int n = world->contour_ground_queue_count;
-    if( n > 0 && world->contour_ground_queue )
-    {
-        int loc_count = entity_vec_count(&world->map_build_loc_entities);
+    int loc_count = entity_vec_count(&world->map_build_loc_entities);
 
-        for( int ri = 0; ri < n; ri++ )
+    for( int ri = first; ri < last; ri++ )
+    {
+        struct ContourGroundQueueEntry* r = &world->contour_ground_queue[ri];
+        if( r->entity_id < 0 || r->entity_id >= loc_count )
+            continue;
+
+        struct MapBuildLocEntity* entity = world_loc_entity(world, r->entity_id);
+        struct EntitySceneElement* ese =
+            r->element_slot ? &entity->scene_element_two : &entity->scene_element;
+        if( ese->element_id < 0 )
+            continue;
+
+        struct CacheConfigLocation* config_loc =
+            buildcachedat_get_config_loc(world->buildcachedat, r->loc_id);
+        if( !config_loc || config_loc->contour_ground_type == 0 )
+            continue;
+
+        struct Scene2Element* scene_el = scene2_element_at(world->scene2, ese->element_id);
+        if( !scene_el )
+            continue;
+
+        struct DashModel* dm = scene2_element_dash_model(scene_el);
+        if( !dm )
+            continue;
+
+        int contour_type = config_loc->contour_ground_type;
+        int contour_param = config_loc->contour_ground_param;
+        struct EntitySceneCoord* coord = &entity->scene_coord;
+        int sl = (int)coord->slevel;
+        if( (contour_type == CONTOUR_GROUND_ABOVE_OFFSET ||
+             contour_type == CONTOUR_GROUND_DUAL_LEVEL_BLEND) &&
+            sl + 1 >= hm->levels )
+            continue;
+
+        int scene_x = (int)coord->sx * 128 + 64 * r->size_x;
+        int scene_z = (int)coord->sz * 128 + 64 * r->size_z;
+        struct HeightmapHeights place_heights = { 0 };
+        heightmap_get_heights_sized(
+            hm, (int)coord->sx, (int)coord->sz, sl, r->size_x, r->size_z, &place_heights);
+        int scene_height = place_heights.height_center;
+
+        int hm_ax = hm->size_x;
+        int hm_az = hm->size_z;
+        int above_ax = (contour_type == CONTOUR_GROUND_ABOVE_OFFSET ||
+                        contour_type == CONTOUR_GROUND_DUAL_LEVEL_BLEND)
+                           ? hm_ax
+                           : 0;
+        int above_az = (contour_type == CONTOUR_GROUND_ABOVE_OFFSET ||
+                        contour_type == CONTOUR_GROUND_DUAL_LEVEL_BLEND)
+                           ? hm_az
+                           : 0;
+
+        int vc = dashmodel_vertex_count(dm);
+        vertexint_t* vxs = dashmodel_vertices_x(dm);
+        vertexint_t* vys = dashmodel_vertices_y(dm);
+        vertexint_t* vzs = dashmodel_vertices_z(dm);
+        if( vc <= 0 || !vxs || !vys || !vzs )
+            continue;
+
+        struct ContourGround cg;
+        if( !contour_ground_init(
+                &cg,
+                contour_type,
+                contour_param,
+                hm_ax,
+                hm_az,
+                above_ax,
+                above_az,
+                vxs,
+                vys,
+                vzs,
+                vc,
+                vc,
+                CONTOUR_VERTEX_INT16,
+                scene_x,
+                scene_z,
+                scene_height,
+                sl) )
+            continue;
+
+        struct ContourGroundCommand cmd;
+        while( contour_ground_next(&cg, &cmd) )
         {
-            struct ContourGroundQueueEntry* r = &world->contour_ground_queue[ri];
-            if( r->entity_id < 0 || r->entity_id >= loc_count )
-                continue;
-
-            struct MapBuildLocEntity* entity = world_loc_entity(world, r->entity_id);
-            struct EntitySceneElement* ese =
-                r->element_slot ? &entity->scene_element_two : &entity->scene_element;
-            if( ese->element_id < 0 )
-                continue;
-
-            struct CacheConfigLocation* config_loc =
-                buildcachedat_get_config_loc(world->buildcachedat, r->loc_id);
-            if( !config_loc || config_loc->contour_ground_type == 0 )
-                continue;
-
-            struct Scene2Element* scene_el = scene2_element_at(world->scene2, ese->element_id);
-            if( !scene_el )
-                continue;
-
-            struct DashModel* dm = scene2_element_dash_model(scene_el);
-            if( !dm )
-                continue;
-
-            int contour_type = config_loc->contour_ground_type;
-            int contour_param = config_loc->contour_ground_param;
-            struct EntitySceneCoord* coord = &entity->scene_coord;
-            int sl = (int)coord->slevel;
-            if( (contour_type == CONTOUR_GROUND_ABOVE_OFFSET ||
-                 contour_type == CONTOUR_GROUND_DUAL_LEVEL_BLEND) &&
-                sl + 1 >= hm->levels )
-                continue;
-
-            int scene_x = (int)coord->sx * 128 + 64 * r->size_x;
-            int scene_z = (int)coord->sz * 128 + 64 * r->size_z;
-            struct HeightmapHeights place_heights = { 0 };
-            heightmap_get_heights_sized(
-                hm, (int)coord->sx, (int)coord->sz, sl, r->size_x, r->size_z, &place_heights);
-            int scene_height = place_heights.height_center;
-
-            int hm_ax = hm->size_x;
-            int hm_az = hm->size_z;
-            int above_ax = (contour_type == CONTOUR_GROUND_ABOVE_OFFSET ||
-                            contour_type == CONTOUR_GROUND_DUAL_LEVEL_BLEND)
-                               ? hm_ax
-                               : 0;
-            int above_az = (contour_type == CONTOUR_GROUND_ABOVE_OFFSET ||
-                            contour_type == CONTOUR_GROUND_DUAL_LEVEL_BLEND)
-                               ? hm_az
-                               : 0;
-
-            int vc = dashmodel_vertex_count(dm);
-            vertexint_t* vxs = dashmodel_vertices_x(dm);
-            vertexint_t* vys = dashmodel_vertices_y(dm);
-            vertexint_t* vzs = dashmodel_vertices_z(dm);
-            if( vc <= 0 || !vxs || !vys || !vzs )
-                continue;
-
-            struct ContourGround cg;
-            if( !contour_ground_init(
-                    &cg,
-                    contour_type,
-                    contour_param,
-                    hm_ax,
-                    hm_az,
-                    above_ax,
-                    above_az,
-                    vxs,
-                    vys,
-                    vzs,
-                    vc,
-                    vc,
-                    CONTOUR_VERTEX_INT16,
-                    scene_x,
-                    scene_z,
-                    scene_height,
-                    sl) )
-                continue;
-
-            struct ContourGroundCommand cmd;
-            while( contour_ground_next(&cg, &cmd) )
+            switch( cmd.kind )
             {
-                switch( cmd.kind )
-                {
-                case CONTOUR_CMD_FETCH_HEIGHT:
-                    contour_ground_provide(
-                        &cg, heightmap_get_interpolated(hm, cmd.draw_x, cmd.draw_z, cmd.slevel));
-                    break;
-                case CONTOUR_CMD_FETCH_HEIGHT_ABOVE:
-                    contour_ground_provide(
-                        &cg, heightmap_get_interpolated(hm, cmd.draw_x, cmd.draw_z, sl + 1));
-                    break;
-                case CONTOUR_CMD_SET_Y:
-                    vys[cmd.vertex_index] = (vertexint_t)cmd.contour_y;
-                    break;
-                }
+            case CONTOUR_CMD_FETCH_HEIGHT:
+                contour_ground_provide(
+                    &cg, heightmap_get_interpolated(hm, cmd.draw_x, cmd.draw_z, cmd.slevel));
+                break;
+            case CONTOUR_CMD_FETCH_HEIGHT_ABOVE:
+                contour_ground_provide(
+                    &cg, heightmap_get_interpolated(hm, cmd.draw_x, cmd.draw_z, sl + 1));
+                break;
+            case CONTOUR_CMD_SET_Y:
+                vys[cmd.vertex_index] = (vertexint_t)cmd.contour_y;
+                break;
             }
-
-            dashmodel_set_bounds_cylinder(dm);
         }
+
+        dashmodel_set_bounds_cylinder(dm);
     }
+}
 
+static void
+world_contour_ground_finish(struct World* world)
+{
     world_contour_ground_refresh_all_loc_dash_y(world);
 
     world->contour_ground_queue_count = 0;
 }
 
+void
+world_contour_ground(struct World* world)
+{
+    if( !world->heightmap )
+        return;
+
+    world_contour_ground_range(world, 0, world->contour_ground_queue_count);
+    world_contour_ground_finish(world);
+}
+
 #endif
\ No newline at end of file
@@ -228,6 +228,10 @@ defaultlight_build(struct World* world)
                     if( !dashmodel_is_lightable(scene2_element_dash_model(scene_element)) )
                         continue;
 
+                    /* Loc model cache entries were lit when cached. */
+                    if( dashmodel_is_shared(scene2_element_dash_model(scene_element)) )
+                        continue;
+
                     _light_model_default(
                         scene2_element_dash_model(scene_element),
                         map_element->light_attenuation,
@@ -502,8 +506,10 @@ apply_and_free_column(
     }
 }
 
+/* Lighting streams over scene columns so it can also be advanced one column at a time by
+ * the incremental rebuild (world_rebuild_step). */
 static void
-world_build_lighting(struct World* world)
+world_build_lighting_begin(struct World* world)
 {
     int scene_size = world->sharelight_map->width;
 
@@ -512,6 +518,16 @@ world_build_lighting(struct World* world)
         scene_size < SHARELIGHT_MERGE_LOOKAHEAD + 1 ? scene_size : SHARELIGHT_MERGE_LOOKAHEAD + 1;
     for( int sx = 0; sx < initial_cols; sx++ )
         alloc_normals_for_column(world, sx);
+}
+
+static void
+world_build_lighting_column(
+    struct World* world,
+    int sx)
+{
+    int scene_size = world->sharelight_map->width;
+    int initial_cols =
+        scene_size < SHARELIGHT_MERGE_LOOKAHEAD + 1 ? scene_size : SHARELIGHT_MERGE_LOOKAHEAD + 1;
 
     /*
      * Stream through columns: alloc one column ahead, merge the current column, then
@@ -519,17 +535,20 @@ world_build_lighting(struct World* world)
      * current column's primary models may still have written into column current-1 via the
      * level+1 look-back; after processing current the column current-1 is finalized).
      */
-    for( int sx = 0; sx < scene_size; sx++ )
-    {
-        int alloc_sx = sx + SHARELIGHT_MERGE_LOOKAHEAD;
-        if( alloc_sx < scene_size && alloc_sx >= initial_cols )
-            alloc_normals_for_column(world, alloc_sx);
+    int alloc_sx = sx + SHARELIGHT_MERGE_LOOKAHEAD;
+    if( alloc_sx < scene_size && alloc_sx >= initial_cols )
+        alloc_normals_for_column(world, alloc_sx);
 
-        merge_column(world, sx);
+    merge_column(world, sx);
 
-        if( sx >= 1 )
-            apply_and_free_column(world, sx - 1);
-    }
+    if( sx >= 1 )
+        apply_and_free_column(world, sx - 1);
+}
+
+static void
+world_build_lighting_end(struct World* world)
+{
+    int scene_size = world->sharelight_map->width;
 
     /* Apply remaining (last column). */
     apply_and_free_column(world, scene_size - 1);
@@ -537,4 +556,15 @@ world_build_lighting(struct World* world)
     defaultlight_build(world);
 }
 
+static void
+world_build_lighting(struct World* world)
+{
+    int scene_size = world->sharelight_map->width;
+
+    world_build_lighting_begin(world);
+    for( int sx = 0; sx < scene_size; sx++ )
+        world_build_lighting_column(world, sx);
+    world_build_lighting_end(world);
+}
+
 #endif
\ No newline at end of file
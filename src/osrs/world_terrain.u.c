@@ -167,6 +167,29 @@ apply_shade(
     }
 }
 
+/**
+ * Flat, fully covered floors above the ground level hide what is under them; mark them for
+ * painter_build_occluders (reference finishBuild floor rule).
+ */
+static void
+terrain_mark_floor_occluder(
+    struct World* world,
+    struct OverlaymapTile* overlay_tile,
+    int x,
+    int z,
+    int level,
+    int height_sw,
+    int height_se,
+    int height_ne,
+    int height_nw)
+{
+    if( level == 0 || !overlay_tile->occlude )
+        return;
+    if( height_sw != height_se || height_sw != height_ne || height_sw != height_nw )
+        return;
+    painter_occlude_mark(world->painter, x, z, level, PAINTERS_OCCLUDE_FLOOR);
+}
+
 static int
 terrain_element_acquire(
     struct World* world,
@@ -276,6 +299,9 @@ build_scene_terrain(struct World* world)
                 int height_ne = heightmap_get(world->heightmap, x + 1, z + 1, level);
                 int height_nw = heightmap_get(world->heightmap, x, z + 1, level);
 
+                terrain_mark_floor_occluder(
+                    world, overlay_tile, x, z, level, height_sw, height_se, height_ne, height_nw);
+
                 int light_sw = lightmap_get(world->lightmap, x, z, level);
                 int light_se = lightmap_get(world->lightmap, x + 1, z, level);
                 int light_ne = lightmap_get(world->lightmap, x + 1, z + 1, level);
@@ -498,6 +524,9 @@ build_scene_terrain_va(struct World* world)
                 int height_ne = heightmap_get(world->heightmap, x + 1, z + 1, level);
                 int height_nw = heightmap_get(world->heightmap, x, z + 1, level);
 
+                terrain_mark_floor_occluder(
+                    world, overlay_tile, x, z, level, height_sw, height_se, height_ne, height_nw);
+
                 int light_sw = lightmap_get(world->lightmap, x, z, level);
                 int light_se = lightmap_get(world->lightmap, x + 1, z, level);
                 int light_ne = lightmap_get(world->lightmap, x + 1, z + 1, level);
@@ -1,10 +1,10 @@
 /* Generated by tools/gen_lua_api_ht.py — DO NOT EDIT */
 /** @type {readonly Map<string, number>[]} */
 export const luaApiDomainMaps = [
-  new Map([["map_scenery_cache_add", 1], ["set_config_jagfile", 2], ["init_varp_varbit_from_config_jagfile", 3], ["set_versionlist_jagfile", 4], ["map_terrain_cache_add", 5], ["has_map_terrain", 6], ["has_map_scenery", 7], ["model_cache_has", 8], ["animbaseframes_cache_has", 9], ["floortypes_init_from_config_jagfile", 10], ["init_scenery_configs_from_config_jagfile", 11], ["get_all_scenery_locs", 12], ["get_scenery_model_ids", 13], ["get_all_unique_scenery_model_ids", 14], ["get_npc_model_ids", 15], ["get_npc_head_model_ids", 16], ["get_idk_model_ids", 17], ["get_idk_head_model_ids", 18], ["get_obj_model_ids", 19], ["get_obj_head_model_ids", 20], ["get_obj", 21], ["get_player_appearance_ids_from_packet", 22], ["get_npc_ids_from_packet", 23], ["model_cache_add", 24], ["load_interfaces", 25], ["sequences_init_from_config_jagfile", 26], ["get_animbaseframes_count_from_versionlist_jagfile", 27], ["animbaseframes_cache_add", 28], ["idkits_init_from_config_jagfile", 29], ["objects_init_from_config_jagfile", 30], ["set_2d_media_jagfile", 31], ["cache_textures", 32], ["cache_title", 33], ["cache_media", 34], ["load_component_sprites_from_media", 35], ["finalize_scene", 36], ["component_cache_clear", 37], ["clear_map_chunks", 38], ["model_cache_clear", 39], ["clear_config_jagfile", 40], ["clear_versionlist_jagfile", 41], ["clear_media_jagfile", 42], ["clear", 43], ["scenery_config_load_mapchunk_from_config_jagfile", 44], ["scenery_config_get_model_ids_mapchunk", 45], ["scenery_config_get_animbaseframes_ids_mapchunk", 46], ["animbaseframes_cache_clear", 47], ["scenery_config_clear", 48], ["sequences_clear", 49], ["map_scenery_cache_clear", 50], ["map_terrain_cache_clear", 51], ["floortypes_clear", 52], ["objects_clear", 53]]),
-  new Map([["build_scene", 54], ["build_scene_centerzone", 55], ["exec_pkt_player_info", 56], ["exec_pkt_npc_info", 57], ["exec_pkt_if_settab", 58], ["exec_pkt_update_inv_full", 59], ["get_inv_obj_ids", 60], ["load_interfaces", 61], ["load_component_sprites", 62], ["get_interface_model_ids", 63], ["get_heap_usage_mb", 64], ["rebuild_centerzone_begin", 65], ["rebuild_centerzone_chunk", 66], ["rebuild_centerzone_end", 67], ["rebuild_centerzone_slow", 68]]),
-  new Map([["load_textures", 69]]),
-  new Map([["load_revconfig", 70], ["load_fonts", 71], ["load_rs_components", 72], ["resolve_inv_sprites", 73], ["parse_revconfig", 74], ["get_revconfig_inv_obj_ids", 75], ["load_revconfig_inventories", 76], ["load_revconfig_ui", 77]]),
-  new Map([["read_cullmap_from_blob", 78], ["save_camera", 79], ["load_camera", 80]]),
+  new Map([["map_scenery_cache_add", 1], ["set_config_jagfile", 2], ["init_varp_varbit_from_config_jagfile", 3], ["set_versionlist_jagfile", 4], ["map_terrain_cache_add", 5], ["has_map_terrain", 6], ["has_map_scenery", 7], ["model_cache_has", 8], ["animbaseframes_cache_has", 9], ["floortypes_init_from_config_jagfile", 10], ["init_scenery_configs_from_config_jagfile", 11], ["get_all_scenery_locs", 12], ["get_scenery_model_ids", 13], ["get_all_unique_scenery_model_ids", 14], ["get_npc_model_ids", 15], ["get_npc_head_model_ids", 16], ["get_idk_model_ids", 17], ["get_idk_head_model_ids", 18], ["get_obj_model_ids", 19], ["get_obj_head_model_ids", 20], ["get_obj", 21], ["get_player_appearance_ids_from_packet", 22], ["get_npc_ids_from_packet", 23], ["model_cache_add", 24], ["decode_archives", 25], ["prefetch_archives", 26], ["prefetch_has", 27], ["prefetch_scenery_model_ids", 28], ["has_config_jagfile", 29], ["load_interfaces", 30], ["sequences_init_from_config_jagfile", 31], ["get_animbaseframes_count_from_versionlist_jagfile", 32], ["animbaseframes_cache_add", 33], ["idkits_init_from_config_jagfile", 34], ["objects_init_from_config_jagfile", 35], ["set_2d_media_jagfile", 36], ["cache_textures", 37], ["cache_title", 38], ["cache_media", 39], ["load_component_sprites_from_media", 40], ["finalize_scene", 41], ["component_cache_clear", 42], ["clear_map_chunks", 43], ["model_cache_clear", 44], ["clear_config_jagfile", 45], ["clear_versionlist_jagfile", 46], ["clear_media_jagfile", 47], ["clear", 48], ["scenery_config_load_mapchunk_from_config_jagfile", 49], ["scenery_config_get_model_ids_mapchunk", 50], ["scenery_config_get_animbaseframes_ids_mapchunk", 51], ["animbaseframes_cache_clear", 52], ["scenery_config_clear", 53], ["sequences_clear", 54], ["map_scenery_cache_clear", 55], ["map_terrain_cache_clear", 56], ["floortypes_clear", 57], ["objects_clear", 58]]),
+  new Map([["build_scene", 59], ["build_scene_centerzone", 60], ["exec_pkt_player_info", 61], ["exec_pkt_npc_info", 62], ["exec_pkt_if_settab", 63], ["exec_pkt_update_inv_full", 64], ["get_inv_obj_ids", 65], ["load_interfaces", 66], ["load_component_sprites", 67], ["get_interface_model_ids", 68], ["get_heap_usage_mb", 69], ["rebuild_centerzone_begin", 70], ["rebuild_centerzone_chunk", 71], ["rebuild_centerzone_end", 72], ["rebuild_centerzone_slow", 73]]),
+  new Map([["load_textures", 74]]),
+  new Map([["load_revconfig", 75], ["load_fonts", 76], ["load_rs_components", 77], ["resolve_inv_sprites", 78], ["parse_revconfig", 79], ["get_revconfig_inv_obj_ids", 80], ["load_revconfig_inventories", 81], ["load_revconfig_ui", 82]]),
+  new Map([["read_cullmap_from_blob", 83], ["save_camera", 84], ["load_camera", 85]]),
 ];
 
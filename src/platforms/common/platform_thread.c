@@ -0,0 +1,287 @@
+#include "platform_thread.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define PLATFORM_WORKER_POOL_MAX_THREADS 64
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+#define PLATFORM_THREAD_NONE
+#elif defined(_WIN32)
+#define PLATFORM_THREAD_WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#define PLATFORM_THREAD_PTHREAD
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+struct PlatformWorkerPool;
+
+struct PlatformWorker
+{
+    struct PlatformWorkerPool* pool;
+    int index;
+#if defined(PLATFORM_THREAD_WIN32)
+    HANDLE thread;
+#elif defined(PLATFORM_THREAD_PTHREAD)
+    pthread_t thread;
+#endif
+};
+
+struct PlatformWorkerPool
+{
+    int thread_count;
+
+    PlatformWorkerJobFn fn;
+    void* userdata;
+    int job_count;
+    int quit;
+
+#if defined(PLATFORM_THREAD_WIN32)
+    volatile LONG next_job;
+    /* XP has no condition variables; workers take one start token per run and hand back one
+     * done token. */
+    HANDLE start_sem;
+    HANDLE done_sem;
+#elif defined(PLATFORM_THREAD_PTHREAD)
+    int next_job;
+    pthread_mutex_t mutex;
+    pthread_cond_t start_cond;
+    pthread_cond_t done_cond;
+    unsigned generation;
+    int pending;
+#endif
+
+    struct PlatformWorker workers[PLATFORM_WORKER_POOL_MAX_THREADS];
+};
+
+static int
+next_job_index(struct PlatformWorkerPool* pool)
+{
+#if defined(PLATFORM_THREAD_WIN32)
+    return (int)InterlockedExchangeAdd(&pool->next_job, 1);
+#elif defined(PLATFORM_THREAD_PTHREAD)
+    return __atomic_fetch_add(&pool->next_job, 1, __ATOMIC_RELAXED);
+#else
+    return pool->next_job++;
+#endif
+}
+
+static void
+drain_jobs(
+    struct PlatformWorkerPool* pool,
+    int worker)
+{
+    for( ;; )
+    {
+        int job = next_job_index(pool);
+        if( job >= pool->job_count )
+            break;
+        pool->fn(pool->userdata, job, worker);
+    }
+}
+
+int
+platform_cpu_count(void)
+{
+#if defined(PLATFORM_THREAD_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#elif defined(PLATFORM_THREAD_PTHREAD)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#else
+    return 1;
+#endif
+}
+
+#if defined(PLATFORM_THREAD_WIN32)
+
+static DWORD WINAPI
+worker_main(LPVOID arg)
+{
+    struct PlatformWorker* worker = (struct PlatformWorker*)arg;
+    struct PlatformWorkerPool* pool = worker->pool;
+    for( ;; )
+    {
+        WaitForSingleObject(pool->start_sem, INFINITE);
+        if( pool->quit )
+            break;
+        drain_jobs(pool, worker->index);
+        ReleaseSemaphore(pool->done_sem, 1, NULL);
+    }
+    return 0;
+}
+
+#elif defined(PLATFORM_THREAD_PTHREAD)
+
+static void*
+worker_main(void* arg)
+{
+    struct PlatformWorker* worker = (struct PlatformWorker*)arg;
+    struct PlatformWorkerPool* pool = worker->pool;
+    unsigned seen = 0;
+    for( ;; )
+    {
+        pthread_mutex_lock(&pool->mutex);
+        while( pool->generation == seen && !pool->quit )
+            pthread_cond_wait(&pool->start_cond, &pool->mutex);
+        seen = pool->generation;
+        int quit = pool->quit;
+        pthread_mutex_unlock(&pool->mutex);
+        if( quit )
+            break;
+
+        drain_jobs(pool, worker->index);
+
+        pthread_mutex_lock(&pool->mutex);
+        if( --pool->pending == 0 )
+            pthread_cond_signal(&pool->done_cond);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+    return NULL;
+}
+
+#endif
+
+struct PlatformWorkerPool*
+platform_worker_pool_new(int thread_count)
+{
+    struct PlatformWorkerPool* pool =
+        (struct PlatformWorkerPool*)malloc(sizeof(struct PlatformWorkerPool));
+    if( !pool )
+        return NULL;
+    memset(pool, 0, sizeof(struct PlatformWorkerPool));
+
+    if( thread_count < 1 )
+        thread_count = 1;
+    if( thread_count > PLATFORM_WORKER_POOL_MAX_THREADS )
+        thread_count = PLATFORM_WORKER_POOL_MAX_THREADS;
+
+#if defined(PLATFORM_THREAD_NONE)
+    thread_count = 1;
+#elif defined(PLATFORM_THREAD_WIN32)
+    pool->start_sem = CreateSemaphore(NULL, 0, PLATFORM_WORKER_POOL_MAX_THREADS, NULL);
+    pool->done_sem = CreateSemaphore(NULL, 0, PLATFORM_WORKER_POOL_MAX_THREADS, NULL);
+    if( !pool->start_sem || !pool->done_sem )
+        thread_count = 1;
+#elif defined(PLATFORM_THREAD_PTHREAD)
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->start_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+#endif
+
+    /* Worker 0 is the caller of platform_worker_pool_run. */
+    pool->thread_count = 1;
+    for( int i = 1; i < thread_count; i++ )
+    {
+        struct PlatformWorker* worker = &pool->workers[i];
+        worker->pool = pool;
+        worker->index = i;
+#if defined(PLATFORM_THREAD_WIN32)
+        worker->thread = CreateThread(NULL, 0, worker_main, worker, 0, NULL);
+        if( !worker->thread )
+            break;
+#elif defined(PLATFORM_THREAD_PTHREAD)
+        if( pthread_create(&worker->thread, NULL, worker_main, worker) != 0 )
+            break;
+#endif
+        pool->thread_count++;
+    }
+
+    return pool;
+}
+
+void
+platform_worker_pool_free(struct PlatformWorkerPool* pool)
+{
+    if( !pool )
+        return;
+
+#if defined(PLATFORM_THREAD_WIN32)
+    pool->quit = 1;
+    if( pool->thread_count > 1 )
+        ReleaseSemaphore(pool->start_sem, pool->thread_count - 1, NULL);
+    for( int i = 1; i < pool->thread_count; i++ )
+    {
+        WaitForSingleObject(pool->workers[i].thread, INFINITE);
+        CloseHandle(pool->workers[i].thread);
+    }
+    if( pool->start_sem )
+        CloseHandle(pool->start_sem);
+    if( pool->done_sem )
+        CloseHandle(pool->done_sem);
+#elif defined(PLATFORM_THREAD_PTHREAD)
+    pthread_mutex_lock(&pool->mutex);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->mutex);
+    for( int i = 1; i < pool->thread_count; i++ )
+        pthread_join(pool->workers[i].thread, NULL);
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->start_cond);
+    pthread_mutex_destroy(&pool->mutex);
+#endif
+
+    free(pool);
+}
+
+int
+platform_worker_pool_thread_count(struct PlatformWorkerPool* pool)
+{
+    return pool ? pool->thread_count : 1;
+}
+
+void
+platform_worker_pool_run(
+    struct PlatformWorkerPool* pool,
+    int job_count,
+    PlatformWorkerJobFn fn,
+    void* userdata)
+{
+    if( job_count <= 0 )
+        return;
+
+    if( !pool || pool->thread_count <= 1 || job_count == 1 )
+    {
+        for( int i = 0; i < job_count; i++ )
+            fn(userdata, i, 0);
+        return;
+    }
+
+    pool->fn = fn;
+    pool->userdata = userdata;
+    pool->job_count = job_count;
+    pool->next_job = 0;
+
+    int const helpers = pool->thread_count - 1;
+
+#if defined(PLATFORM_THREAD_WIN32)
+    /* Semaphore release/wait are full barriers, publishing fn/userdata/job_count. */
+    ReleaseSemaphore(pool->start_sem, helpers, NULL);
+    drain_jobs(pool, 0);
+    for( int i = 0; i < helpers; i++ )
+        WaitForSingleObject(pool->done_sem, INFINITE);
+#elif defined(PLATFORM_THREAD_PTHREAD)
+    pthread_mutex_lock(&pool->mutex);
+    pool->pending = helpers;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    drain_jobs(pool, 0);
+
+    pthread_mutex_lock(&pool->mutex);
+    while( pool->pending > 0 )
+        pthread_cond_wait(&pool->done_cond, &pool->mutex);
+    pthread_mutex_unlock(&pool->mutex);
+#else
+    (void)helpers;
+    drain_jobs(pool, 0);
+#endif
+}
@@ -0,0 +1,45 @@
+#ifndef PLATFORM_THREAD_H
+#define PLATFORM_THREAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Called once per job index in [0, job_count). `worker` is in [0, thread_count); the thread
+ *  that called platform_worker_pool_run is worker 0. */
+typedef void (*PlatformWorkerJobFn)(
+    void* userdata,
+    int job,
+    int worker);
+
+struct PlatformWorkerPool;
+
+/** Number of logical CPUs, at least 1. */
+int
+platform_cpu_count(void);
+
+/** `thread_count` includes the calling thread, so thread_count - 1 workers are spawned. Values
+ *  < 1 are clamped to 1. Builds without thread support always run serially on the caller. */
+struct PlatformWorkerPool*
+platform_worker_pool_new(int thread_count);
+
+void
+platform_worker_pool_free(struct PlatformWorkerPool* pool);
+
+int
+platform_worker_pool_thread_count(struct PlatformWorkerPool* pool);
+
+/** Runs `fn` for every job and returns once all of them have completed. Jobs are handed out
+ *  dynamically (next free index), so callers should order them largest-first when uneven. */
+void
+platform_worker_pool_run(
+    struct PlatformWorkerPool* pool,
+    int job_count,
+    PlatformWorkerJobFn fn,
+    void* userdata);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLATFORM_THREAD_H */
@@ -0,0 +1,45 @@
+#include "platform_time.h"
+
+#if defined(__EMSCRIPTEN__)
+
+#include <emscripten.h>
+
+uint64_t
+platform_time_us(void)
+{
+    return (uint64_t)(emscripten_get_now() * 1000.0);
+}
+
+#elif defined(_WIN32)
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+uint64_t
+platform_time_us(void)
+{
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if( frequency.QuadPart == 0 )
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000ull +
+           (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000ull /
+               (uint64_t)frequency.QuadPart;
+}
+
+#else
+
+#include <time.h>
+
+uint64_t
+platform_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ull + (uint64_t)ts.tv_nsec / 1000ull;
+}
+
+#endif
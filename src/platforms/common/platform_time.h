@@ -0,0 +1,18 @@
+#ifndef PLATFORM_TIME_H
+#define PLATFORM_TIME_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Monotonic clock in microseconds. Only differences between two calls are meaningful. */
+uint64_t
+platform_time_us(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLATFORM_TIME_H */
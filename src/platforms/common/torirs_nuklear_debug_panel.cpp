@@ -11,6 +11,9 @@
 #include <string.h>
 
 extern "C" {
+#include "graphics/dash_pose_cache.h"
+#include "graphics/dash_text_cache.h"
+#include "osrs/obj_icon_cache.h"
 #include "tori_rs.h"
 extern int g_trap_command;
 extern int g_trap_x;
@@ -83,6 +86,28 @@ torirs_nk_debug_panel_draw(struct nk_context* nk, struct GGame* game, TorirsNkDe
                 p->soft3d->width,
                 p->soft3d->height);
 
+            {
+                int tiles = p->soft3d->tile_raster_enabled ? 1 : 0;
+                nk_checkbox_label(nk, "Parallel 3D raster (bands)", &tiles);
+                p->soft3d->tile_raster_enabled = tiles != 0;
+                if( p->soft3d->tile_raster_enabled )
+                {
+                    nk_property_int(
+                        nk,
+                        "Raster threads (0 = CPUs)",
+                        0,
+                        &p->soft3d->tile_raster_threads,
+                        64,
+                        1,
+                        0.1f);
+                    nk_labelf(
+                        nk,
+                        NK_TEXT_LEFT,
+                        "Raster threads in use: %d",
+                        p->soft3d->tile_pool_threads);
+                }
+            }
+
             if( game->view_port )
             {
                 int w = game->view_port->width;
@@ -192,6 +217,72 @@ torirs_nk_debug_panel_draw(struct nk_context* nk, struct GGame* game, TorirsNkDe
             }
         }
 
+        if( game->sys_pose_cache )
+        {
+            struct DashPoseCacheStats pose = {};
+            dashposecache_stats(game->sys_pose_cache, &pose);
+            uint32_t lookups = pose.hits + pose.misses;
+            nk_labelf(
+                nk,
+                NK_TEXT_LEFT,
+                "Pose cache: %u hits / %u misses (%.1f%%)",
+                pose.hits,
+                pose.misses,
+                lookups ? 100.0 * pose.hits / lookups : 0.0);
+            nk_labelf(
+                nk,
+                NK_TEXT_LEFT,
+                "Poses: %d / %d (%.1f KB, %u evicted)",
+                pose.count,
+                pose.capacity,
+                pose.bytes / 1024.0,
+                pose.evictions);
+        }
+
+        if( game->sys_obj_icon_cache )
+        {
+            struct ObjIconCacheStats icons = {};
+            obj_icon_cache_stats(game->sys_obj_icon_cache, &icons);
+            uint32_t lookups = icons.hits + icons.misses;
+            nk_labelf(
+                nk,
+                NK_TEXT_LEFT,
+                "Icon cache: %u hits / %u misses (%.1f%%)",
+                icons.hits,
+                icons.misses,
+                lookups ? 100.0 * icons.hits / lookups : 0.0);
+            nk_labelf(
+                nk,
+                NK_TEXT_LEFT,
+                "Icons: %d / %d (%.1f KB, %u evicted)",
+                icons.count,
+                icons.capacity,
+                icons.bytes / 1024.0,
+                icons.evictions);
+        }
+
+        if( game->sys_text_cache )
+        {
+            struct DashTextCacheStats text = {};
+            dashtextcache_stats(game->sys_text_cache, &text);
+            uint32_t lookups = text.hits + text.misses;
+            nk_labelf(
+                nk,
+                NK_TEXT_LEFT,
+                "Text cache: %u hits / %u misses (%.1f%%)",
+                text.hits,
+                text.misses,
+                lookups ? 100.0 * text.hits / lookups : 0.0);
+            nk_labelf(
+                nk,
+                NK_TEXT_LEFT,
+                "Text layouts: %d / %d (%.1f KB, %u evicted)",
+                text.count,
+                text.capacity,
+                text.bytes / 1024.0,
+                text.evictions);
+        }
+
         if( p->include_load_counts )
         {
             nk_labelf(nk, NK_TEXT_LEFT, "Loaded model keys: %zu", p->loaded_models);
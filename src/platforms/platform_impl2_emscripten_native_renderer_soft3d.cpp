@@ -2,6 +2,7 @@
 
 extern "C" {
 #include "graphics/dash.h"
+#include "graphics/dash_text_cache.h"
 #include "osrs/game.h"
 #include "tori_rs.h"
 #include "tori_rs_render.h"
@@ -286,7 +287,8 @@ PlatformImpl2_Emscripten_Native_Renderer_Soft3D_Render(
             const uint8_t* text = command._font_draw.text;
             if( f && text && renderer->pixel_buffer )
             {
-                dashfont_draw_text_ex(
+                dashtextcache_draw_text_ex(
+                    game->sys_text_cache,
                     f,
                     (uint8_t*)text,
                     command._font_draw.x,
@@ -330,7 +332,7 @@ PlatformImpl2_Emscripten_Native_Renderer_Soft3D_Render(
                 break;
             if( command._sprite_draw.rotated )
             {
-                dash2d_blit_rotated_ex(
+                dash2d_blit_rotated_masked(
                     (int*)sp->pixels_argb,
                     sp->width,
                     command._sprite_draw.src_bb_x,
@@ -348,7 +350,8 @@ PlatformImpl2_Emscripten_Native_Renderer_Soft3D_Render(
                     command._sprite_draw.dst_bb_h,
                     command._sprite_draw.dst_anchor_x,
                     command._sprite_draw.dst_anchor_y,
-                    rot);
+                    rot,
+                    command._sprite_draw.clip_circle);
             }
             else
             {
@@ -93,7 +93,6 @@ extern "C" {
 #include "osrs/buildcachedat_loader.h"
 #include "osrs/filepack.h"
 #include "osrs/game.h"
-#include "osrs/gameproto_parse.h"
 #include "osrs/gio_cache_dat.h"
 #include "osrs/lua_sidecar/lua_api.h"
 #include "osrs/lua_sidecar/lua_configfile.h"
@@ -102,6 +101,7 @@ extern "C" {
 #include "osrs/lua_sidecar/luac_sidecar.h"
 #include "osrs/lua_sidecar/luac_sidecar_cachedat.h"
 #include "osrs/lua_sidecar/luac_sidecar_config.h"
+#include "osrs/packet_queue.h"
 #include "osrs/rscache/cache_dat.h"
 #include "osrs/rscache/filelist.h"
 #include "osrs/rscache/tables/config_locs.h"
@@ -432,8 +432,7 @@ Platform2_SDL2_RunLuaScripts(
         void* pkt_free = script.lc245_packet_item_to_free;
         if( pkt_free )
         {
-            gameproto_free_lc245_2_item((struct RevPacket_LC245_2_Item*)pkt_free);
-            free(pkt_free);
+            packet_queue_release((struct RevPacket_LC245_2_Item*)pkt_free);
         }
     }
 }
@@ -27,10 +27,13 @@ soft3d_platform_display_scale(void* platform)
 
 extern "C" {
 #include "graphics/dash.h"
+#include "graphics/dash_text_cache.h"
 #include "graphics/raster/deob/pix3d_deob_compat.h"
 #include "osrs/game.h"
 #include "osrs/world_option_set.h"
+#include "graphics/dash_bench.h"
 #include "platforms/common/platform_memory.h"
+#include "platforms/common/platform_thread.h"
 #include "tori_rs.h"
 #include "tori_rs_render.h"
 }
@@ -57,6 +60,66 @@ torirs_nk_bench_panel_unregister(void)
     s_bench_panel_draw = nullptr;
 }
 
+struct Soft3DTileRasterJob
+{
+    struct DashTileBins* bins;
+    int* pixel_buffer;
+};
+
+static void
+soft3d_tile_raster_job(
+    void* userdata,
+    int job,
+    int worker)
+{
+    (void)worker;
+    struct Soft3DTileRasterJob* ctx = (struct Soft3DTileRasterJob*)userdata;
+    dash3d_tile_bins_raster_tile(ctx->bins, job, ctx->pixel_buffer);
+}
+
+/** Returns true when this frame's MODEL_DRAWs should be binned instead of rastered inline. */
+static bool
+soft3d_tile_raster_prepare(struct Platform2_SDL2_Renderer_Soft3D* renderer)
+{
+    if( !renderer->tile_raster_enabled || g_raster_bench.active )
+        return false;
+
+    if( !renderer->tile_bins )
+    {
+        renderer->tile_bins = dash3d_tile_bins_new();
+        if( !renderer->tile_bins )
+            return false;
+    }
+
+    int threads = renderer->tile_raster_threads;
+    if( threads <= 0 )
+        threads = platform_cpu_count();
+    if( !renderer->tile_pool || renderer->tile_pool_threads != threads )
+    {
+        platform_worker_pool_free(renderer->tile_pool);
+        renderer->tile_pool = platform_worker_pool_new(threads);
+        renderer->tile_pool_threads = threads;
+    }
+    return true;
+}
+
+static void
+soft3d_tile_raster_flush(
+    struct Platform2_SDL2_Renderer_Soft3D* renderer,
+    struct GGame* game,
+    int* vp_pixels)
+{
+    struct DashTileBins* bins = renderer->tile_bins;
+    if( dash3d_tile_bins_draw_count(bins) > 0 )
+    {
+        struct Soft3DTileRasterJob job = { bins, vp_pixels };
+        platform_worker_pool_run(
+            renderer->tile_pool, dash3d_tile_bins_tile_count(bins), soft3d_tile_raster_job, &job);
+    }
+    dash3d_tile_bins_reset(
+        bins, game->sys_dash, game->view_port, game->camera, renderer->tile_raster_height);
+}
+
 static void
 render_nuklear_overlay(
     struct Platform2_SDL2_Renderer_Soft3D* renderer,
@@ -149,6 +212,8 @@ PlatformImpl2_SDL2_Renderer_Soft3DShared_Free(struct Platform2_SDL2_Renderer_Sof
     if( !renderer )
         return;
     PlatformImpl2_SDL2_Renderer_Soft3DShared_Shutdown(renderer);
+    platform_worker_pool_free(renderer->tile_pool);
+    dash3d_tile_bins_free(renderer->tile_bins);
     free(renderer->pixel_buffer);
     free(renderer);
 }
@@ -351,9 +416,23 @@ PlatformImpl2_SDL2_Renderer_Soft3DShared_Render(
     Uint64 const soft3d_perf_freq = SDL_GetPerformanceFrequency();
     Uint64 const soft3d_t_frame_start = SDL_GetPerformanceCounter();
 
+    bool const tile_raster =
+        vp_pixels && game->sys_dash && soft3d_tile_raster_prepare(renderer);
+    if( tile_raster )
+        dash3d_tile_bins_reset(
+            renderer->tile_bins,
+            game->sys_dash,
+            game->view_port,
+            game->camera,
+            renderer->tile_raster_height);
+
     LibToriRS_FrameBegin(game, render_command_buffer);
     while( LibToriRS_FrameNextCommand(game, render_command_buffer, &command, true) )
     {
+        /* Binned models must land before anything that draws over or reads the 3D pass. */
+        if( tile_raster && command.kind != TORIRS_GFX_MODEL_DRAW )
+            soft3d_tile_raster_flush(renderer, game, vp_pixels);
+
         switch( command.kind )
         {
         case TORIRS_GFX_FONT_LOAD:
@@ -398,7 +477,8 @@ PlatformImpl2_SDL2_Renderer_Soft3DShared_Render(
             }
             if( cl < cr && ct < cb )
             {
-                dashfont_draw_text_ex_clipped(
+                dashtextcache_draw_text_ex_clipped(
+                    game->sys_text_cache,
                     f,
                     (uint8_t*)text,
                     fx,
@@ -435,7 +515,15 @@ PlatformImpl2_SDL2_Renderer_Soft3DShared_Render(
         }
         break;
         case TORIRS_GFX_MODEL_DRAW:
-            if( vp_pixels )
+            if( tile_raster )
+                dash3d_tile_bins_push_projected_model(
+                    renderer->tile_bins,
+                    game->sys_dash,
+                    command._model_draw.model,
+                    game->view_port,
+                    game->camera,
+                    false);
+            else if( vp_pixels )
                 dash3d_raster_projected_model(
                     game->sys_dash,
                     command._model_draw.model,
@@ -462,7 +550,7 @@ PlatformImpl2_SDL2_Renderer_Soft3DShared_Render(
                 break;
             if( command._sprite_draw.rotated )
             {
-                dash2d_blit_rotated_ex(
+                dash2d_blit_rotated_masked(
                     (int*)sp->pixels_argb,
                     sp->width,
                     command._sprite_draw.src_bb_x,
@@ -480,7 +568,8 @@ PlatformImpl2_SDL2_Renderer_Soft3DShared_Render(
                     command._sprite_draw.dst_bb_h,
                     command._sprite_draw.dst_anchor_x,
                     command._sprite_draw.dst_anchor_y,
-                    rot);
+                    rot,
+                    command._sprite_draw.clip_circle);
             }
             else
             {
@@ -505,6 +594,8 @@ PlatformImpl2_SDL2_Renderer_Soft3DShared_Render(
             break;
         }
     }
+    if( tile_raster )
+        soft3d_tile_raster_flush(renderer, game, vp_pixels);
     LibToriRS_FrameEnd(game);
 
     {
@@ -7,6 +7,8 @@
 
 struct GGame;
 struct ToriRSRenderCommandBuffer;
+struct DashTileBins;
+struct PlatformWorkerPool;
 
 /** Shared soft3D renderer state (native SDL2 + Emscripten SDL2). `platform` is
  *  `Platform2_SDL2*`; use accessors in shared.cpp. */
@@ -29,6 +31,17 @@ struct Platform2_SDL2_Renderer_Soft3D
     /** Wall ms for last LibToriRS_FrameBegin..FrameEnd (soft raster + command drain). */
     double last_raster_ms;
 
+    /** Band-parallel 3D raster: MODEL_DRAW faces are binned into horizontal viewport bands and
+     *  rastered by a worker pool whenever a non-model command (or the frame end) arrives.
+     *  `tile_raster_threads` <= 0 means one thread per CPU. Ignored while the raster bench
+     *  selector is active, since bench kernel variants are not band-aware. */
+    bool tile_raster_enabled;
+    int tile_raster_threads;
+    int tile_raster_height;
+    struct DashTileBins* tile_bins;
+    struct PlatformWorkerPool* tile_pool;
+    int tile_pool_threads;
+
     int first_frame;
     int clicked_tile_x;
     int clicked_tile_z;
@@ -29,7 +29,6 @@ extern "C" {
 extern "C" {
 #include "3rd/lua/lua.h"
 #include "osrs/game.h"
-#include "osrs/gameproto_parse.h"
 #include "osrs/gio_cache_dat.h"
 #include "osrs/lua_sidecar/lua_api.h"
 #include "osrs/lua_sidecar/lua_configfile.h"
@@ -38,6 +37,7 @@ extern "C" {
 #include "osrs/lua_sidecar/luac_sidecar.h"
 #include "osrs/lua_sidecar/luac_sidecar_cachedat.h"
 #include "osrs/lua_sidecar/luac_sidecar_config.h"
+#include "osrs/packet_queue.h"
 #include "osrs/rscache/cache_dat.h"
 #include "osrs/scripts/lua_cache_fnnos.h"
 #include "tori_rs.h"
@@ -889,8 +889,7 @@ Platform2_Win32_RunLuaScripts(struct Platform2_Win32* platform, struct GGame* ga
         void* pkt_free = script.lc245_packet_item_to_free;
         if( pkt_free )
         {
-            gameproto_free_lc245_2_item((struct RevPacket_LC245_2_Item*)pkt_free);
-            free(pkt_free);
+            packet_queue_release((struct RevPacket_LC245_2_Item*)pkt_free);
         }
     }
 }
@@ -15,6 +15,7 @@
  * win the include race and pin dash/cache_dat to C++ linkage (breaks MinGW link vs .c objs). */
 extern "C" {
 #include "graphics/dash.h"
+#include "graphics/dash_text_cache.h"
 #include "osrs/game.h"
 #include "tori_rs.h"
 #include "tori_rs_render.h"
@@ -516,7 +517,8 @@ PlatformImpl2_Win32_Renderer_GDISoft3D_Render(
             }
             if( cl < cr && ct < cb )
             {
-                dashfont_draw_text_ex_clipped(
+                dashtextcache_draw_text_ex_clipped(
+                    game->sys_text_cache,
                     f,
                     (uint8_t*)text,
                     fx,
@@ -580,7 +582,7 @@ PlatformImpl2_Win32_Renderer_GDISoft3D_Render(
                 break;
             if( command._sprite_draw.rotated )
             {
-                dash2d_blit_rotated_ex(
+                dash2d_blit_rotated_masked(
                     (int*)sp->pixels_argb,
                     sp->width,
                     command._sprite_draw.src_bb_x,
@@ -598,7 +600,8 @@ PlatformImpl2_Win32_Renderer_GDISoft3D_Render(
                     command._sprite_draw.dst_bb_h,
                     command._sprite_draw.dst_anchor_x,
                     command._sprite_draw.dst_anchor_y,
-                    rot);
+                    rot,
+                    command._sprite_draw.clip_circle);
             }
             else
             {
@@ -42,6 +42,10 @@ LibToriRS_LuaScriptQueueIsEmpty(struct GGame* game)
 {
     if( !game )
         return true;
+    /* Scripts queued behind a center-zone rebuild expect the new world; hold them until the
+     * rebuild has been swapped in. */
+    if( game->world_rebuild )
+        return true;
     return script_queue_empty(&game->script_queue) != 0;
 }
 
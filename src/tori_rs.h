@@ -86,6 +86,19 @@ LibToriRS_GameSetWorldViewportRect(
     int width,
     int height);
 
+/** Caps center-zone rebuild work per LibToriRS_GameStep; <= 0 rebuilds in a single step. */
+void
+LibToriRS_GameSetRebuildBudgetMs(
+    struct GGame* game,
+    int budget_ms);
+
+/** Memory budget for map squares and models prefetched ahead of zone crossings (and kept warm
+ *  after them); 0 disables prefetching. */
+void
+LibToriRS_GameSetPrefetchBudgetBytes(
+    struct GGame* game,
+    int64_t budget_bytes);
+
 void
 LibToriRS_GameProcessInput(
     struct GGame* game,
@@ -5,6 +5,7 @@
 #include "3rd/lua/lua.h"
 #include "graphics/dash.h"
 #include "osrs/buildcachedat.h"
+#include "osrs/buildcachedat_loader.h"
 #include "osrs/collision_map.h"
 #include "osrs/dash_utils.h"
 #include "osrs/game.h"
@@ -28,6 +29,11 @@
 /* Client.ts ClientProt.MOVE_GAMECLICK = 182 (index 255) */
 #define MOVE_GAMECLICK_OPCODE 182
 
+/* The server rebuilds once the local player is within 16 tiles of the scene edge; start
+ * prefetching the zone that rebuild will center on 16 tiles before that. */
+#define PREFETCH_REBUILD_EDGE_TILES 16
+#define PREFETCH_EDGE_TILES 32
+
 /* Client.ts ClientCode.CC_LOGOUT = 205 */
 #define CC_LOGOUT 205
 
@@ -242,6 +248,77 @@ entity_face(
     // }
 }
 
+/* Center zone of the next rebuild along one axis, or the current center zone if the player is
+ * not walking toward that edge. */
+static int
+prefetch_axis_zone(
+    int base_tile,
+    int scene_size,
+    int local_tile,
+    int dir)
+{
+    if( dir < 0 && local_tile < PREFETCH_EDGE_TILES )
+        return (base_tile + PREFETCH_REBUILD_EDGE_TILES - 1) >> 3;
+    if( dir > 0 && local_tile >= scene_size - PREFETCH_EDGE_TILES )
+        return (base_tile + scene_size - PREFETCH_REBUILD_EDGE_TILES) >> 3;
+    return (base_tile >> 3) + scene_size / 16;
+}
+
+/* Queue a SCRIPT_PREFETCH_ZONE for the zone the player is walking toward, so the rebuild packet
+ * finds its map squares and models already decoded in the buildcache. */
+static void
+prefetch_predict_zone(struct GGame* game)
+{
+    struct World* world = game->world;
+    if( !world || !world->load_complete || game->world_rebuild )
+        return;
+    if( !game->buildcachedat || game->buildcachedat->prefetch_budget_bytes <= 0 )
+        return;
+
+    struct PlayerEntity* local = world_player(world, ACTIVE_PLAYER_SLOT);
+    if( !local->alive )
+        return;
+
+    int local_x = local->draw_position.x / 128;
+    int local_z = local->draw_position.z / 128;
+    int tile_x = world->_base_tile_x + local_x;
+    int tile_z = world->_base_tile_z + local_z;
+    int step_x = tile_x - game->prefetch_tile_x;
+    int step_z = tile_z - game->prefetch_tile_z;
+    game->prefetch_tile_x = tile_x;
+    game->prefetch_tile_z = tile_z;
+
+    /* Teleported (or first step): no direction to extrapolate from yet. */
+    if( abs(step_x) > 8 || abs(step_z) > 8 )
+    {
+        game->prefetch_dir_x = 0;
+        game->prefetch_dir_z = 0;
+        return;
+    }
+    if( step_x != 0 )
+        game->prefetch_dir_x = step_x > 0 ? 1 : -1;
+    if( step_z != 0 )
+        game->prefetch_dir_z = step_z > 0 ? 1 : -1;
+
+    int size = world->_scene_size;
+    int zone_x = prefetch_axis_zone(world->_base_tile_x, size, local_x, game->prefetch_dir_x);
+    int zone_z = prefetch_axis_zone(world->_base_tile_z, size, local_z, game->prefetch_dir_z);
+    if( zone_x == (world->_base_tile_x >> 3) + size / 16 &&
+        zone_z == (world->_base_tile_z >> 3) + size / 16 )
+        return;
+    if( zone_x == game->prefetch_zone_x && zone_z == game->prefetch_zone_z )
+        return;
+
+    game->prefetch_zone_x = zone_x;
+    game->prefetch_zone_z = zone_z;
+
+    struct ScriptArgs args = {
+        .tag = SCRIPT_PREFETCH_ZONE,
+        .u.prefetch_zone = { .zonex = zone_x, .zonez = zone_z },
+    };
+    script_queue_push(&game->script_queue, &args);
+}
+
 void
 LibToriRS_GameStep(
     struct GGame* game,
@@ -256,6 +333,9 @@ LibToriRS_GameStep(
         return;
     }
 
+    if( game->world_rebuild )
+        buildcachedat_loader_step_scene_centerzone(game->buildcachedat, game);
+
     gameproto_process(game);
 
     if( game->tick_ms >= game->next_camera_save_ms )
@@ -268,6 +348,8 @@ LibToriRS_GameStep(
     if( game->world )
         world_cycle(game->world, game->cycles_elapsed);
 
+    prefetch_predict_zone(game);
+
     /* Terrain tile click: send MOVE_GAMECLICK. Client.ts tryMove(routeTileX[0], routeTileZ[0],
      * x, z, 0, ..., true). Payload: p1(size), p1(run), p2(startX+sceneBase), p2(startZ+sceneBase),
      * then for i=1..bufferSize-1: p1(bfsStepX-startX), p1(bfsStepZ-startZ) (signed byte offset
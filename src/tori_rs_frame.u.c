@@ -2,6 +2,7 @@
 #define TORI_RS_FRAME_U_C
 
 #include "graphics/dash.h"
+#include "graphics/dash_pose_cache.h"
 #include "osrs/game.h"
 #include "osrs/interface_state.h"
 #include "osrs/minimap.h"
@@ -496,6 +497,7 @@ queue_static_ui_minimap_draws(
     static_mm_draw->_sprite_draw.dst_bb_h = component->position.height;
     static_mm_draw->_sprite_draw.rotated = true;
     static_mm_draw->_sprite_draw.rotation_r2pi2048 = ((game->camera_yaw) & 0x7ff);
+    static_mm_draw->_sprite_draw.clip_circle = true;
     static_mm_draw->_sprite_draw.src_bb_x = 0;
     static_mm_draw->_sprite_draw.src_bb_y = 0;
     static_mm_draw->_sprite_draw.src_bb_w = static_sprite->crop_width;
@@ -793,6 +795,8 @@ LibToriRS_FrameBegin(
     game->uiscene_command_idx = 0;
     if( game->uiscene_queued_commands )
         LibToriRS_RenderCommandBufferReset(game->uiscene_queued_commands);
+    if( game->sys_projection_arena )
+        dash_projection_arena_reset(game->sys_projection_arena);
 
     /* Dirty prepass: set is_dirty on every component before tree traversal. */
     if( game->ui_root_buffer )
@@ -844,6 +848,8 @@ LibToriRS_FrameBegin(
         int camera_slevel = game->camera_world_y / 240;
 
         painter_set_camera_angles(painter, game->camera_pitch, game->camera_yaw);
+        painter_set_camera_position(
+            painter, game->camera_world_x, game->camera_world_y, game->camera_world_z);
         painter_set_level_mask(painter, frame_ui_world_level_mask(game));
 
         static int painter_bench_frames;
@@ -907,6 +913,7 @@ LibToriRS_FrameBegin(
 static void
 entity_player_animate(
     struct World* world,
+    struct DashPoseCache* pose_cache,
     int player_entity_id)
 {
     struct PlayerEntity* player = world_player(world, player_entity_id);
@@ -928,7 +935,13 @@ entity_player_animate(
         scene2_element_set_active_frame(scene_element, (uint8_t)frame);
         if( frame >= 0 && frame < primary->count )
         {
-            dashmodel_animate(dm, primary->frames[frame], fm);
+            dashposecache_animate(
+                pose_cache,
+                dm,
+                animation->primary_anim.anim_id,
+                frame,
+                primary->frames[frame],
+                fm);
         }
     }
     else if( animation->secondary_anim.anim_id != -1 && secondary && secondary->count > 0 )
@@ -938,7 +951,13 @@ entity_player_animate(
         scene2_element_set_active_frame(scene_element, (uint8_t)frame);
         if( frame >= 0 && frame < secondary->count )
         {
-            dashmodel_animate(dm, secondary->frames[frame], fm);
+            dashposecache_animate(
+                pose_cache,
+                dm,
+                animation->secondary_anim.anim_id,
+                frame,
+                secondary->frames[frame],
+                fm);
         }
     }
     else
@@ -951,6 +970,7 @@ entity_player_animate(
 static void
 entity_npc_animate(
     struct World* world,
+    struct DashPoseCache* pose_cache,
     int npc_entity_id)
 {
     struct NPCEntity* npc = world_npc(world, npc_entity_id);
@@ -972,7 +992,13 @@ entity_npc_animate(
         scene2_element_set_active_frame(scene_element, (uint8_t)frame);
         if( frame >= 0 && frame < primary->count )
         {
-            dashmodel_animate(dm, primary->frames[frame], fm);
+            dashposecache_animate(
+                pose_cache,
+                dm,
+                animation->primary_anim.anim_id,
+                frame,
+                primary->frames[frame],
+                fm);
         }
     }
     else if( animation->secondary_anim.anim_id != -1 && secondary && secondary->count > 0 )
@@ -982,7 +1008,13 @@ entity_npc_animate(
         scene2_element_set_active_frame(scene_element, (uint8_t)frame);
         if( frame >= 0 && frame < secondary->count )
         {
-            dashmodel_animate(dm, secondary->frames[frame], fm);
+            dashposecache_animate(
+                pose_cache,
+                dm,
+                animation->secondary_anim.anim_id,
+                frame,
+                secondary->frames[frame],
+                fm);
         }
     }
     else
@@ -1063,15 +1095,16 @@ entity_map_build_loc_entity_animate(
 static void
 entity_animate(
     struct World* world,
+    struct DashPoseCache* pose_cache,
     int entity_uid)
 {
     switch( entity_kind_from_uid(entity_uid) )
     {
     case ENTITY_KIND_PLAYER:
-        entity_player_animate(world, entity_id_from_uid(entity_uid));
+        entity_player_animate(world, pose_cache, entity_id_from_uid(entity_uid));
         break;
     case ENTITY_KIND_NPC:
-        entity_npc_animate(world, entity_id_from_uid(entity_uid));
+        entity_npc_animate(world, pose_cache, entity_id_from_uid(entity_uid));
         break;
     case ENTITY_KIND_MAP_BUILD_LOC:
         entity_map_build_loc_entity_animate(world, entity_id_from_uid(entity_uid));
@@ -1243,6 +1276,135 @@ uielem_sprite_step(
     return true;
 }
 
+/* Projects into the frame arena so the record survives until the command is consumed; falls back
+ * to the sys_dash scratch when the arena is unavailable. */
+static int
+frame_project_model(
+    struct GGame* game,
+    struct DashModel* model,
+    struct DashPosition* position,
+    struct DashProjectedModel** out_projection)
+{
+    *out_projection = NULL;
+    if( game->sys_projection_arena )
+    {
+        struct DashProjectedModel* projection = dash3d_project_model_arena_occluded(
+            game->sys_projection_arena,
+            model,
+            position,
+            game->view_port,
+            game->camera,
+            game->sys_coverage);
+        if( projection )
+        {
+            *out_projection = projection;
+            return projection->cull;
+        }
+    }
+    return dash3d_project_model(game->sys_dash, model, position, game->view_port, game->camera);
+}
+
+/* Scene element drawn by a painter command, or NULL when the command has nothing to draw. */
+static struct Scene2Element*
+frame_command_scene_element(
+    struct GGame* game,
+    struct PaintersElementCommand* cmd)
+{
+    switch( cmd->_bf_kind )
+    {
+    case PNTR_CMD_ELEMENT:
+        return scene2_element_at(game->world->scene2, cmd->_entity._bf_entity);
+    case PNTR_CMD_TERRAIN:
+    {
+        struct MapBuildTileEntity* tile_entity = world_tile_entity_at(
+            game->world,
+            cmd->_terrain._bf_terrain_x,
+            cmd->_terrain._bf_terrain_z,
+            cmd->_terrain._bf_terrain_y);
+        if( !tile_entity || tile_entity->scene_element.element_id == -1 )
+            return NULL;
+        return scene2_element_at(game->world->scene2, tile_entity->scene_element.element_id);
+    }
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * Occlusion prepass. The painter emits commands back to front, so nothing drawn earlier in the
+ * stream can hide what follows. Instead, terrain tiles and walls are projected up front, nearest
+ * first, and rasterized into the coverage buffer; every later projection tests its bounds against
+ * it. The records are kept in sys_occluder_projections so the main pass does not project them
+ * twice. Needs the projection arena; without it the coverage stays empty.
+ */
+static void
+frame_world_occlusion_prepass(
+    struct GGame* game,
+    int cap)
+{
+    struct DashCoverage* coverage = game->sys_coverage;
+    if( !coverage )
+        return;
+
+    dash_coverage_reset(coverage, game->view_port);
+    if( !game->sys_projection_arena || cap <= 0 )
+        return;
+
+    if( cap > game->sys_occluder_projections_capacity )
+    {
+        free(game->sys_occluder_projections);
+        game->sys_occluder_projections = malloc(sizeof(struct DashProjectedModel*) * cap);
+        game->sys_occluder_projections_capacity = cap;
+    }
+    memset(game->sys_occluder_projections, 0, sizeof(struct DashProjectedModel*) * cap);
+
+    for( int i = cap - 1; i >= 0; i-- )
+    {
+        struct PaintersElementCommand* cmd = &game->sys_painter_buffer->commands[i];
+        if( cmd->_bf_kind == PNTR_CMD_ELEMENT && !cmd->_entity._bf_occluder )
+            continue;
+
+        struct Scene2Element* scene_element = frame_command_scene_element(game, cmd);
+        if( !scene_element )
+            continue;
+        struct DashModel* model = scene2_element_dash_model(scene_element);
+        struct DashPosition* model_pos = scene2_element_dash_position(scene_element);
+        if( !model || !model_pos )
+            continue;
+
+        struct DashPosition position = *model_pos;
+        position.x = position.x - game->camera_world_x;
+        position.y = position.y - game->camera_world_y;
+        position.z = position.z - game->camera_world_z;
+
+        struct DashProjectedModel* projection = NULL;
+        frame_project_model(game, model, &position, &projection);
+        if( !projection )
+            continue;
+
+        game->sys_occluder_projections[i] = projection;
+        dash_coverage_add_projected(coverage, game->sys_dash, projection, game->view_port);
+    }
+}
+
+/* Projects a command's model, reusing the occlusion prepass record when there is one. */
+static int
+frame_project_command_model(
+    struct GGame* game,
+    int command_index,
+    struct DashModel* model,
+    struct DashPosition* position,
+    struct DashProjectedModel** out_projection)
+{
+    if( command_index < game->sys_occluder_projections_capacity &&
+        game->sys_occluder_projections[command_index] )
+    {
+        *out_projection = game->sys_occluder_projections[command_index];
+        return (*out_projection)->cull;
+    }
+    return frame_project_model(game, model, position, out_projection);
+}
+
 static bool
 uielem_world_step(
     struct UIFrameState* fiber,
@@ -1282,6 +1444,9 @@ uielem_world_step(
         clr->_clear_rect.h = game->view_port->height;
     }
 
+    if( game->at_painters_command_index == 0 && game->view_port )
+        frame_world_occlusion_prepass(game, cap);
+
 next:
     if( game->at_painters_command_index >= cap )
     {
@@ -1290,7 +1455,8 @@ next:
         return true;
     }
 
-    cmd = &game->sys_painter_buffer->commands[game->at_painters_command_index];
+    int command_index = game->at_painters_command_index;
+    cmd = &game->sys_painter_buffer->commands[command_index];
 
     game->at_painters_command_index++;
 
@@ -1311,15 +1477,16 @@ next:
         position.y = position.y - game->camera_world_y;
         position.z = position.z - game->camera_world_z;
 
-        int cull = DASHCULL_VISIBLE;
-
-        cull = dash3d_project_model(
-            game->sys_dash, ent_model, &position, game->view_port, game->camera);
-
+        struct DashProjectedModel* projection = NULL;
+        int cull =
+            frame_project_command_model(game, command_index, ent_model, &position, &projection);
         if( cull != DASHCULL_VISIBLE )
             break;
 
-        entity_animate(game->world, scene2_element_parent_entity_id(scene_element));
+        entity_animate(
+            game->world,
+            game->sys_pose_cache,
+            scene2_element_parent_entity_id(scene_element));
 
         if( game->uiscene_queued_commands )
             frame_emit_pass(fiber, FRAME_PASS_3D);
@@ -1333,6 +1500,7 @@ next:
                 model_cache_key_u64(game->world->scene2, scene_element);
             rc->_model_draw.model_id = scene2_element_dash_model_gpu_id(scene_element);
             memcpy(&rc->_model_draw.position, &position, sizeof(struct DashPosition));
+            rc->_model_draw.projection = projection;
         }
     }
     break;
@@ -1362,8 +1530,9 @@ next:
         position.y = position.y - game->camera_world_y;
         position.z = position.z - game->camera_world_z;
 
-        int cull = dash3d_project_model(
-            game->sys_dash, tile_model, &position, game->view_port, game->camera);
+        struct DashProjectedModel* projection = NULL;
+        int cull =
+            frame_project_command_model(game, command_index, tile_model, &position, &projection);
         if( cull != DASHCULL_VISIBLE )
             break;
 
@@ -1379,6 +1548,7 @@ next:
                 model_cache_key_u64(game->world->scene2, scene_element);
             rc->_model_draw.model_id = scene2_element_dash_model_gpu_id(scene_element);
             memcpy(&rc->_model_draw.position, &position, sizeof(struct DashPosition));
+            rc->_model_draw.projection = projection;
         }
     }
     break;
@@ -1456,6 +1626,7 @@ uielem_compass_step(
         command->_sprite_draw.src_anchor_x = sprite->crop_width >> 1;
         command->_sprite_draw.src_anchor_y = sprite->crop_height >> 1;
         command->_sprite_draw.rotation_r2pi2048 = ((game->camera_yaw) & 0x7ff);
+        command->_sprite_draw.clip_circle = true;
     }
 
     return true;
@@ -1559,6 +1730,10 @@ LibToriRS_FrameNextCommand(
             memcpy(command, cmd, sizeof(struct ToriRSRenderCommand));
             game->uiscene_command_idx++;
 
+            /* Renderers read the projection through sys_dash; point it at this draw's record. */
+            if( cmd->kind == TORIRS_GFX_MODEL_DRAW )
+                dash3d_projection_bind(game->sys_dash, cmd->_model_draw.projection);
+
             return true;
         }
 
@@ -5,6 +5,8 @@
 #include "3rd/lua/lua.h"
 #include "3rd/lua/lualib.h"
 #include "graphics/dash.h"
+#include "graphics/dash_pose_cache.h"
+#include "graphics/dash_text_cache.h"
 #include "osrs/cache_utils.h"
 #include "osrs/clientscript_vm.h"
 #include "osrs/configmap.h"
@@ -14,6 +16,8 @@
 #include "osrs/loginproto.h"
 #include "osrs/lua_scripts.h"
 #include "osrs/minimap.h"
+#include "osrs/obj_icon_cache.h"
+#include "osrs/packet_queue.h"
 #include "osrs/player_stats.h"
 #include "osrs/revconfig/revconfig_load.h"
 #include "osrs/revconfig/uiscene.h"
@@ -46,6 +50,19 @@
 #define LUA_SCRIPTS_DIR "../src/osrs/scripts"
 #endif
 
+/** Drops the icons rendered from an obj config that was replaced, or all of them (obj_id -1). */
+static void
+game_obj_changed(
+    void* arg,
+    int obj_id)
+{
+    struct ObjIconCache* cache = (struct ObjIconCache*)arg;
+    if( obj_id == -1 )
+        obj_icon_cache_clear(cache);
+    else
+        obj_icon_cache_invalidate(cache, obj_id);
+}
+
 /** Return the module table stored as upvalue (so require("hostio_utils") works). */
 static int
 hostio_utils_loader(lua_State* L)
@@ -130,6 +147,9 @@ LibToriRS_GameNew(
     dash_init();
 
     game->net_shared = net_shared;
+    game->rebuild_budget_ms = GAME_REBUILD_BUDGET_MS_DEFAULT;
+    game->prefetch_zone_x = -1;
+    game->prefetch_zone_z = -1;
 
     game->viewport_offset_x = 0;
     game->viewport_offset_y = 0;
@@ -172,6 +192,11 @@ LibToriRS_GameNew(
     game->latched = false;
 
     game->sys_dash = dash_new();
+    game->sys_projection_arena = dash_projection_arena_new();
+    game->sys_coverage = dash_coverage_new();
+    game->sys_pose_cache = dashposecache_new(DASH_POSE_CACHE_CAPACITY_DEFAULT);
+    game->sys_obj_icon_cache = obj_icon_cache_new(OBJ_ICON_CACHE_CAPACITY_DEFAULT);
+    game->sys_text_cache = dashtextcache_new(DASH_TEXT_CACHE_CAPACITY_DEFAULT);
 
     platform_get_memory_info(&mem);
     printf(
@@ -207,6 +232,8 @@ LibToriRS_GameNew(
     game->camera->near_plane_z = 50;
 
     game->buildcachedat = buildcachedat_new();
+    game->buildcachedat->obj_changed_fn_nullable = game_obj_changed;
+    game->buildcachedat->obj_changed_arg_nullable = game->sys_obj_icon_cache;
     game->buildcache = NULL;
 
     game->iface = interface_state_new();
@@ -261,6 +288,7 @@ LibToriRS_GameNew(
 
     struct ScriptArgs args;
     script_queue_init(&game->script_queue);
+    packet_queue_init(&game->packets_lc245_2, PACKET_QUEUE_CAPACITY_DEFAULT);
     {
         args = (struct ScriptArgs){
             .tag = SCRIPT_INIT,
@@ -365,12 +393,32 @@ LibToriRS_GameSetWorldViewportRect(
     game_apply_world_viewport_geometry(game, offset_x, offset_y, width, height, true);
 }
 
+void
+LibToriRS_GameSetRebuildBudgetMs(
+    struct GGame* game,
+    int budget_ms)
+{
+    game->rebuild_budget_ms = budget_ms;
+}
+
+void
+LibToriRS_GameSetPrefetchBudgetBytes(
+    struct GGame* game,
+    int64_t budget_bytes)
+{
+    if( game->buildcachedat )
+        buildcachedat_prefetch_set_budget(game->buildcachedat, budget_bytes);
+}
+
 void
 LibToriRS_GameFree(struct GGame* game)
 {
     if( !game )
         return;
 
+    world_rebuild_free(game->world_rebuild);
+    game->world_rebuild = NULL;
+
     if( game->world )
         world_free(game->world);
 
@@ -390,6 +438,14 @@ LibToriRS_GameFree(struct GGame* game)
 
     if( game->sys_dash )
         dash_free(game->sys_dash);
+    if( game->sys_projection_arena )
+        dash_projection_arena_free(game->sys_projection_arena);
+    if( game->sys_coverage )
+        dash_coverage_free(game->sys_coverage);
+    dashposecache_free(game->sys_pose_cache);
+    obj_icon_cache_free(game->sys_obj_icon_cache);
+    dashtextcache_free(game->sys_text_cache);
+    free(game->sys_occluder_projections);
     if( game->sys_painter_buffer )
     {
         free(game->sys_painter_buffer->commands);
@@ -438,6 +494,7 @@ LibToriRS_GameFree(struct GGame* game)
     lua_buildcache_free_init_configmaps(game);
 
     script_queue_clear(&game->script_queue);
+    packet_queue_clear(&game->packets_lc245_2);
 
     free(game);
 }
@@ -4,6 +4,7 @@
 #include "osrs/gameproto_parse.h"
 #include "osrs/gameproto_revisions.h"
 #include "osrs/loginproto.h"
+#include "osrs/packet_queue.h"
 #include "osrs/packetbuffer.h"
 #include "tori_rs.h"
 
@@ -100,30 +101,6 @@ LibToriRS_NetConnectGame(
         &game->net_shared->game_to_platform, TORI_RS_NET_MSG_CONNECT, (uint8_t*)host, strlen(host));
 }
 
-static void
-push_packet_lc245_2(
-    struct GGame* game,
-    struct RevPacket_LC245_2* packet)
-{
-    struct RevPacket_LC245_2_Item* item = malloc(sizeof(struct RevPacket_LC245_2_Item));
-    memset(item, 0, sizeof(struct RevPacket_LC245_2_Item));
-
-    item->packet = *packet;
-    if( !game->packets_lc245_2 )
-    {
-        game->packets_lc245_2 = item;
-    }
-    else
-    {
-        struct RevPacket_LC245_2_Item* list = game->packets_lc245_2;
-        while( list->next_nullable )
-        {
-            list = list->next_nullable;
-        }
-        list->next_nullable = item;
-    }
-}
-
 static void
 net_process_packets(struct GGame* game)
 {
@@ -145,7 +122,16 @@ net_process_packets(struct GGame* game)
             &packet);
 
         if( success )
-            push_packet_lc245_2(game, &packet);
+        {
+            /* Info payloads are used in place; the packet frees them on release. */
+            if( gameproto_lc245_2_takes_payload(packet.packet_type) )
+                packetbuffer_detach_data(game->packet_buffer);
+            if( !packet_queue_push(&game->packets_lc245_2, &packet) )
+            {
+                struct RevPacket_LC245_2_Item dropped = { .packet = packet };
+                gameproto_free_lc245_2_item(&dropped);
+            }
+        }
 
         packetbuffer_reset(game->packet_buffer);
     }
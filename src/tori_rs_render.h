@@ -148,6 +148,10 @@ struct ToriRSRenderCommand
             /** Same Scene2 id as MODEL_LOAD for this element's current model (see
              * scene2_element_dash_model_gpu_id). */
             int model_id;
+            /** Projected vertices for this draw, valid until the next LibToriRS_FrameBegin.
+             * LibToriRS_FrameNextCommand binds it to game->sys_dash before returning the
+             * command; NULL when the core did not project the model. */
+            const struct DashProjectedModel* projection;
         } _model_draw;
         struct
         {
@@ -160,6 +164,9 @@ struct ToriRSRenderCommand
             int dst_bb_h;
             bool rotated;
             int rotation_r2pi2048;
+            /* Rotated draws only: soft3d keeps the ellipse inscribed in dst_bb (minimap, compass).
+             * GPU backends may ignore it; the interface frame covers the corners. */
+            bool clip_circle;
             int src_bb_x;
             int src_bb_y;
             int src_bb_w; /* 0 = full sprite width */
@@ -87,6 +87,14 @@ script_convert_to_lua(
         LuaGameType_VarTypeArrayPush(
             out->args, LuaGameType_NewInt(item->args.u.load_cullmap.draw_radius));
         break;
+    case SCRIPT_PREFETCH_ZONE:
+        set_name(out, "rev245_2/prefetch_zone.lua");
+        out->args = LuaGameType_NewVarTypeArraySpread(2);
+        LuaGameType_VarTypeArrayPush(
+            out->args, LuaGameType_NewInt(item->args.u.prefetch_zone.zonex));
+        LuaGameType_VarTypeArrayPush(
+            out->args, LuaGameType_NewInt(item->args.u.prefetch_zone.zonez));
+        break;
     default:
         assert(false && "Unknown script kind");
         break;
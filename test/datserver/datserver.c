@@ -570,7 +570,8 @@ send_multipart_response(
         struct CacheDatArchive* archive = NULL;
         int table_id = reqs[i].table_id;
         int archive_id = reqs[i].archive_id;
-        int flags = reqs[i].flags;
+        /* Flag 4 (leave compressed) is a native-only hint; archives are always served inflated. */
+        int flags = reqs[i].flags & 3;
 
         if( table_id == CACHE_DAT_MAPS )
         {
@@ -824,6 +825,7 @@ handle_client(
             close(client_fd);
             return;
         }
+        flags &= 3;
 
         struct CacheDatArchive* archive = NULL;
         if( table_id == CACHE_DAT_MAPS )